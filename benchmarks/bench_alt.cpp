@@ -0,0 +1,106 @@
+/**
+ * @file bench_alt.cpp
+ * @brief ALT landmarks: settled nodes versus Dijkstra, table memory and bin pruning rate.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Usage: bench_alt [maxNodes] [queries] [landmarks]
+ */
+
+#include <string>
+
+#include "bench_common.h"
+#include "core/Facilities.h"
+#include "core/LandmarkOracle.h"
+#include "core/RoutePlanner.h"
+
+using namespace project;
+
+int main(int argc, char** argv) {
+    int maxNodes = bench::argOr(argc, argv, 1, 250000);
+    int queries = bench::argOr(argc, argv, 2, 50);
+    int landmarkCount = bench::argOr(argc, argv, 3, 8);
+    const int sides[] = {100, 316, 500};
+    const int binCount = 2000;
+
+    std::printf("=== ALT (%d landmarks) vs Dijkstra, plus candidate pruning in selectNextBin ===\n",
+                landmarkCount);
+    std::printf("%10s %10s %10s %12s %12s %8s %10s %10s %9s %10s\n", "nodes", "build(ms)",
+                "tables(KB)", "dij settled", "ALT settled", "ratio", "dij(ms/q)", "ALT(ms/q)",
+                "pruned", "select x");
+
+    for (int side : sides) {
+        int nodes = side * side;
+        if (nodes > maxNodes)
+            break;
+
+        Graph* graph = bench::makeGridCity(side, 10, 42);
+        RoutePlanner planner(*graph);
+        LandmarkOracle oracle(planner.getNetwork());
+        oracle.build(landmarkCount);
+
+        bench::Random rng(7);
+        bench::Timer timer;
+        long long dijkstraSettled = 0, altSettled = 0;
+        double dijkstraMs = 0.0, altMs = 0.0;
+        int mismatches = 0;
+
+        for (int q = 0; q < queries; q++) {
+            int from = rng.range(0, nodes - 1);
+            int to = rng.range(0, nodes - 1);
+            int settled = 0;
+
+            timer.reset();
+            int a = planner.searchDistance(from, to, RoutePlanner::SearchMode::Dijkstra, &settled);
+            dijkstraMs += timer.elapsedMs();
+            dijkstraSettled += settled;
+
+            timer.reset();
+            int b = oracle.distance(from, to, &settled);
+            altMs += timer.elapsedMs();
+            altSettled += settled;
+
+            if (a != b)
+                mismatches++;
+        }
+
+        // Bins at random corners with random fill; the truck jumps around the city
+        Facilities facilities;
+        for (int i = 0; i < binCount; i++) {
+            facilities.addBin(Bin("B" + std::to_string(i), "Grid", 100, rng.range(1, 90),
+                                  rng.range(1, 20), rng.range(0, nodes - 1)));
+        }
+
+        RoutePlanner pruned(*graph);
+        LandmarkOracle prunedOracle(pruned.getNetwork());
+        prunedOracle.build(landmarkCount);
+        pruned.setLandmarkOracle(&prunedOracle);
+
+        double plainMs = 0.0, prunedMs = 0.0;
+        for (int q = 0; q < queries; q++) {
+            facilities.setTruck(Truck("T1", 1000, 0, rng.range(0, nodes - 1)));
+
+            timer.reset();
+            int a = planner.selectNextBin(facilities);
+            plainMs += timer.elapsedMs();
+
+            timer.reset();
+            int b = pruned.selectNextBin(facilities);
+            prunedMs += timer.elapsedMs();
+
+            if (a != b)
+                mismatches++;
+        }
+        long long scored = pruned.getCandidatesScored();
+
+        std::printf("%10d %10.1f %10.0f %12lld %12lld %7.2fx %10.3f %10.3f %8.1f%% %9.2fx%s\n",
+                    nodes, oracle.getBuildMillis(), oracle.getMemoryUsage() / 1024.0,
+                    dijkstraSettled / queries, altSettled / queries,
+                    altSettled > 0 ? static_cast<double>(dijkstraSettled) / altSettled : 0.0,
+                    dijkstraMs / queries, altMs / queries,
+                    scored > 0 ? 100.0 * pruned.getCandidatesPruned() / scored : 0.0,
+                    prunedMs > 0 ? plainMs / prunedMs : 0.0, mismatches ? "  MISMATCH" : "");
+        delete graph;
+    }
+    return 0;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file bench_astar.cpp
+ * @brief Settled nodes and query time of A* versus Dijkstra on grid cities.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Usage: bench_astar [maxNodes] [queries]
+ */
+
+#include "bench_common.h"
+#include "core/RoutePlanner.h"
+
+using namespace project;
+
+int main(int argc, char** argv) {
+    int maxNodes = bench::argOr(argc, argv, 1, 1000000);
+    int queries = bench::argOr(argc, argv, 2, 50);
+    const int sides[] = {100, 316, 1000};
+
+    std::printf("=== Point-to-point search: Dijkstra vs A* (straight-line heuristic) ===\n");
+    std::printf("%10s %14s %14s %8s %14s %14s %9s\n", "nodes", "dij settled", "A* settled",
+                "ratio", "dij(ms/q)", "A*(ms/q)", "speedup");
+
+    for (int side : sides) {
+        if (side * side > maxNodes)
+            break;
+
+        Graph* graph = bench::makeGridCity(side, 10, 42);
+        RoutePlanner planner(*graph);
+
+        bench::Random rng(7);
+        bench::Timer timer;
+        long long dijkstraSettled = 0, astarSettled = 0;
+        double dijkstraMs = 0.0, astarMs = 0.0;
+        int mismatches = 0;
+
+        for (int q = 0; q < queries; q++) {
+            int from = rng.range(0, side * side - 1);
+            int to = rng.range(0, side * side - 1);
+            int settled = 0;
+
+            timer.reset();
+            int a = planner.searchDistance(from, to, RoutePlanner::SearchMode::Dijkstra, &settled);
+            dijkstraMs += timer.elapsedMs();
+            dijkstraSettled += settled;
+
+            timer.reset();
+            int b = planner.searchDistance(from, to, RoutePlanner::SearchMode::AStar, &settled);
+            astarMs += timer.elapsedMs();
+            astarSettled += settled;
+
+            if (a != b)
+                mismatches++;
+        }
+
+        std::printf("%10d %14lld %14lld %7.2fx %14.3f %14.3f %8.2fx%s\n", side * side,
+                    dijkstraSettled / queries, astarSettled / queries,
+                    astarSettled > 0 ? static_cast<double>(dijkstraSettled) / astarSettled : 0.0,
+                    dijkstraMs / queries, astarMs / queries,
+                    astarMs > 0 ? dijkstraMs / astarMs : 0.0, mismatches ? "  MISMATCH" : "");
+        delete graph;
+    }
+    return 0;
+}
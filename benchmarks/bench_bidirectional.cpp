@@ -0,0 +1,91 @@
+/**
+ * @file bench_bidirectional.cpp
+ * @brief Settled nodes of bidirectional versus one-way Dijkstra on cross-town and random legs.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Usage: bench_bidirectional [maxNodes] [queries]
+ * A cross-town leg runs from the west side of the city (depot) to the east side
+ * (distant disposal site), half the city width away. Corner-to-corner legs are not
+ * used: there the city boundary clips both search balls and hides the difference.
+ */
+
+#include "bench_common.h"
+#include "core/RoutePlanner.h"
+
+using namespace project;
+
+namespace {
+
+/**
+ * @brief Picks a random node within `radius` cells of grid cell (col, row).
+ */
+int nodeNear(bench::Random& rng, int side, int col, int row, int radius) {
+    int r = row + rng.range(-radius, radius);
+    int c = col + rng.range(-radius, radius);
+    r = r < 0 ? 0 : (r >= side ? side - 1 : r);
+    c = c < 0 ? 0 : (c >= side ? side - 1 : c);
+    return r * side + c;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int maxNodes = bench::argOr(argc, argv, 1, 1000000);
+    int queries = bench::argOr(argc, argv, 2, 30);
+    const int sides[] = {100, 316, 1000};
+
+    std::printf("=== Bidirectional vs one-way Dijkstra ===\n");
+    std::printf("%10s %12s %14s %14s %8s %12s %12s\n", "nodes", "leg", "dij settled",
+                "bidir settled", "ratio", "dij(ms/q)", "bidir(ms/q)");
+
+    for (int side : sides) {
+        if (side * side > maxNodes)
+            break;
+
+        Graph* graph = bench::makeGridCity(side, 10, 42);
+        graph->enableReverseIndex();
+        RoutePlanner planner(*graph);
+        planner.setSearchMode(RoutePlanner::SearchMode::Bidirectional);
+        int radius = side / 20;
+
+        for (int crossTown = 1; crossTown >= 0; crossTown--) {
+            bench::Random rng(7);
+            bench::Timer timer;
+            long long oneWaySettled = 0, bothSettled = 0;
+            double oneWayMs = 0.0, bothMs = 0.0;
+            int mismatches = 0;
+
+            for (int q = 0; q < queries; q++) {
+                int from = crossTown ? nodeNear(rng, side, side / 4, side / 2, radius)
+                                     : rng.range(0, side * side - 1);
+                int to = crossTown ? nodeNear(rng, side, 3 * side / 4, side / 2, radius)
+                                   : rng.range(0, side * side - 1);
+                int settled = 0;
+
+                timer.reset();
+                int a = planner.searchDistance(from, to, RoutePlanner::SearchMode::Dijkstra,
+                                               &settled);
+                oneWayMs += timer.elapsedMs();
+                oneWaySettled += settled;
+
+                timer.reset();
+                int b = planner.searchDistance(from, to, RoutePlanner::SearchMode::Bidirectional,
+                                               &settled);
+                bothMs += timer.elapsedMs();
+                bothSettled += settled;
+
+                if (a != b)
+                    mismatches++;
+            }
+
+            std::printf("%10d %12s %14lld %14lld %7.2fx %12.3f %12.3f%s\n", side * side,
+                        crossTown ? "cross-town" : "random", oneWaySettled / queries,
+                        bothSettled / queries,
+                        bothSettled > 0 ? static_cast<double>(oneWaySettled) / bothSettled : 0.0,
+                        oneWayMs / queries, bothMs / queries, mismatches ? "  MISMATCH" : "");
+        }
+        delete graph;
+    }
+    return 0;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file bench_binstore.cpp
+ * @brief Daily fill update: Bin objects vs the structure-of-arrays BinStore.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * One simulated day is fill += rate, clamp at capacity, count bins at capacity and
+ * record the fill in the history, for every bin of a region. The last line times a
+ * day on the store followed by `writeTo`, which a simulation whose planners read Bin
+ * objects would need: the write-back touches every Bin again, so the day is no faster
+ * than the Bin loop. That is why `Simulation::step` keeps the single Bin pass.
+ *
+ * Usage: bench_binstore [bins] [days]
+ */
+
+#include <string>
+
+#include "bench_common.h"
+#include "core/BinStore.h"
+#include "core/Facilities.h"
+
+using namespace project;
+
+namespace {
+
+void row(const char* name, double ms, int days, int bins, double baseline, long long overflows) {
+    double perDay = ms / days;
+    std::printf("%-16s %12.2f %12.2f %10.2fx %14lld\n", name, perDay, perDay * 1e6 / bins,
+                baseline / perDay, overflows);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int binCount = bench::argOr(argc, argv, 1, 2000000);
+    int days = bench::argOr(argc, argv, 2, 30);
+
+    bench::Random rng(11);
+    Facilities facilities;
+    for (int i = 0; i < binCount; i++) {
+        facilities.addBin(Bin("B" + std::to_string(i), "Region", rng.range(100, 400),
+                              rng.range(0, 50), rng.range(1, 20), i));
+    }
+
+    BinStore scalar;
+    BinStore vectorized;
+    bench::Timer loadTimer;
+    scalar.load(facilities);
+    double loadMs = loadTimer.elapsedMs();
+    vectorized.load(facilities);
+    scalar.setKernel(BinStore::Kernel::Scalar);
+    vectorized.setKernel(BinStore::Kernel::Avx2);
+
+    std::printf("=== Daily fill update, %d bins, %d days (AVX2 %s) ===\n", binCount, days,
+                BinStore::hasAvx2() ? "available" : "not available");
+    std::printf("%-16s %12s %12s %11s %14s\n", "layout", "ms/day", "ns/bin", "speedup",
+                "overflows");
+
+    // Simulation::step: one pass over the Bin objects
+    long long objectOverflows = 0;
+    Bin* bins = facilities.getBins();
+    bench::Timer objectTimer;
+    for (int d = 0; d < days; d++) {
+        for (int i = 0; i < binCount; i++) {
+            bins[i].updateFill();
+            if (bins[i].isOverflowing())
+                objectOverflows++;
+        }
+    }
+    double objectMs = objectTimer.elapsedMs();
+    double baseline = objectMs / days;
+    row("Bin objects", objectMs, days, binCount, baseline, objectOverflows);
+
+    long long scalarOverflows = 0;
+    bench::Timer scalarTimer;
+    for (int d = 0; d < days; d++) {
+        scalarOverflows += scalar.advanceDay();
+    }
+    row("BinStore scalar", scalarTimer.elapsedMs(), days, binCount, baseline, scalarOverflows);
+
+    long long vectorOverflows = 0;
+    bench::Timer vectorTimer;
+    for (int d = 0; d < days; d++) {
+        vectorOverflows += vectorized.advanceDay();
+    }
+    row(vectorized.getKernel() == BinStore::Kernel::Avx2 ? "BinStore AVX2" : "BinStore (scalar)",
+        vectorTimer.elapsedMs(), days, binCount, baseline, vectorOverflows);
+
+    bool same = scalarOverflows == objectOverflows && vectorOverflows == objectOverflows;
+    for (int i = 0; i < binCount && same; i++) {
+        same = scalar.getFill(i) == bins[i].getCurrentFill() &&
+               vectorized.getFill(i) == bins[i].getCurrentFill();
+    }
+
+    bench::Timer writeTimer;
+    vectorized.writeTo(facilities);
+    double writeMs = writeTimer.elapsedMs();
+
+    // Store'da ilerlet, planlamadan önce günü Bin'lere geri yaz (Bin okuyan planlayıcılar)
+    bench::Timer dailyTimer;
+    for (int d = 0; d < days; d++) {
+        vectorized.advanceDay();
+        vectorized.writeTo(facilities);
+    }
+    double dailyMs = dailyTimer.elapsedMs() / days;
+
+    std::printf("\nSame fills and overflow counts: %s\n", same ? "yes" : "NO");
+    std::printf("load %.1f ms, writeTo %.1f ms (once per batch of days)\n", loadMs, writeMs);
+    std::printf("day with write-back (update + writeTo of the day): %.2f ms vs %.2f ms on Bin "
+                "objects\n",
+                dailyMs, baseline);
+    return 0;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file bench_ch.cpp
+ * @brief Contraction-hierarchies preprocessing cost and query latency versus Dijkstra.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Usage: bench_ch [maxNodes] [queries] [witnessLimit]
+ * Runs on arterial grid cities; plain grids have no road hierarchy and are the
+ * worst case for contraction hierarchies.
+ */
+
+#include "bench_common.h"
+#include "core/RoutePlanner.h"
+#include "data_structures/ContractionHierarchy.h"
+
+#include <vector>
+
+using namespace project;
+
+int main(int argc, char** argv) {
+    int maxNodes = bench::argOr(argc, argv, 1, 600000);
+    int queries = bench::argOr(argc, argv, 2, 1000);
+    const int sides[] = {100, 316, 500, 720, 1000};
+    const int manyTargets = 100;
+
+    std::printf("=== Contraction hierarchies vs Dijkstra ===\n");
+    std::printf("%9s %10s %10s %9s %12s %12s %12s %14s %9s\n", "nodes", "prep(ms)", "shortcuts",
+                "mem(MB)", "dij(us/q)", "ch(us/q)", "ch settled", "1-to-100(us)", "speedup");
+
+    for (int side : sides) {
+        if (side * side > maxNodes)
+            break;
+
+        int nodes = side * side;
+        Graph* graph = bench::makeArterialCity(side, 30, 10, 42);
+        RoutePlanner planner(*graph);
+
+        ContractionHierarchy ch;
+        ch.build(planner.getNetwork(), bench::argOr(argc, argv, 3, 500));
+        HierarchyQuery query(ch);
+
+        bench::Random rng(7);
+        bench::Timer timer;
+        int dijkstraQueries = queries < 20 ? queries : 20;  // Dijkstra is far slower
+        double dijkstraUs = 0.0, chUs = 0.0;
+        long long settled = 0;
+        int mismatches = 0;
+
+        for (int q = 0; q < queries; q++) {
+            int from = rng.range(0, nodes - 1);
+            int to = rng.range(0, nodes - 1);
+
+            timer.reset();
+            int b = query.distance(from, to);
+            chUs += timer.elapsedMs() * 1000.0;
+            settled += query.getSettledCount();
+
+            if (q < dijkstraQueries) {
+                timer.reset();
+                int a = planner.searchDistance(from, to, RoutePlanner::SearchMode::Dijkstra);
+                dijkstraUs += timer.elapsedMs() * 1000.0;
+                if (a != b)
+                    mismatches++;
+            }
+        }
+
+        std::vector<int> targets(manyTargets), out(manyTargets), expected(manyTargets);
+        for (int i = 0; i < manyTargets; i++) {
+            targets[i] = rng.range(0, nodes - 1);
+        }
+        int source = rng.range(0, nodes - 1);
+        timer.reset();
+        query.distances(source, targets.data(), manyTargets, out.data());
+        double manyUs = timer.elapsedMs() * 1000.0;
+        planner.computeDistances(source, targets.data(), manyTargets, expected.data());
+        if (out != expected)
+            mismatches++;
+
+        double dijkstraAvg = dijkstraUs / dijkstraQueries;
+        double chAvg = chUs / queries;
+        std::printf("%9d %10.0f %10d %9.2f %12.1f %12.2f %12lld %14.1f %8.0fx%s\n", nodes,
+                    ch.getBuildMillis(), ch.getShortcutCount(),
+                    ch.getMemoryUsage() / (1024.0 * 1024.0), dijkstraAvg, chAvg,
+                    settled / queries, manyUs, chAvg > 0 ? dijkstraAvg / chAvg : 0.0,
+                    mismatches ? "  MISMATCH" : "");
+        delete graph;
+    }
+    return 0;
+}
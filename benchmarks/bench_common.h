@@ -0,0 +1,125 @@
+/**
+ * @file bench_common.h
+ * @brief Shared helpers for the benchmark programs (timing, synthetic city graphs).
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "data_structures/Graph.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace bench {
+
+/**
+ * @brief Wall-clock stopwatch in milliseconds.
+ */
+class Timer {
+private:
+    std::chrono::steady_clock::time_point start;
+
+public:
+    Timer() : start(std::chrono::steady_clock::now()) {}
+
+    void reset() { start = std::chrono::steady_clock::now(); }
+
+    double elapsedMs() const {
+        auto now = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(now - start).count();
+    }
+};
+
+/**
+ * @brief Small deterministic LCG so every run generates the same instances.
+ */
+class Random {
+private:
+    unsigned long long state;
+
+public:
+    explicit Random(unsigned long long seed) : state(seed * 2862933555777941757ULL + 1) {}
+
+    unsigned int next() {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<unsigned int>(state >> 33);
+    }
+
+    /** @return Uniform integer in [lo, hi]. */
+    int range(int lo, int hi) { return lo + static_cast<int>(next() % (hi - lo + 1)); }
+};
+
+/**
+ * @brief Builds a side x side grid city with two-way streets of random length.
+ *
+ * Node `r * side + c` sits at map position (c * blockLength, r * blockLength); every
+ * street is at least `blockLength` long so Euclidean distances stay admissible lower bounds.
+ * @param side Grid side length (node count is side * side).
+ * @param blockLength Minimum street length between neighbouring nodes.
+ * @param seed Random seed.
+ * @return Pointer to a new Graph (caller must delete).
+ */
+inline project::Graph* makeGridCity(int side, int blockLength, unsigned long long seed) {
+    Random rng(seed);
+    project::Graph* graph = new project::Graph(side * side);
+
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int v = r * side + c;
+            graph->setNodePosition(v, c * blockLength, r * blockLength);
+            if (c + 1 < side) {
+                graph->addBidirectionalEdge(v, v + 1, blockLength + rng.range(0, blockLength / 2));
+            }
+            if (r + 1 < side) {
+                graph->addBidirectionalEdge(v, v + side,
+                                            blockLength + rng.range(0, blockLength / 2));
+            }
+        }
+    }
+    return graph;
+}
+
+/**
+ * @brief Builds a grid city where every `spacing`-th row and column is a fast arterial.
+ *
+ * Arterial streets cost a third of a normal block, which gives the network the
+ * road-hierarchy structure real cities have (plain grids have none).
+ * @param side Grid side length (node count is side * side).
+ * @param blockLength Typical street length between neighbouring nodes.
+ * @param spacing Distance, in blocks, between arterials.
+ * @param seed Random seed.
+ * @return Pointer to a new Graph (caller must delete).
+ */
+inline project::Graph* makeArterialCity(int side, int blockLength, int spacing,
+                                        unsigned long long seed) {
+    Random rng(seed);
+    project::Graph* graph = new project::Graph(side * side);
+
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int v = r * side + c;
+            graph->setNodePosition(v, c * blockLength, r * blockLength);
+            int street = blockLength + rng.range(0, blockLength / 2);
+            if (c + 1 < side) {
+                graph->addBidirectionalEdge(v, v + 1, r % spacing == 0 ? street / 3 : street);
+            }
+            street = blockLength + rng.range(0, blockLength / 2);
+            if (r + 1 < side) {
+                graph->addBidirectionalEdge(v, v + side, c % spacing == 0 ? street / 3 : street);
+            }
+        }
+    }
+    return graph;
+}
+
+/**
+ * @brief Reads an optional integer command-line argument.
+ */
+inline int argOr(int argc, char** argv, int index, int fallback) {
+    return argc > index ? std::atoi(argv[index]) : fallback;
+}
+
+}  // namespace bench
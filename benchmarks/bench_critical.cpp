@@ -0,0 +1,131 @@
+/**
+ * @file bench_critical.cpp
+ * @brief Daily critical-bin check: predicting every bin vs the CriticalBinIndex heap.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Every day all bins fill, the critical ones (at most two days left) are listed and
+ * collected, and "any critical bin?" is asked again (now none is). The scan predicts
+ * every bin, as `RoutePlanner::hasCriticalBins` and the emergency reschedule do. The
+ * index is refreshed with the same predictor, as the simulation's fill pass does:
+ * one prediction per bin, heap work only for bins whose overflow day moved. It then
+ * answers from its heap and re-keys only the collected bins. The fill update is not
+ * timed.
+ *
+ * Usage: bench_critical [bins] [days]
+ */
+
+#include <string>
+
+#include "bench_common.h"
+#include "core/CriticalBinIndex.h"
+#include "core/OverflowPredictor.h"
+
+using namespace project;
+
+int main(int argc, char** argv) {
+    int binCount = bench::argOr(argc, argv, 1, 2000000);
+    int days = bench::argOr(argc, argv, 2, 30);
+    const int threshold = 2;
+
+    bench::Random rng(25);
+    Facilities facilities;
+    for (int i = 0; i < binCount; i++) {
+        facilities.addBin(Bin("B" + std::to_string(i), "Region", rng.range(100, 400),
+                              rng.range(0, 50), rng.range(1, 20), i));
+    }
+    Bin* bins = facilities.getBins();
+    OverflowPredictor predictor(threshold);
+    CriticalBinIndex index(threshold);
+    int* critical = new int[binCount];
+
+    bench::Timer buildTimer;
+    index.build(facilities, predictor, 0);
+    double buildMs = buildTimer.elapsedMs();
+
+    double scanMs = 0;
+    double refreshMs = 0;
+    double anyScanMs = 0;
+    double anyIndexMs = 0;
+    double queryMs = 0;
+    double updateMs = 0;
+    long long listed = 0;
+    long long moved = 0;
+    bool same = true;
+    for (int day = 1; day <= days; day++) {
+        for (int i = 0; i < binCount; i++) {
+            bins[i].updateFill();
+        }
+
+        // Tarama: her bin için tahmin (bugünkü hasCriticalBins + acil durum döngüsü)
+        bench::Timer scanTimer;
+        int scanCount = 0;
+        for (int i = 0; i < binCount; i++) {
+            scanCount += predictor.isCritical(bins[i], i);
+        }
+        scanMs += scanTimer.elapsedMs();
+
+        // Simülasyonun doluluk geçişindeki tazeleme: yalnızca günü kayanlar yığına gider
+        bench::Timer refreshTimer;
+        for (int i = 0; i < binCount; i++) {
+            moved += index.update(i, bins[i], predictor, day);
+        }
+        refreshMs += refreshTimer.elapsedMs();
+
+        bench::Timer queryTimer;
+        int count = index.hasCritical(day) ? index.getCriticalBins(day, critical) : 0;
+        queryMs += queryTimer.elapsedMs();
+        listed += count;
+        same = same && count == scanCount;
+        for (int k = 0; k < count && same; k++) {
+            same = predictor.isCritical(bins[critical[k]], critical[k]);
+        }
+
+        // Kritik bin'ler toplanır; yalnızca onların anahtarı değişir
+        for (int k = 0; k < count; k++) {
+            bins[critical[k]].collect(bins[critical[k]].getCurrentFill());
+        }
+        bench::Timer updateTimer;
+        for (int k = 0; k < count; k++) {
+            index.update(critical[k], bins[critical[k]], predictor, day);
+        }
+        updateMs += updateTimer.elapsedMs();
+
+        // Toplamadan sonra "kritik var mı?": hiç yokken tarama bütün bin'leri gezer
+        bench::Timer anyScanTimer;
+        bool anyScan = false;
+        for (int i = 0; i < binCount && !anyScan; i++) {
+            anyScan = predictor.isCritical(bins[i], i);
+        }
+        anyScanMs += anyScanTimer.elapsedMs();
+        bench::Timer anyIndexTimer;
+        bool anyIndex = index.hasCritical(day);
+        anyIndexMs += anyIndexTimer.elapsedMs();
+        same = same && anyScan == anyIndex;
+    }
+
+    int urgent[10];
+    bench::Timer topTimer;
+    int top = index.getMostUrgent(10, urgent);
+    double topUs = topTimer.elapsedMs() * 1000.0;
+
+    std::printf("=== Critical bins, %d bins, %d days (threshold %d days) ===\n", binCount, days,
+                threshold);
+    std::printf("%-30s %12s %16s\n", "method", "ms/day", "bins/day");
+    std::printf("%-30s %12.3f\n", "any critical (none): scan", anyScanMs / days);
+    std::printf("%-30s %12.6f\n", "any critical (none): index", anyIndexMs / days);
+    std::printf("%-30s %12.2f %16.1f\n", "list: scan", scanMs / days,
+                static_cast<double>(listed) / days);
+    std::printf("%-30s %12.2f %16.1f\n", "list: index", queryMs / days,
+                static_cast<double>(listed) / days);
+    std::printf("%-30s %12.2f %16.1f\n", "index refresh (moved days)", refreshMs / days,
+                static_cast<double>(moved) / days);
+    std::printf("%-30s %12.2f\n", "index re-key collected", updateMs / days);
+    std::printf("\nbuild %.1f ms once, top-%d %.1f us, same critical bins as the scan: %s\n",
+                buildMs, top, topUs, same ? "yes" : "NO");
+    std::printf("(the refresh runs inside the simulation's fill pass, where each Bin is "
+                "already loaded)\n");
+
+    delete[] critical;
+    return 0;
+}
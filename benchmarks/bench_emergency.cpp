@@ -0,0 +1,100 @@
+/**
+ * @file bench_emergency.cpp
+ * @brief Emergency rescheduling: cheapest insertion into the day's route vs a full re-plan.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Usage: bench_emergency [bins] [side]
+ */
+
+#include <string>
+
+#include "bench_common.h"
+#include "core/DistanceMatrix.h"
+#include "core/EmergencyRescheduler.h"
+#include "core/PlanningState.h"
+#include "core/RouteImprover.h"
+#include "core/RoutePlanner.h"
+
+using namespace project;
+
+int main(int argc, char** argv) {
+    int binCount = bench::argOr(argc, argv, 1, 1000);
+    int side = bench::argOr(argc, argv, 2, 100);
+    const int flaggedCounts[] = {10, 50, 200};
+    const int maxFlagged = 200;
+    const int capacity = 5000;
+    int nodes = side * side;
+    int total = binCount + maxFlagged;
+
+    // The last `maxFlagged` bins are empty when the day is planned, then turn critical
+    Graph* graph = bench::makeGridCity(side, 10, 42);
+    bench::Random rng(binCount);
+    Facilities facilities;
+    facilities.addFacility(Facility("DEPOT", "depot", 0, 0, nodes / 2 + side / 2));
+    facilities.addFacility(Facility("D1", "disposal", 0, 0, rng.range(0, nodes - 1)));
+    facilities.addFacility(Facility("D2", "disposal", 0, 0, rng.range(0, nodes - 1)));
+    for (int i = 0; i < total; i++) {
+        facilities.addBin(Bin("B" + std::to_string(i), "Grid", 100,
+                              i < binCount ? rng.range(10, 90) : 0, 5, rng.range(0, nodes - 1)));
+    }
+    facilities.setTruck(Truck("T1", capacity, 0, facilities.getDepotNode()));
+
+    RoutePlanner planner(*graph);
+    int* points = new int[total + 3];
+    for (int i = 0; i < total; i++) {
+        points[i] = facilities.getBin(i).getNodeId();
+    }
+    points[total] = facilities.getDepotNode();
+    int siteCount = 0;
+    int* sites = facilities.getDisposalNodes(siteCount);
+    points[total + 1] = sites[0];
+    points[total + 2] = sites[1];
+    DistanceMatrix matrix;
+    matrix.build(planner, points, total + 3);
+    planner.setDistanceMatrix(&matrix);
+    delete[] points;
+    delete[] sites;
+
+    // The day's plan: greedy plus local search, which places the disposal stops
+    PlanningState morning(facilities);
+    RouteImprover improver(planner);  // simulation default budget
+    Route day = improver.improve(planner.planRoute(morning), morning);
+    std::printf("=== Emergency rescheduling, %d-bin route on a %d-node grid ===\n", binCount,
+                nodes);
+    std::printf("Planned day: %d stops, %lld units\n\n", day.getLength(),
+                improver.getFinalDistance());
+
+    std::printf("%8s %12s %12s %12s %12s %12s %12s\n", "flagged", "replan(ms)", "insert(ms)",
+                "lookups", "per insert", "replan dist", "insert dist");
+    EmergencyRescheduler rescheduler(planner);
+    for (int flagged : flaggedCounts) {
+        for (int i = binCount; i < total; i++) {
+            facilities.getBin(i).setCurrentFill(i < binCount + flagged ? 95 : 0);
+        }
+        PlanningState noon(facilities);
+
+        // Full re-plan of every bin, then local search as the simulation would
+        bench::Timer replanTimer;
+        Route replanned = improver.improve(planner.planRoute(noon), noon);
+        double replanMs = replanTimer.elapsedMs();
+        long long replanDistance = improver.getFinalDistance();
+
+        // Insert only the flagged bins into the existing route
+        bench::Timer insertTimer;
+        rescheduler.attach(day, noon);
+        long long attachLookups = rescheduler.getLookups();
+        for (int i = binCount; i < binCount + flagged; i++) {
+            rescheduler.insert(i);
+        }
+        double insertMs = insertTimer.elapsedMs();
+        long long lookups = rescheduler.getLookups() - attachLookups;
+
+        std::printf("%8d %12.2f %12.3f %12lld %12lld %12lld %12lld\n", flagged, replanMs,
+                    insertMs, lookups, lookups / flagged, replanDistance,
+                    rescheduler.getPlannedDistance());
+    }
+
+    delete graph;
+    return 0;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file bench_fillstats.cpp
+ * @brief Fill-rate statistics: re-summing the history vs the running aggregates of Bin.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Every bin records one fill level per day and the planner reads its average fill rate
+ * a few times per decision. The old reader summed the whole window on each call; the
+ * bin now keeps the sum, so a read costs the same for a week or a year of history.
+ *
+ * Usage: bench_fillstats [bins] [days] [reads per day]
+ */
+
+#include <string>
+
+#include "bench_common.h"
+#include "core/Bin.h"
+
+using namespace project;
+
+namespace {
+
+// Okuma başına tüm pencereyi toplayan eski getAverageFillRate
+double resummedAverage(const Bin& bin) {
+    const int* history = bin.getFillHistory();
+    long long sum = 0;
+    for (int i = 0; i < bin.getHistoryDays(); i++) {
+        sum += history[i];
+    }
+    return sum / static_cast<double>(bin.getHistoryDays());
+}
+
+void run(int window, int binCount, int days, int reads) {
+    bench::Random rng(window);
+    Bin* bins = new Bin[binCount];
+    for (int i = 0; i < binCount; i++) {
+        bins[i] = Bin("B" + std::to_string(i), "Region", 400, rng.range(0, 50),
+                      rng.range(1, 20), i, window);
+    }
+
+    double resummed = 0;
+    double aggregated = 0;
+    double resumMs = 0;
+    double aggregateMs = 0;
+    double recordMs = 0;
+    for (int d = 0; d < days; d++) {
+        bench::Timer recordTimer;
+        for (int i = 0; i < binCount; i++) {
+            bins[i].updateFill();
+            bins[i].recordFillLevel(bins[i].getCurrentFill());
+            if (bins[i].isOverflowing())
+                bins[i].collect(bins[i].getCurrentFill());
+        }
+        recordMs += recordTimer.elapsedMs();
+
+        bench::Timer resumTimer;
+        for (int r = 0; r < reads; r++) {
+            for (int i = 0; i < binCount; i++) {
+                resummed += resummedAverage(bins[i]);
+            }
+        }
+        resumMs += resumTimer.elapsedMs();
+
+        bench::Timer aggregateTimer;
+        for (int r = 0; r < reads; r++) {
+            for (int i = 0; i < binCount; i++) {
+                aggregated += bins[i].getAverageFillRate();
+            }
+        }
+        aggregateMs += aggregateTimer.elapsedMs();
+    }
+
+    double perRead = 1e6 / (static_cast<double>(binCount) * days * reads);
+    std::printf("%-8d %12.2f %12.2f %10.2fx %14.2f %6s\n", window, resumMs * perRead,
+                aggregateMs * perRead, resumMs / aggregateMs, recordMs * 1e6 / binCount / days,
+                resummed == aggregated ? "yes" : "NO");
+    delete[] bins;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int binCount = bench::argOr(argc, argv, 1, 100000);
+    int days = bench::argOr(argc, argv, 2, 30);
+    int reads = bench::argOr(argc, argv, 3, 3);
+
+    std::printf("=== Average fill rate, %d bins, %d days, %d reads per bin per day ===\n",
+                binCount, days, reads);
+    std::printf("%-8s %12s %12s %11s %14s %6s\n", "window", "resum(ns)", "O(1)(ns)", "speedup",
+                "record(ns)", "same");
+    int windows[] = {7, 30, 90, 365};
+    for (int window : windows) {
+        run(window, binCount, days, reads);
+    }
+    return 0;
+}
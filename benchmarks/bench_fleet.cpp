@@ -0,0 +1,81 @@
+/**
+ * @file bench_fleet.cpp
+ * @brief Fleet planning wall time against worker thread count.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Usage: bench_fleet [bins] [trucks] [improveMs]
+ */
+
+#include <string>
+
+#include "bench_common.h"
+#include "core/DistanceMatrix.h"
+#include "core/FleetPlanner.h"
+#include "core/RoutePlanner.h"
+
+using namespace project;
+
+int main(int argc, char** argv) {
+    int binCount = bench::argOr(argc, argv, 1, 4000);
+    int truckCount = bench::argOr(argc, argv, 2, 32);
+    int improveMs = bench::argOr(argc, argv, 3, 20);
+    const int side = 100;
+    const int nodes = side * side;
+    const int threadCounts[] = {1, 2, 4, 8, 16};
+
+    Graph* graph = bench::makeGridCity(side, 10, 42);
+    bench::Random rng(7);
+    Facilities facilities;
+    facilities.addFacility(Facility("DEPOT", "depot", 0, 0, nodes / 2 + side / 2));
+    facilities.addFacility(Facility("D1", "disposal", 0, 0, rng.range(0, nodes - 1)));
+    facilities.addFacility(Facility("D2", "disposal", 0, 0, rng.range(0, nodes - 1)));
+    for (int i = 0; i < binCount; i++) {
+        facilities.addBin(Bin("B" + std::to_string(i), "Grid", 100, rng.range(10, 90), 5,
+                              rng.range(0, nodes - 1)));
+    }
+    facilities.setTruck(Truck("T1", 2000, 0, facilities.getDepotNode()));
+    for (int t = 1; t < truckCount; t++) {
+        facilities.addTruck(Truck("T" + std::to_string(t + 1), 2000, 0,
+                                  facilities.getDepotNode()));
+    }
+
+    // Matris olmadan açgözlü planlayıcı her adımda Dijkstra çalıştırır
+    RoutePlanner planner(*graph);
+    int* points = new int[binCount + 3];
+    for (int i = 0; i < binCount; i++) {
+        points[i] = facilities.getBin(i).getNodeId();
+    }
+    points[binCount] = facilities.getDepotNode();
+    int siteCount = 0;
+    int* sites = facilities.getDisposalNodes(siteCount);
+    points[binCount + 1] = sites[0];
+    points[binCount + 2] = sites[1];
+    DistanceMatrix matrix;
+    bench::Timer buildTimer;
+    matrix.build(planner, points, binCount + 3);
+    planner.setDistanceMatrix(&matrix);
+    delete[] points;
+    delete[] sites;
+
+    std::printf("=== Fleet planning: %d bins, %d trucks, %d ms local search per truck ===\n",
+                binCount, truckCount, improveMs);
+    std::printf("Distance matrix built in %.1f ms\n", buildTimer.elapsedMs());
+    std::printf("%8s %12s %10s %10s %12s\n", "threads", "assign(ms)", "plan(ms)", "speedup",
+                "distance");
+
+    double baseline = 0.0;
+    for (int threads : threadCounts) {
+        bench::Timer timer;
+        FleetPlanner fleet(planner, facilities, threads);
+        double assignMillis = timer.elapsedMs();
+        fleet.plan(facilities, improveMs);
+        if (threads == 1)
+            baseline = fleet.getLastMillis();
+        std::printf("%8d %12.1f %10.1f %9.2fx %12lld\n", fleet.getThreadCount(), assignMillis,
+                    fleet.getLastMillis(), baseline / fleet.getLastMillis(),
+                    fleet.getPlannedAfter());
+    }
+    delete graph;
+    return 0;
+}
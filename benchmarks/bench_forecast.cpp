@@ -0,0 +1,253 @@
+/**
+ * @file bench_forecast.cpp
+ * @brief Backtest of the overflow forecasts on bins with a weekly fill pattern.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Every bin gets a base inflow, a market day (x2.5) and a busier weekend (x1.6),
+ * plus noise. The days are replayed in order; each morning every model predicts the
+ * day's inflow, the next seven days' inflow and whether the bin is critical (at most
+ * two days left), then sees what was really added. Bins are emptied once 75% full.
+ *
+ * Models: the shipped history predictor (`OverflowPredictor` on Bin history), a flat
+ * average of the last seven inflows, exponential smoothing (`SmoothingForecaster`) and
+ * Holt-Winters (`FillForecaster`). The last two go through the same `ForecastModel`
+ * interface. The first two weeks are warm-up and not scored.
+ *
+ * Usage: bench_forecast [bins] [weeks]
+ */
+
+#include <cmath>
+#include <string>
+
+#include "bench_common.h"
+#include "core/FillForecaster.h"
+#include "core/OverflowPredictor.h"
+#include "core/SmoothingForecaster.h"
+
+using namespace project;
+
+namespace {
+
+const int THRESHOLD = 2;    // critical: at most this many days left
+const int WARMUP_DAYS = 14;
+const int WEEK = 7;
+
+struct Score {
+    double dayError = 0;   // |predicted - actual| inflow of the day
+    double weekError = 0;  // |predicted - actual| inflow of the next 7 days
+    long long scored = 0;
+    long long missed = 0;       // critical in truth, not predicted
+    long long falseAlarms = 0;  // predicted critical, was not
+
+    void add(double dayForecast, double weekForecast, int actualDay, int actualWeek,
+             bool predictedCritical, bool critical) {
+        dayError += std::fabs(dayForecast - actualDay);
+        weekError += std::fabs(weekForecast - actualWeek);
+        scored++;
+        missed += critical && !predictedCritical;
+        falseAlarms += predictedCritical && !critical;
+    }
+};
+
+void row(const char* name, const Score& score, long long criticalDays, double predictNs,
+         double updateNs) {
+    std::printf("%-22s %10.2f %10.2f %9lld %9lld %8.1f%% %12.1f", name,
+                score.dayError / score.scored, score.weekError / score.scored, score.missed,
+                score.falseAlarms, 100.0 * score.missed / (criticalDays > 0 ? criticalDays : 1),
+                predictNs);
+    if (updateNs >= 0)
+        std::printf(" %12.1f\n", updateNs);
+    else
+        std::printf(" %12s\n", "-");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int binCount = bench::argOr(argc, argv, 1, 20000);
+    int weeks = bench::argOr(argc, argv, 2, 12);
+    int days = weeks * WEEK;
+
+    // Bütün seri baştan üretilir: gerçek "kaç gün kaldı" ileriye bakarak hesaplanır
+    bench::Random rng(2026);
+    int* capacity = new int[binCount];
+    int* inflow = new int[static_cast<long long>(days) * binCount];
+    for (int i = 0; i < binCount; i++) {
+        capacity[i] = rng.range(100, 400);
+        int base = rng.range(3, 15);
+        int market = rng.range(0, WEEK - 1);
+        int weekend = rng.range(0, WEEK - 1);
+        for (int d = 0; d < days; d++) {
+            int weekday = d % WEEK;
+            double mean = base;
+            if (weekday == market)
+                mean *= 2.5;
+            else if (weekday == weekend || weekday == (weekend + 1) % WEEK)
+                mean *= 1.6;
+            double noise = 0.8 + 0.4 * rng.range(0, 1000) / 1000.0;
+            inflow[static_cast<long long>(d) * binCount + i] = static_cast<int>(mean * noise + 0.5);
+        }
+    }
+    auto at = [&](int d, int i) { return inflow[static_cast<long long>(d) * binCount + i]; };
+
+    Bin* bins = new Bin[binCount];
+    for (int i = 0; i < binCount; i++) {
+        bins[i] = Bin("B" + std::to_string(i), "Region", capacity[i], 0, at(0, i), i);
+    }
+    FillForecaster model;
+    model.reset(binCount);
+    for (int i = 0; i < binCount; i++) {
+        model.setLevel(i, at(0, i));  // yapılandırılmış hız: ilk günün miktarı
+    }
+    SmoothingForecaster smoothing;
+    smoothing.reset(binCount);
+    for (int i = 0; i < binCount; i++) {
+        smoothing.setLevel(i, at(0, i));
+    }
+    OverflowPredictor history(THRESHOLD);
+    OverflowPredictor smoothed(THRESHOLD);
+    smoothed.setForecaster(&smoothing);
+    OverflowPredictor seasonal(THRESHOLD);
+    seasonal.setForecaster(&model);
+
+    Score historyScore;
+    Score flatScore;
+    Score smoothScore;
+    Score seasonalScore;
+    long long criticalDays = 0;
+    double recordMs = 0;
+    double smoothMs = 0;
+    double observeMs = 0;
+
+    for (int d = 0; d + WEEK < days; d++) {
+        if (d >= WARMUP_DAYS) {
+            for (int i = 0; i < binCount; i++) {
+                int remaining = capacity[i] - bins[i].getCurrentFill();
+                int actualWeek = 0;
+                int truthDays = 0;  // tam kalan gün, OverflowPredictor kuralıyla
+                for (int n = 1; n <= WEEK; n++) {
+                    actualWeek += at(d + n - 1, i);
+                    if (truthDays == 0 && actualWeek > remaining)
+                        truthDays = n > 1 ? n - 1 : 1;
+                }
+                bool critical = truthDays != 0 && truthDays <= THRESHOLD;
+                criticalDays += critical;
+
+                // Geçmiş: Bin'in ortalaması (doluluk seviyelerinin ortalaması) hız sayılır
+                bool historyCritical = history.isCritical(bins[i]);
+                double historyRate = bins[i].getAverageFillRate() > 0
+                                         ? bins[i].getAverageFillRate()
+                                         : bins[i].getFillRate();
+                historyScore.add(historyRate, historyRate * WEEK, at(d, i), actualWeek,
+                                 historyCritical, critical);
+
+                // Son 7 günün eklenen miktarlarının düz ortalaması
+                double flatRate = 0;
+                for (int k = 1; k <= WEEK; k++) {
+                    flatRate += at(d - k, i);
+                }
+                flatRate /= WEEK;
+                int flatDays = static_cast<int>(remaining / flatRate);
+                bool flatCritical = (flatDays < 1 ? 1 : flatDays) <= THRESHOLD;
+                flatScore.add(flatRate, flatRate * WEEK, at(d, i), actualWeek, flatCritical,
+                              critical);
+
+                bool smoothCritical = smoothed.isCritical(bins[i], i);
+                smoothScore.add(smoothing.forecast(i, 1), smoothing.forecast(i, 1) * WEEK,
+                                at(d, i), actualWeek, smoothCritical, critical);
+
+                bool seasonalCritical = seasonal.isCritical(bins[i], i);
+                double seasonalWeek = 0;
+                for (int n = 1; n <= WEEK; n++) {
+                    seasonalWeek += model.forecast(i, n);
+                }
+                seasonalScore.add(model.forecast(i, 1), seasonalWeek, at(d, i), actualWeek,
+                                  seasonalCritical, critical);
+            }
+        }
+
+        // Günün gerçek miktarı: modeller öğrenir, %75 dolan bin boşaltılır
+        for (int i = 0; i < binCount; i++) {
+            int fill = bins[i].getCurrentFill() + at(d, i);
+            bins[i].setCurrentFill(fill < capacity[i] ? fill : capacity[i]);
+        }
+        bench::Timer recordTimer;
+        for (int i = 0; i < binCount; i++) {
+            bins[i].recordFillLevel(bins[i].getCurrentFill());
+        }
+        recordMs += recordTimer.elapsedMs();
+        bench::Timer smoothTimer;
+        for (int i = 0; i < binCount; i++) {
+            smoothing.observe(i, at(d, i));
+        }
+        smoothing.advanceDay();
+        smoothMs += smoothTimer.elapsedMs();
+        bench::Timer observeTimer;
+        for (int i = 0; i < binCount; i++) {
+            model.observe(i, at(d, i));
+        }
+        model.advanceDay();
+        observeMs += observeTimer.elapsedMs();
+        for (int i = 0; i < binCount; i++) {
+            if (bins[i].getCurrentFill() * 4 >= capacity[i] * 3)
+                bins[i].collect(bins[i].getCurrentFill());
+        }
+    }
+
+    // Tahmin hızı: son durumda her modelle bütün bin'ler birkaç tur
+    const int rounds = 20;
+    double predicted = static_cast<double>(rounds) * binCount;
+    long long flagged = 0;  // sonuç kullanılsın ki döngü elenmesin
+    bench::Timer historyTimer;
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < binCount; i++) {
+            flagged += history.isCritical(bins[i]);
+        }
+    }
+    double historyNs = historyTimer.elapsedMs() * 1e6 / predicted;
+    bench::Timer flatTimer;
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < binCount; i++) {
+            double flatRate = 0;
+            for (int k = 1; k <= WEEK; k++) {
+                flatRate += at(days - WEEK - k, i);
+            }
+            flagged += (capacity[i] - bins[i].getCurrentFill()) / (flatRate / WEEK) <= THRESHOLD;
+        }
+    }
+    double flatNs = flatTimer.elapsedMs() * 1e6 / predicted;
+    bench::Timer smoothTimer;
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < binCount; i++) {
+            flagged += smoothed.isCritical(bins[i], i);
+        }
+    }
+    double smoothNs = smoothTimer.elapsedMs() * 1e6 / predicted;
+    bench::Timer seasonalTimer;
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < binCount; i++) {
+            flagged += seasonal.isCritical(bins[i], i);
+        }
+    }
+    double seasonalNs = seasonalTimer.elapsedMs() * 1e6 / predicted;
+
+    double replayed = static_cast<double>(days - WEEK) * binCount;
+    std::printf("=== Backtest, %d bins, %d weeks (%d warm-up days), %lld critical bin-days ===\n",
+                binCount, weeks, WARMUP_DAYS, criticalDays);
+    std::printf("%-22s %10s %10s %9s %9s %9s %12s %12s\n", "model", "MAE day", "MAE week",
+                "missed", "false", "miss rate", "predict(ns)", "update(ns)");
+    row("history (Bin)", historyScore, criticalDays, historyNs, recordMs * 1e6 / replayed);
+    row("flat 7-day inflow", flatScore, criticalDays, flatNs, -1);
+    row("smoothing", smoothScore, criticalDays, smoothNs, smoothMs * 1e6 / replayed);
+    row("Holt-Winters", seasonalScore, criticalDays, seasonalNs, observeMs * 1e6 / replayed);
+    std::printf("\n(%lld critical flags in the timing rounds)\n", flagged);
+    std::printf("State per bin: smoothing %zu bytes, Holt-Winters %zu bytes, Bin object %zu "
+                "bytes\n",
+                sizeof(float), sizeof(FillForecaster::State), sizeof(Bin));
+
+    delete[] bins;
+    delete[] capacity;
+    delete[] inflow;
+    return 0;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file bench_graph.cpp
+ * @brief Dijkstra over the linked-list Graph versus the frozen CSR layout.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Usage: bench_graph [maxNodes] [queries]
+ * Both variants use the same std::priority_queue so only the adjacency layout differs.
+ */
+
+#include "bench_common.h"
+#include "data_structures/CsrGraph.h"
+
+#include <climits>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+using namespace project;
+
+namespace {
+
+typedef std::pair<int, int> Entry;  // (distance, node)
+typedef std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> MinQueue;
+
+long long dijkstraList(const Graph& graph, int from, int to, std::vector<int>& dist) {
+    dist.assign(graph.getNodeCount(), INT_MAX);
+    MinQueue queue;
+    dist[from] = 0;
+    queue.push(Entry(0, from));
+
+    while (!queue.empty()) {
+        Entry top = queue.top();
+        queue.pop();
+        int u = top.second;
+        if (top.first > dist[u])
+            continue;
+        if (u == to)
+            break;
+        const LinkedList<Edge>& adj = graph.getAdjList(u);
+        for (auto it = adj.begin(); it != adj.end(); ++it) {
+            const Edge& e = *it;
+            if (dist[u] + e.weight < dist[e.toNode]) {
+                dist[e.toNode] = dist[u] + e.weight;
+                queue.push(Entry(dist[e.toNode], e.toNode));
+            }
+        }
+    }
+    return dist[to];
+}
+
+long long dijkstraCsr(const CsrGraph& graph, int from, int to, std::vector<int>& dist) {
+    dist.assign(graph.getNodeCount(), INT_MAX);
+    MinQueue queue;
+    dist[from] = 0;
+    queue.push(Entry(0, from));
+
+    while (!queue.empty()) {
+        Entry top = queue.top();
+        queue.pop();
+        int u = top.second;
+        if (top.first > dist[u])
+            continue;
+        if (u == to)
+            break;
+        const Edge* end = graph.edgesEnd(u);
+        for (const Edge* e = graph.edgesBegin(u); e != end; ++e) {
+            if (dist[u] + e->weight < dist[e->toNode]) {
+                dist[e->toNode] = dist[u] + e->weight;
+                queue.push(Entry(dist[e->toNode], e->toNode));
+            }
+        }
+    }
+    return dist[to];
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int maxNodes = bench::argOr(argc, argv, 1, 1000000);
+    int queries = bench::argOr(argc, argv, 2, 20);
+    const int sides[] = {100, 316, 1000};
+
+    std::printf("=== Graph layout: linked-list vs CSR Dijkstra ===\n");
+    std::printf("%10s %12s %12s %14s %14s %9s\n", "nodes", "build(ms)", "csr(MB)", "list(ms/q)",
+                "csr(ms/q)", "speedup");
+
+    for (int side : sides) {
+        if (side * side > maxNodes)
+            break;
+
+        Graph* graph = bench::makeGridCity(side, 10, 42);
+        bench::Timer timer;
+        CsrGraph csr(*graph);
+        double buildMs = timer.elapsedMs();
+
+        bench::Random rng(7);
+        std::vector<int> dist;
+        double listMs = 0.0, csrMs = 0.0;
+        int mismatches = 0;
+
+        for (int q = 0; q < queries; q++) {
+            int from = rng.range(0, side * side - 1);
+            int to = rng.range(0, side * side - 1);
+
+            timer.reset();
+            long long a = dijkstraList(*graph, from, to, dist);
+            listMs += timer.elapsedMs();
+
+            timer.reset();
+            long long b = dijkstraCsr(csr, from, to, dist);
+            csrMs += timer.elapsedMs();
+
+            if (a != b)
+                mismatches++;
+        }
+
+        std::printf("%10d %12.2f %12.2f %14.3f %14.3f %8.2fx%s\n", side * side, buildMs,
+                    csr.getMemoryUsage() / (1024.0 * 1024.0), listMs / queries, csrMs / queries,
+                    csrMs > 0 ? listMs / csrMs : 0.0, mismatches ? "  MISMATCH" : "");
+        delete graph;
+    }
+    return 0;
+}
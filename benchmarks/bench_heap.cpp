@@ -0,0 +1,212 @@
+/**
+ * @file bench_heap.cpp
+ * @brief Push/pop throughput of the array heap versus the old pointer-based heap.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Usage: bench_heap [maxPushes] [legacyLimit]
+ * The legacy heap costs O(n) per operation, so it only runs up to `legacyLimit` elements.
+ */
+
+#include "bench_common.h"
+#include "data_structures/IndexedPriorityQueue.hpp"
+#include "data_structures/PriorityQueue.hpp"
+
+using namespace project;
+
+namespace {
+
+/**
+ * @brief The previous node-based heap, kept here only as a baseline.
+ *
+ * Each push/pop finds its slot with a level-order BFS over the whole tree.
+ */
+class LegacyHeap {
+private:
+    struct HeapNode {
+        int data;
+        int priority;
+        HeapNode* parent;
+        HeapNode* left;
+        HeapNode* right;
+        HeapNode(int d, int p) : data(d), priority(p), parent(nullptr), left(nullptr), right(nullptr) {}
+    };
+
+    HeapNode* root;
+    int heapSize;
+
+    HeapNode* findLastNode() const {
+        HeapNode** queue = new HeapNode*[heapSize];
+        int front = 0, rear = 0;
+        queue[rear++] = root;
+        HeapNode* last = nullptr;
+        while (front < rear) {
+            last = queue[front++];
+            if (last->left)
+                queue[rear++] = last->left;
+            if (last->right)
+                queue[rear++] = last->right;
+        }
+        delete[] queue;
+        return last;
+    }
+
+    HeapNode* findInsertionParent() const {
+        HeapNode** queue = new HeapNode*[heapSize + 1];
+        int front = 0, rear = 0;
+        queue[rear++] = root;
+        HeapNode* parent = nullptr;
+        while (front < rear) {
+            HeapNode* current = queue[front++];
+            if (current->left == nullptr || current->right == nullptr) {
+                parent = current;
+                break;
+            }
+            queue[rear++] = current->left;
+            queue[rear++] = current->right;
+        }
+        delete[] queue;
+        return parent;
+    }
+
+    static void swapNodes(HeapNode* a, HeapNode* b) {
+        int d = a->data, p = a->priority;
+        a->data = b->data;
+        a->priority = b->priority;
+        b->data = d;
+        b->priority = p;
+    }
+
+    void destroy(HeapNode* node) {
+        if (node == nullptr)
+            return;
+        destroy(node->left);
+        destroy(node->right);
+        delete node;
+    }
+
+public:
+    LegacyHeap() : root(nullptr), heapSize(0) {}
+    ~LegacyHeap() { destroy(root); }
+
+    void push(int value, int priority) {
+        HeapNode* node = new HeapNode(value, priority);
+        if (root == nullptr) {
+            root = node;
+            heapSize = 1;
+            return;
+        }
+        HeapNode* parent = findInsertionParent();
+        node->parent = parent;
+        if (parent->left == nullptr)
+            parent->left = node;
+        else
+            parent->right = node;
+        heapSize++;
+        while (node->parent && node->priority < node->parent->priority) {
+            swapNodes(node, node->parent);
+            node = node->parent;
+        }
+    }
+
+    void pop() {
+        if (heapSize == 1) {
+            delete root;
+            root = nullptr;
+            heapSize = 0;
+            return;
+        }
+        HeapNode* last = findLastNode();
+        root->data = last->data;
+        root->priority = last->priority;
+        if (last->parent->left == last)
+            last->parent->left = nullptr;
+        else
+            last->parent->right = nullptr;
+        delete last;
+        heapSize--;
+        HeapNode* node = root;
+        while (true) {
+            HeapNode* smallest = node;
+            if (node->left && node->left->priority < smallest->priority)
+                smallest = node->left;
+            if (node->right && node->right->priority < smallest->priority)
+                smallest = node->right;
+            if (smallest == node)
+                break;
+            swapNodes(node, smallest);
+            node = smallest;
+        }
+    }
+
+    int top() const { return root->data; }
+    bool isEmpty() const { return root == nullptr; }
+};
+
+template <typename Heap>
+double pushPopAll(Heap& heap, int n, long long& checksum) {
+    bench::Random rng(3);
+    bench::Timer timer;
+    for (int i = 0; i < n; i++) {
+        int p = rng.range(0, 1 << 30);
+        heap.push(i, p);
+    }
+    while (!heap.isEmpty()) {
+        checksum += heap.top();
+        heap.pop();
+    }
+    return timer.elapsedMs();
+}
+
+double indexedWithDecrease(int n, long long& checksum) {
+    bench::Random rng(3);
+    IndexedPriorityQueue<int> heap(n);
+    bench::Timer timer;
+    for (int i = 0; i < n; i++) {
+        heap.push(i, rng.range(1 << 20, 1 << 30));
+    }
+    for (int i = 0; i < n; i += 2) {
+        heap.decreaseKey(i, rng.range(0, 1 << 20));  // Dijkstra-style relaxations
+    }
+    while (!heap.isEmpty()) {
+        checksum += heap.top();
+        heap.pop();
+    }
+    return timer.elapsedMs();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int maxPushes = bench::argOr(argc, argv, 1, 1000000);
+    int legacyLimit = bench::argOr(argc, argv, 2, 20000);
+    const int sizes[] = {1000, 10000, 20000, 100000, 1000000};
+
+    std::printf("=== Heap: n pushes followed by n pops ===\n");
+    std::printf("%10s %14s %14s %14s %16s\n", "n", "legacy(ms)", "array4(ms)", "array2(ms)",
+                "indexed+dk(ms)");
+
+    for (int n : sizes) {
+        if (n > maxPushes)
+            break;
+
+        long long checksum = 0;
+        char legacyText[32];
+        if (n <= legacyLimit) {
+            LegacyHeap legacy;
+            std::snprintf(legacyText, sizeof(legacyText), "%.2f", pushPopAll(legacy, n, checksum));
+        } else {
+            std::snprintf(legacyText, sizeof(legacyText), "skipped");
+        }
+
+        PriorityQueue<int> quad;
+        double quadMs = pushPopAll(quad, n, checksum);
+        PriorityQueue<int, 2> binary;
+        double binaryMs = pushPopAll(binary, n, checksum);
+        double indexedMs = indexedWithDecrease(n, checksum);
+
+        std::printf("%10d %14s %14.2f %14.2f %16.2f   (checksum %lld)\n", n, legacyText, quadMs,
+                    binaryMs, indexedMs, checksum);
+    }
+    return 0;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file bench_horizon.cpp
+ * @brief Rolling-horizon bin selection: distance saved against overflows over a month.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Every configuration runs the full simulation on the same city and bins; the first
+ * row collects every non-empty bin every day, as the simulation does by default.
+ *
+ * Usage: bench_horizon [bins] [days] [side]
+ */
+
+#include <string>
+
+#include "bench_common.h"
+#include "core/Simulation.h"
+
+using namespace project;
+
+namespace {
+
+// Bins 0-60% full, filling 2-20 units a day; the truck holds about a third of them
+void fillCity(Facilities& facilities, int binCount, int nodes, int side) {
+    bench::Random rng(binCount);
+    facilities.addFacility(Facility("DEPOT", "depot", 0, 0, nodes / 2 + side / 2));
+    facilities.addFacility(Facility("D1", "disposal", 0, 0, rng.range(0, nodes - 1)));
+    facilities.addFacility(Facility("D2", "disposal", 0, 0, rng.range(0, nodes - 1)));
+    for (int i = 0; i < binCount; i++) {
+        facilities.addBin(Bin("B" + std::to_string(i), "Grid", 100, rng.range(0, 60),
+                              rng.range(2, 20), rng.range(0, nodes - 1)));
+    }
+    facilities.setTruck(Truck("T1", binCount * 15, 0, facilities.getDepotNode()));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int binCount = bench::argOr(argc, argv, 1, 500);
+    int days = bench::argOr(argc, argv, 2, 30);
+    int side = bench::argOr(argc, argv, 3, 100);
+    int nodes = side * side;
+    const int horizons[] = {-1, 7, 7, 7, 7, 3, 14};
+    const double factors[] = {0.0, 0.0, 0.5, 1.0, 2.0, 1.0, 1.0};
+    const int configCount = 7;
+
+    Graph* graph = bench::makeGridCity(side, 10, 42);
+    std::printf("=== Horizon planning: %d bins, %d days on a %d-node grid ===\n", binCount,
+                days, nodes);
+    std::printf("%8s %8s %10s %8s %9s %12s %9s %9s %8s\n", "horizon", "detour", "distance",
+                "saved", "overflow", "collections", "deferred", "early", "time(s)");
+
+    long long baseline = 0;
+    for (int c = 0; c < configCount; c++) {
+        Facilities facilities;
+        fillCity(facilities, binCount, nodes, side);
+        Simulation sim(*graph, facilities, days);
+        if (horizons[c] >= 0) {
+            HorizonPlanner& horizon = sim.getHorizonPlanner();
+            horizon.setEnabled(true);
+            horizon.setHorizonDays(horizons[c]);
+            horizon.setDetourFactor(factors[c]);
+        }
+
+        bench::Timer timer;
+        sim.run();
+        double seconds = timer.elapsedMs() / 1000.0;
+        if (c == 0)
+            baseline = sim.getTotalDistance();
+
+        if (horizons[c] >= 0) {
+            std::printf("%8d %8.1f", horizons[c], factors[c]);
+        } else {
+            std::printf("%8s %8s", "off", "-");
+        }
+        std::printf(" %10d %7.1f%% %9d %12d %9lld %9d %8.2f\n", sim.getTotalDistance(),
+                    100.0 * (baseline - sim.getTotalDistance()) / baseline,
+                    sim.getOverflowCount(), sim.getCollectionsCompleted(),
+                    sim.getDeferredBinDays(), sim.getEarlyCollections(), seconds);
+    }
+    delete graph;
+    return 0;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file bench_lns.cpp
+ * @brief Anytime LNS: route distance against time budget, compared with local search.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Usage: bench_lns [bins] [side]
+ */
+
+#include <string>
+
+#include "bench_common.h"
+#include "core/DistanceMatrix.h"
+#include "core/LnsPlanner.h"
+#include "core/PlanningState.h"
+#include "core/RouteImprover.h"
+#include "core/RoutePlanner.h"
+
+using namespace project;
+
+int main(int argc, char** argv) {
+    int binCount = bench::argOr(argc, argv, 1, 500);
+    int side = bench::argOr(argc, argv, 2, 100);
+    const double budgets[] = {10.0, 50.0, 200.0, 1000.0};
+    const int capacity = 1500;
+    int nodes = side * side;
+
+    Graph* graph = bench::makeGridCity(side, 10, 42);
+    bench::Random rng(binCount);
+    Facilities facilities;
+    facilities.addFacility(Facility("DEPOT", "depot", 0, 0, nodes / 2 + side / 2));
+    facilities.addFacility(Facility("D1", "disposal", 0, 0, rng.range(0, nodes - 1)));
+    facilities.addFacility(Facility("D2", "disposal", 0, 0, rng.range(0, nodes - 1)));
+    for (int i = 0; i < binCount; i++) {
+        int fill = rng.range(10, 90);
+        facilities.addBin(Bin("B" + std::to_string(i), "Grid", 100, fill, 5,
+                              rng.range(0, nodes - 1)));
+    }
+    facilities.setTruck(Truck("T1", capacity, 0, facilities.getDepotNode()));
+
+    RoutePlanner planner(*graph);
+    int* points = new int[binCount + 3];
+    for (int i = 0; i < binCount; i++) {
+        points[i] = facilities.getBin(i).getNodeId();
+    }
+    points[binCount] = facilities.getDepotNode();
+    int siteCount = 0;
+    int* sites = facilities.getDisposalNodes(siteCount);
+    points[binCount + 1] = sites[0];
+    points[binCount + 2] = sites[1];
+    DistanceMatrix matrix;
+    matrix.build(planner, points, binCount + 3);
+    planner.setDistanceMatrix(&matrix);
+    delete[] points;
+    delete[] sites;
+
+    // Greedy seed, planned on a snapshot as the simulation does
+    Route seed = planner.planRoute(PlanningState(facilities));
+
+    std::printf("=== LNS on %d bins, %d-node grid (truck capacity %d) ===\n", binCount, nodes,
+                capacity);
+    RouteImprover improver(planner, 1000.0);
+    bench::Timer timer;
+    improver.improve(seed, facilities);
+    long long localOnly = improver.getFinalDistance();
+    std::printf("Greedy seed: %lld, local search only: %lld in %.1f ms\n\n",
+                improver.getInitialDistance(), localOnly, timer.elapsedMs());
+
+    std::printf("%10s %10s %10s %10s %8s %10s %10s\n", "budget(ms)", "LNS", "+local", "iters",
+                "iters/s", "new best", "shorter");
+    LnsPlanner lns(planner);
+    for (double budget : budgets) {
+        lns.setTimeBudget(budget);
+        Route best = lns.improve(seed, facilities);
+        improver.improve(best, facilities);
+        long long polished = improver.getFinalDistance();
+        std::printf("%10.0f %10lld %10lld %10lld %8.0f %10d %9.1f%%\n", budget,
+                    lns.getFinalDistance(), polished, lns.getIterations(),
+                    lns.getIterationsPerSecond(), lns.getImprovementCount(),
+                    100.0 * (localOnly - polished) / localOnly);
+    }
+
+    // Best distance over time of the longest run, one line per doubling of the time
+    std::printf("\nBest distance over time (%.0f ms run):\n", budgets[3]);
+    double nextMillis = 0.0;
+    for (int i = 0; i < lns.getTraceLength(); i++) {
+        bool last = i == lns.getTraceLength() - 1;
+        if (lns.getTraceMillis(i) >= nextMillis || last) {
+            std::printf("  %8.1f ms %10lld\n", lns.getTraceMillis(i), lns.getTraceDistance(i));
+            while (nextMillis <= lns.getTraceMillis(i)) {
+                nextMillis = nextMillis > 0 ? nextMillis * 2 : 1.0;
+            }
+        }
+    }
+    std::printf("Removal operators (calls / new best): random %lld/%d, worst %lld/%d, "
+                "related %lld/%d\n",
+                lns.getRemovalCalls(LnsPlanner::Removal::Random),
+                lns.getRemovalImprovements(LnsPlanner::Removal::Random),
+                lns.getRemovalCalls(LnsPlanner::Removal::Worst),
+                lns.getRemovalImprovements(LnsPlanner::Removal::Worst),
+                lns.getRemovalCalls(LnsPlanner::Removal::Related),
+                lns.getRemovalImprovements(LnsPlanner::Removal::Related));
+
+    delete graph;
+    return 0;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file bench_multistart.cpp
+ * @brief Multi-start randomized greedy: wall time against threads, distance against starts.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Usage: bench_multistart [bins] [starts] [side]
+ */
+
+#include <string>
+
+#include "bench_common.h"
+#include "core/DistanceMatrix.h"
+#include "core/MultiStartPlanner.h"
+#include "core/PlanningState.h"
+#include "core/RoutePlanner.h"
+
+using namespace project;
+
+int main(int argc, char** argv) {
+    int binCount = bench::argOr(argc, argv, 1, 500);
+    int starts = bench::argOr(argc, argv, 2, 64);
+    int side = bench::argOr(argc, argv, 3, 100);
+    const int threadCounts[] = {1, 2, 4, 8, 16, 32, 64};
+    const int startCounts[] = {1, 2, 4, 8, 16, 32, 64, 128};
+    int nodes = side * side;
+
+    Graph* graph = bench::makeGridCity(side, 10, 42);
+    bench::Random rng(binCount);
+    Facilities facilities;
+    facilities.addFacility(Facility("DEPOT", "depot", 0, 0, nodes / 2 + side / 2));
+    facilities.addFacility(Facility("D1", "disposal", 0, 0, rng.range(0, nodes - 1)));
+    facilities.addFacility(Facility("D2", "disposal", 0, 0, rng.range(0, nodes - 1)));
+    for (int i = 0; i < binCount; i++) {
+        facilities.addBin(Bin("B" + std::to_string(i), "Grid", 100, rng.range(10, 90), 5,
+                              rng.range(0, nodes - 1)));
+    }
+    facilities.setTruck(Truck("T1", 2000, 0, facilities.getDepotNode()));
+
+    RoutePlanner planner(*graph);
+    int* points = new int[binCount + 3];
+    for (int i = 0; i < binCount; i++) {
+        points[i] = facilities.getBin(i).getNodeId();
+    }
+    points[binCount] = facilities.getDepotNode();
+    int siteCount = 0;
+    int* sites = facilities.getDisposalNodes(siteCount);
+    points[binCount + 1] = sites[0];
+    points[binCount + 2] = sites[1];
+    DistanceMatrix matrix;
+    matrix.build(planner, points, binCount + 3);
+    planner.setDistanceMatrix(&matrix);
+    delete[] points;
+    delete[] sites;
+    PlanningState state(facilities);
+
+    // Aynı tohum: her iş parçacığı sayısında aynı rota çıkmalı
+    std::printf("=== Multi-start greedy: %d bins, %d starts (%d hardware threads) ===\n",
+                binCount, starts, ThreadPool::hardwareThreads());
+    std::printf("%8s %10s %10s %10s %12s %8s\n", "threads", "plan(ms)", "speedup", "per start",
+                "distance", "best #");
+    double baseline = 0.0;
+    for (int threads : threadCounts) {
+        MultiStartPlanner multiStart(planner, starts, threads);
+        multiStart.plan(state);  // iş parçacıkları ve tablolar ısınsın
+        multiStart.plan(state);
+        if (threads == 1)
+            baseline = multiStart.getLastMillis();
+        std::printf("%8d %10.1f %9.2fx %10.2f %12lld %8d\n", threads,
+                    multiStart.getLastMillis(), baseline / multiStart.getLastMillis(),
+                    multiStart.getLastMillis() / starts, multiStart.getBestDistance(),
+                    multiStart.getBestStart());
+    }
+
+    std::printf("\n%8s %12s %12s %10s\n", "starts", "greedy", "best", "saved");
+    MultiStartPlanner multiStart(planner, 1);
+    for (int count : startCounts) {
+        multiStart.setStarts(count);
+        multiStart.plan(state);
+        std::printf("%8d %12lld %12lld %9.1f%%\n", count, multiStart.getGreedyDistance(),
+                    multiStart.getBestDistance(),
+                    100.0 * (multiStart.getGreedyDistance() - multiStart.getBestDistance()) /
+                        multiStart.getGreedyDistance());
+    }
+
+    delete graph;
+    return 0;
+}
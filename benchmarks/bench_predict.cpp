@@ -0,0 +1,125 @@
+/**
+ * @file bench_predict.cpp
+ * @brief Overflow prediction per bin vs the batch kernel (scalar and AVX2).
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Per bin, the planners ask for days to overflow, the risk score and the critical flag;
+ * each call recomputes the average fill rate. The batch API answers all three for every
+ * bin in one pass.
+ *
+ * Usage: bench_predict [bins] [repeats]
+ */
+
+#include <string>
+
+#include "bench_common.h"
+#include "core/OverflowPredictor.h"
+
+using namespace project;
+
+namespace {
+
+void row(const char* name, double ms, int repeats, int bins, double baseline) {
+    double perPass = ms / repeats;
+    std::printf("%-24s %10.2f %10.2f %9.2fx\n", name, perPass, perPass * 1e6 / bins,
+                baseline / perPass);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int binCount = bench::argOr(argc, argv, 1, 1000000);
+    int repeats = bench::argOr(argc, argv, 2, 10);
+
+    // Doluluk %0-100, bir kısmı taşmış, bir kısmının hızı ve geçmişi yok
+    bench::Random rng(5);
+    Bin* bins = new Bin[binCount];
+    for (int i = 0; i < binCount; i++) {
+        int capacity = rng.range(100, 400);
+        int rate = rng.range(0, 9) == 0 ? 0 : rng.range(1, 30);
+        bins[i] = Bin("B" + std::to_string(i), "Region", capacity, rng.range(0, capacity), rate,
+                      i);
+        int history = rng.range(0, 7);
+        for (int d = 0; d < history; d++) {
+            bins[i].recordFillLevel(rng.range(0, capacity));
+        }
+    }
+
+    int* days = new int[binCount];
+    double* risks = new double[binCount];
+    bool* critical = new bool[binCount];
+    int* expectedDays = new int[binCount];
+    OverflowPredictor predictor;
+
+    std::printf("=== Overflow prediction for %d bins (AVX2 %s), ms per pass ===\n", binCount,
+                cpuHasAvx2() ? "available" : "not available");
+    std::printf("%-24s %10s %10s %10s\n", "method", "ms", "ns/bin", "speedup");
+
+    // Planlayıcıların bugünkü hali: bin başına üç çağrı, her biri ortalamayı yeniden toplar
+    long long sink = 0;
+    bench::Timer perBinTimer;
+    for (int r = 0; r < repeats; r++) {
+        for (int i = 0; i < binCount; i++) {
+            expectedDays[i] = predictor.predictDaysToOverflow(bins[i]);
+            sink += static_cast<long long>(predictor.getOverflowRisk(bins[i]));
+            sink += predictor.isCritical(bins[i]);
+        }
+    }
+    double perBinMs = perBinTimer.elapsedMs();
+    double baseline = perBinMs / repeats;
+    row("per-bin calls", perBinMs, repeats, binCount, baseline);
+
+    bool same = true;
+    for (SimdKernel kernel : {SimdKernel::Scalar, SimdKernel::Avx2}) {
+        predictor.setKernel(kernel);
+        const char* name = predictor.getKernel() == SimdKernel::Avx2 ? "batch from Bin, AVX2"
+                                                                     : "batch from Bin, scalar";
+        bench::Timer batchTimer;
+        for (int r = 0; r < repeats; r++) {
+            predictor.predictBatch(bins, binCount, days, risks, critical);
+        }
+        row(name, batchTimer.elapsedMs(), repeats, binCount, baseline);
+        for (int i = 0; i < binCount && same; i++) {
+            same = days[i] == expectedDays[i];
+        }
+    }
+
+    // Sütunlar hazırsa (ör. BinStore yanında tutulan ortalamalar) yalnızca çekirdek kalır
+    int* capacities = new int[binCount];
+    int* fills = new int[binCount];
+    int* fillRates = new int[binCount];
+    double* averages = new double[binCount];
+    for (int i = 0; i < binCount; i++) {
+        capacities[i] = bins[i].getCapacity();
+        fills[i] = bins[i].getCurrentFill();
+        fillRates[i] = bins[i].getFillRate();
+        averages[i] = bins[i].getAverageFillRate();
+    }
+    for (SimdKernel kernel : {SimdKernel::Scalar, SimdKernel::Avx2}) {
+        predictor.setKernel(kernel);
+        const char* name = predictor.getKernel() == SimdKernel::Avx2 ? "column kernel, AVX2"
+                                                                     : "column kernel, scalar";
+        bench::Timer kernelTimer;
+        for (int r = 0; r < repeats; r++) {
+            predictor.predictBatch(capacities, fills, averages, fillRates, binCount, days, risks,
+                                   critical);
+        }
+        row(name, kernelTimer.elapsedMs(), repeats, binCount, baseline);
+        for (int i = 0; i < binCount && same; i++) {
+            same = days[i] == expectedDays[i];
+        }
+    }
+    std::printf("\nSame days to overflow: %s (checksum %lld)\n", same ? "yes" : "NO", sink);
+
+    delete[] bins;
+    delete[] days;
+    delete[] risks;
+    delete[] critical;
+    delete[] expectedDays;
+    delete[] capacities;
+    delete[] fills;
+    delete[] fillRates;
+    delete[] averages;
+    return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file bench_route_improver.cpp
+ * @brief Greedy route distance before and after 2-opt / Or-opt / relocate local search.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Usage: bench_route_improver [side] [budgetMs]
+ */
+
+#include <string>
+
+#include "bench_common.h"
+#include "core/DistanceMatrix.h"
+#include "core/RouteImprover.h"
+#include "core/RoutePlanner.h"
+
+using namespace project;
+
+int main(int argc, char** argv) {
+    int side = bench::argOr(argc, argv, 1, 100);
+    int budgetMs = bench::argOr(argc, argv, 2, 50);
+    const int binCounts[] = {50, 200, 1000, 2000};
+    int nodes = side * side;
+
+    Graph* graph = bench::makeGridCity(side, 10, 42);
+    std::printf("=== Route local search on a %d-node grid (budget %d ms) ===\n", nodes, budgetMs);
+    std::printf("%8s %8s %12s %12s %9s %8s %8s %8s %10s\n", "bins", "trips", "greedy",
+                "improved", "saved", "2-opt", "or-opt", "reloc", "time(ms)");
+
+    for (int binCount : binCounts) {
+        bench::Random rng(binCount);
+        Facilities facilities;
+        facilities.addFacility(Facility("DEPOT", "depot", 0, 0, nodes / 2 + side / 2));
+        facilities.addFacility(Facility("D1", "disposal", 0, 0, rng.range(0, nodes - 1)));
+        facilities.addFacility(Facility("D2", "disposal", 0, 0, rng.range(0, nodes - 1)));
+        for (int i = 0; i < binCount; i++) {
+            facilities.addBin(Bin("B" + std::to_string(i), "Grid", 100, rng.range(10, 90), 5,
+                                  rng.range(0, nodes - 1)));
+        }
+        facilities.setTruck(Truck("T1", 2000, 0, facilities.getDepotNode()));
+
+        // Matrix over every stop, as the simulation builds it
+        RoutePlanner planner(*graph);
+        int* points = new int[binCount + 3];
+        for (int i = 0; i < binCount; i++) {
+            points[i] = facilities.getBin(i).getNodeId();
+        }
+        points[binCount] = facilities.getDepotNode();
+        int siteCount = 0;
+        int* sites = facilities.getDisposalNodes(siteCount);
+        points[binCount + 1] = sites[0];
+        points[binCount + 2] = sites[1];
+        DistanceMatrix matrix;
+        matrix.build(planner, points, binCount + 3);
+        planner.setDistanceMatrix(&matrix);
+
+        // planRoute empties the bins; restore them so the improver sees real fills
+        int* fills = new int[binCount];
+        for (int i = 0; i < binCount; i++) {
+            fills[i] = facilities.getBin(i).getCurrentFill();
+        }
+        Route greedy = planner.planRoute(facilities);
+        for (int i = 0; i < binCount; i++) {
+            facilities.getBin(i).setCurrentFill(fills[i]);
+        }
+        facilities.getTruck().setCurrentLoad(0);
+        facilities.getTruck().moveTo(facilities.getDepotNode());
+
+        RouteImprover improver(planner, budgetMs);
+        Route improved = improver.improve(greedy, facilities);
+        int trips = 1;
+        for (int i = 0; i < improved.getLength(); i++) {
+            if (improved.isDisposalAt(i))
+                trips++;
+        }
+
+        long long before = improver.getInitialDistance();
+        long long after = improver.getFinalDistance();
+        std::printf("%8d %8d %12lld %12lld %8.1f%% %8d %8d %8d %10.2f\n", binCount, trips, before,
+                    after, before > 0 ? 100.0 * (before - after) / before : 0.0,
+                    improver.getTwoOptMoves(), improver.getOrOptMoves(),
+                    improver.getRelocateMoves(), improver.getLastMillis());
+
+        delete[] points;
+        delete[] sites;
+        delete[] fills;
+    }
+    delete graph;
+    return 0;
+}
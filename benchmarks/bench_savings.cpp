@@ -0,0 +1,140 @@
+/**
+ * @file bench_savings.cpp
+ * @brief Clarke-Wright savings planner vs the greedy planner on 1k-20k bins.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Usage: bench_savings [side] [maxGreedyBins]
+ */
+
+#include <climits>
+#include <string>
+
+#include "bench_common.h"
+#include "core/DistanceMatrix.h"
+#include "core/RoutePlanner.h"
+#include "core/SavingsPlanner.h"
+
+using namespace project;
+
+namespace {
+
+// Drives a route from the depot and back, unloading at the nearest site when the next bin
+// would not fit (what the greedy planner assumes) or at the route's own disposal stops
+long long drivenDistance(const RoutePlanner& planner, Facilities& facilities, const Route& route,
+                         const int* fills, int capacity) {
+    long long total = 0;
+    int at = facilities.getDepotNode();
+    int load = 0;
+    auto drive = [&](int to) {
+        int d = planner.computeDistance(at, to);
+        if (d != INT_MAX)
+            total += d;
+        at = to;
+    };
+
+    for (int i = 0; i < route.getLength(); i++) {
+        if (route.isDisposalAt(i)) {
+            drive(route.getDisposalNodeAt(i));
+            load = 0;
+            continue;
+        }
+        int bin = route.getBinAt(i);
+        if (load > 0 && load + fills[bin] > capacity) {
+            int site = planner.findNearestDisposal(at, facilities);
+            if (site != -1) {
+                drive(site);
+                load = 0;
+            }
+        }
+        drive(facilities.getBin(bin).getNodeId());
+        load += fills[bin];
+    }
+    drive(facilities.getDepotNode());
+    return total;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int side = bench::argOr(argc, argv, 1, 100);
+    int maxGreedyBins = bench::argOr(argc, argv, 2, 5000);
+    const int binCounts[] = {1000, 5000, 20000};
+    const int capacity = 2000;
+    int nodes = side * side;
+
+    Graph* graph = bench::makeGridCity(side, 10, 42);
+    std::printf("=== Savings vs greedy planning on a %d-node grid (truck capacity %d) ===\n",
+                nodes, capacity);
+    std::printf("%8s %12s %10s %12s %10s %8s %8s %8s\n", "bins", "greedy", "time(ms)", "savings",
+                "time(ms)", "shorter", "trips", "merges");
+
+    for (int binCount : binCounts) {
+        bench::Random rng(binCount);
+        Facilities facilities;
+        facilities.addFacility(Facility("DEPOT", "depot", 0, 0, nodes / 2 + side / 2));
+        facilities.addFacility(Facility("D1", "disposal", 0, 0, rng.range(0, nodes - 1)));
+        facilities.addFacility(Facility("D2", "disposal", 0, 0, rng.range(0, nodes - 1)));
+        int* fills = new int[binCount];
+        for (int i = 0; i < binCount; i++) {
+            fills[i] = rng.range(10, 90);
+            facilities.addBin(Bin("B" + std::to_string(i), "Grid", 100, fills[i], 5,
+                                  rng.range(0, nodes - 1)));
+        }
+        facilities.setTruck(Truck("T1", capacity, 0, facilities.getDepotNode()));
+        auto restore = [&]() {
+            for (int i = 0; i < binCount; i++) {
+                facilities.getBin(i).setCurrentFill(fills[i]);
+            }
+            facilities.getTruck().setCurrentLoad(0);
+            facilities.getTruck().moveTo(facilities.getDepotNode());
+        };
+
+        RoutePlanner planner(*graph);
+
+        // Greedy needs a distance matrix to finish in reasonable time; n^2 cells limit its size
+        long long greedyDistance = -1;
+        double greedyMillis = 0.0;
+        DistanceMatrix matrix;
+        if (binCount <= maxGreedyBins) {
+            int* points = new int[binCount + 3];
+            for (int i = 0; i < binCount; i++) {
+                points[i] = facilities.getBin(i).getNodeId();
+            }
+            points[binCount] = facilities.getDepotNode();
+            int siteCount = 0;
+            int* sites = facilities.getDisposalNodes(siteCount);
+            points[binCount + 1] = sites[0];
+            points[binCount + 2] = sites[1];
+            matrix.build(planner, points, binCount + 3);
+            planner.setDistanceMatrix(&matrix);
+            delete[] points;
+            delete[] sites;
+
+            bench::Timer timer;
+            Route greedy = planner.planRoute(facilities);
+            greedyMillis = timer.elapsedMs();
+            restore();
+            greedyDistance = drivenDistance(planner, facilities, greedy, fills, capacity);
+        }
+
+        SavingsPlanner savings(planner);
+        Route route = savings.plan(facilities);
+        restore();
+        long long savingsDistance = drivenDistance(planner, facilities, route, fills, capacity);
+
+        if (greedyDistance >= 0) {
+            std::printf("%8d %12lld %10.1f %12lld %10.1f %7.1f%% %8d %8d\n", binCount,
+                        greedyDistance, greedyMillis, savingsDistance, savings.getLastMillis(),
+                        100.0 * (greedyDistance - savingsDistance) / greedyDistance,
+                        savings.getTripCount(), savings.getMergeCount());
+        } else {
+            std::printf("%8d %12s %10s %12lld %10.1f %8s %8d %8d\n", binCount, "-", "-",
+                        savingsDistance, savings.getLastMillis(), "-", savings.getTripCount(),
+                        savings.getMergeCount());
+        }
+        delete[] fills;
+    }
+    delete graph;
+    return 0;
+}
@@ -0,0 +1,206 @@
+/**
+ * @file bench_scoring.cpp
+ * @brief Scoring policies as template parameters vs virtual calls.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * Part 1 picks the best of a day's (risk, distance) candidates, the inner loop of
+ * `selectNextBin`, over and over until millions are scored, with the policy inlined
+ * and through a virtual interface. The block fits in cache, as in the planner. Part 2
+ * plans greedy routes with the same policies wrapped either way.
+ *
+ * Usage: bench_scoring [millions scored] [bins] [side]
+ */
+
+#include <climits>
+#include <string>
+
+#include "bench_common.h"
+#include "core/DistanceMatrix.h"
+#include "core/PlanningState.h"
+#include "core/RoutePlanner.h"
+#include "core/ScoringPolicy.h"
+
+using namespace project;
+
+namespace {
+
+// What a planner with runtime-pluggable scoring would call per candidate
+class Scorer {
+public:
+    virtual ~Scorer() = default;
+    virtual double score(double risk, int distance) const = 0;
+};
+
+template <class Policy>
+class PolicyScorer : public Scorer {
+public:
+    explicit PolicyScorer(const Policy& policy) : policy(policy) {}
+    double score(double risk, int distance) const override { return policy(risk, distance); }
+
+private:
+    Policy policy;
+};
+
+// Policy wrapper that forwards every score through the virtual interface
+struct VirtualScoring {
+    const Scorer* scorer;
+    double operator()(double risk, int distance) const { return scorer->score(risk, distance); }
+};
+
+template <class Policy>
+int bestInlined(const Policy& score, const double* risks, const int* distances, int count) {
+    double bestScore = INT_MAX;
+    int best = -1;
+    for (int k = 0; k < count; k++) {
+        double s = score(risks[k], distances[k]);
+        if (s < bestScore) {
+            bestScore = s;
+            best = k;
+        }
+    }
+    return best;
+}
+
+int bestVirtual(const Scorer& scorer, const double* risks, const int* distances, int count) {
+    double bestScore = INT_MAX;
+    int best = -1;
+    for (int k = 0; k < count; k++) {
+        double s = scorer.score(risks[k], distances[k]);
+        if (s < bestScore) {
+            bestScore = s;
+            best = k;
+        }
+    }
+    return best;
+}
+
+template <class Policy>
+void candidateRow(const char* name, const Policy& policy, const Scorer& scorer,
+                  const double* risks, const int* distances, int block, int rounds) {
+    long long inlinedSum = 0;  // seçimler kullanılsın ki döngü elenmesin
+    bench::Timer inlinedTimer;
+    for (int r = 0; r < rounds; r++) {
+        inlinedSum += bestInlined(policy, risks, distances, block - r % 8);
+    }
+    double inlinedMs = inlinedTimer.elapsedMs();
+
+    long long virtualSum = 0;
+    bench::Timer virtualTimer;
+    for (int r = 0; r < rounds; r++) {
+        virtualSum += bestVirtual(scorer, risks, distances, block - r % 8);
+    }
+    double virtualMs = virtualTimer.elapsedMs();
+
+    double scored = static_cast<double>(block) * rounds;
+    std::printf("%-14s %14.2f %14.2f %9.2fx %8s\n", name, inlinedMs * 1e6 / scored,
+                virtualMs * 1e6 / scored, virtualMs / inlinedMs,
+                inlinedSum == virtualSum ? "yes" : "NO");
+}
+
+bool sameRoute(const Route& a, const Route& b) {
+    if (a.getLength() != b.getLength())
+        return false;
+    for (int i = 0; i < a.getLength(); i++) {
+        if (a.getBinAt(i) != b.getBinAt(i))
+            return false;
+    }
+    return true;
+}
+
+template <class Policy>
+void routeRow(const char* name, RoutePlanner& planner, const PlanningState& state,
+              const Policy& policy, const Scorer& scorer) {
+    long long before = planner.getCandidatesScored();
+    bench::Timer inlinedTimer;
+    Route inlined = planner.planRoute(state, policy);
+    double inlinedMs = inlinedTimer.elapsedMs();
+    long long scored = planner.getCandidatesScored() - before;
+
+    bench::Timer virtualTimer;
+    Route viaVirtual = planner.planRoute(state, VirtualScoring{&scorer});
+    double virtualMs = virtualTimer.elapsedMs();
+
+    std::printf("%-14s %12lld %12.1f %12.1f %9.2fx %8s\n", name, scored, inlinedMs, virtualMs,
+                virtualMs / inlinedMs, sameRoute(inlined, viaVirtual) ? "yes" : "NO");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int millions = bench::argOr(argc, argv, 1, 50);
+    int binCount = bench::argOr(argc, argv, 2, 2000);
+    int side = bench::argOr(argc, argv, 3, 100);
+    const int block = 2048;  // bins considered in one selectNextBin call
+    int rounds = static_cast<int>(millions * 1000000LL / block);
+
+    // Risk 0-30 days, distances 0-20000 and a few unreachable bins
+    bench::Random rng(7);
+    double* risks = new double[block];
+    int* distances = new int[block];
+    for (int k = 0; k < block; k++) {
+        risks[k] = rng.range(0, 30);
+        distances[k] = rng.range(0, 99) == 0 ? INT_MAX : rng.range(0, 20000);
+    }
+
+    RiskFirstScoring riskFirst;
+    NearestFirstScoring nearestFirst;
+    WeightedScoring weighted(50.0);
+    PolicyScorer<RiskFirstScoring> riskFirstScorer(riskFirst);
+    PolicyScorer<NearestFirstScoring> nearestFirstScorer(nearestFirst);
+    PolicyScorer<WeightedScoring> weightedScorer(weighted);
+
+    // Chosen through a table at run time so the compiler cannot resolve the virtual calls
+    const Scorer* scorers[] = {&riskFirstScorer, &nearestFirstScorer, &weightedScorer};
+    int shift = argc > 4 ? 1 : 0;  // always 0, but unknown at compile time
+    const Scorer& riskFirstVirtual = *scorers[shift % 3];
+    const Scorer& nearestFirstVirtual = *scorers[(shift + 1) % 3];
+    const Scorer& weightedVirtual = *scorers[(shift + 2) % 3];
+
+    std::printf("=== Best of %d candidates, %d million scored (ns per candidate) ===\n", block,
+                millions);
+    std::printf("%-14s %14s %14s %10s %8s\n", "policy", "template", "virtual", "slowdown",
+                "same");
+    candidateRow("risk-first", riskFirst, riskFirstVirtual, risks, distances, block, rounds);
+    candidateRow("nearest-first", nearestFirst, nearestFirstVirtual, risks, distances, block,
+                 rounds);
+    candidateRow("weighted", weighted, weightedVirtual, risks, distances, block, rounds);
+    delete[] risks;
+    delete[] distances;
+
+    // Greedy planning on a grid city; the matrix keeps the search out of the timing
+    int nodes = side * side;
+    Graph* graph = bench::makeGridCity(side, 10, 42);
+    bench::Random cityRng(binCount);
+    Facilities facilities;
+    facilities.addFacility(Facility("DEPOT", "depot", 0, 0, nodes / 2 + side / 2));
+    facilities.addFacility(Facility("D1", "disposal", 0, 0, cityRng.range(0, nodes - 1)));
+    for (int i = 0; i < binCount; i++) {
+        facilities.addBin(Bin("B" + std::to_string(i), "Grid", 100, cityRng.range(10, 90),
+                              cityRng.range(1, 10), cityRng.range(0, nodes - 1)));
+    }
+    facilities.setTruck(Truck("T1", 20000, 0, facilities.getDepotNode()));
+    PlanningState state(facilities);
+
+    RoutePlanner planner(*graph);
+    int* points = new int[binCount + 2];
+    for (int i = 0; i < binCount; i++) {
+        points[i] = facilities.getBin(i).getNodeId();
+    }
+    points[binCount] = facilities.getDepotNode();
+    points[binCount + 1] = facilities.getFacility(1).getNodeId();
+    DistanceMatrix matrix;
+    matrix.build(planner, points, binCount + 2);
+    planner.setDistanceMatrix(&matrix);
+    delete[] points;
+
+    std::printf("\n=== Greedy route over %d bins on a %d-node grid ===\n", binCount, nodes);
+    std::printf("%-14s %12s %12s %12s %10s %8s\n", "policy", "scored", "template(ms)",
+                "virtual(ms)", "slowdown", "same");
+    routeRow("risk-first", planner, state, riskFirst, riskFirstVirtual);
+    routeRow("nearest-first", planner, state, nearestFirst, nearestFirstVirtual);
+    routeRow("weighted", planner, state, weighted, weightedVirtual);
+
+    delete graph;
+    return 0;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file bench_split.cpp
+ * @brief Giant tour + optimal split vs greedy and savings on capacity-bound days.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * A scaled-up test_capacity.json: bins are 50-95% full and the truck holds only a few
+ * of them, so most of the day is spent driving to and from disposal sites.
+ *
+ * Usage: bench_split [side] [maxGreedyBins]
+ */
+
+#include <climits>
+#include <string>
+
+#include "bench_common.h"
+#include "core/DistanceMatrix.h"
+#include "core/NearestDisposalField.h"
+#include "core/PlanningState.h"
+#include "core/RoutePlanner.h"
+#include "core/SavingsPlanner.h"
+#include "core/SplitPlanner.h"
+
+using namespace project;
+
+namespace {
+
+// Drives a route from the depot and back, unloading at the nearest site when the next bin
+// would not fit (what the greedy planner assumes) or at the route's own disposal stops
+long long drivenDistance(const RoutePlanner& planner, const PlanningState& state,
+                         const Route& route, bool keepStops) {
+    long long total = 0;
+    int at = state.getDepotNode();
+    int load = 0;
+    int capacity = state.getTruckCapacity();
+    auto drive = [&](int to) {
+        int d = planner.computeDistance(at, to);
+        if (d != INT_MAX)
+            total += d;
+        at = to;
+    };
+
+    for (int i = 0; i < route.getLength(); i++) {
+        if (route.isDisposalAt(i)) {
+            if (keepStops) {
+                drive(route.getDisposalNodeAt(i));
+                load = 0;
+            }
+            continue;
+        }
+        int bin = route.getBinAt(i);
+        if (load > 0 && load + state.getFill(bin) > capacity) {
+            int site = planner.findNearestDisposal(at, state);
+            if (site != -1) {
+                drive(site);
+                load = 0;
+            }
+        }
+        drive(state.getNode(bin));
+        load += state.getFill(bin);
+    }
+    drive(state.getDepotNode());
+    return total;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int side = bench::argOr(argc, argv, 1, 100);
+    int maxGreedyBins = bench::argOr(argc, argv, 2, 5000);
+    const int binCounts[] = {500, 2000, 5000, 20000};
+    const int capacity = 500;
+    int nodes = side * side;
+
+    Graph* graph = bench::makeGridCity(side, 10, 42);
+    std::printf("=== Giant tour + split on a %d-node grid (bins 125-238 of 250, truck %d) ===\n",
+                nodes, capacity);
+    std::printf("%8s %10s %10s %12s %10s %10s %8s %8s\n", "bins", "greedy", "savings",
+                "tour+naive", "split", "time(ms)", "trips", "saved");
+
+    for (int binCount : binCounts) {
+        bench::Random rng(binCount);
+        Facilities facilities;
+        facilities.addFacility(Facility("DEPOT", "depot", 0, 0, nodes / 2 + side / 2));
+        for (int d = 0; d < 4; d++) {
+            facilities.addFacility(Facility("D" + std::to_string(d + 1), "disposal", 0, 0,
+                                            rng.range(0, nodes - 1)));
+        }
+        for (int i = 0; i < binCount; i++) {
+            facilities.addBin(Bin("B" + std::to_string(i), "Grid", 250, rng.range(125, 238), 5,
+                                  rng.range(0, nodes - 1)));
+        }
+        facilities.setTruck(Truck("T1", capacity, 0, facilities.getDepotNode()));
+        PlanningState state(facilities);
+
+        int siteCount = 0;
+        int* sites = facilities.getDisposalNodes(siteCount);
+        RoutePlanner planner(*graph);
+        NearestDisposalField field(planner.getNetwork());
+        field.build(sites, siteCount);
+        planner.setDisposalField(&field);
+
+        // Greedy needs a distance matrix to finish in reasonable time; n^2 cells limit its size
+        long long greedyDistance = -1;
+        DistanceMatrix matrix;
+        if (binCount <= maxGreedyBins) {
+            int* points = new int[binCount + 1 + siteCount];
+            for (int i = 0; i < binCount; i++) {
+                points[i] = facilities.getBin(i).getNodeId();
+            }
+            points[binCount] = facilities.getDepotNode();
+            for (int s = 0; s < siteCount; s++) {
+                points[binCount + 1 + s] = sites[s];
+            }
+            matrix.build(planner, points, binCount + 1 + siteCount);
+            planner.setDistanceMatrix(&matrix);
+            delete[] points;
+
+            Route greedy = planner.planRoute(state);
+            greedyDistance = drivenDistance(planner, state, greedy, true);
+        }
+
+        SavingsPlanner savings(planner);
+        long long savingsDistance = drivenDistance(planner, state, savings.plan(state), true);
+
+        SplitPlanner split(planner);
+        Route route = split.plan(state);
+        long long splitDistance = drivenDistance(planner, state, route, true);
+        long long naiveDistance = drivenDistance(planner, state, route, false);  // same tour
+
+        if (greedyDistance >= 0) {
+            std::printf("%8d %10lld %10lld %12lld %10lld %10.1f %8d %7.1f%%\n", binCount,
+                        greedyDistance, savingsDistance, naiveDistance, splitDistance,
+                        split.getLastMillis(), split.getTripCount(),
+                        100.0 * (greedyDistance - splitDistance) / greedyDistance);
+        } else {
+            std::printf("%8d %10s %10lld %12lld %10lld %10.1f %8d %8s\n", binCount, "-",
+                        savingsDistance, naiveDistance, splitDistance, split.getLastMillis(),
+                        split.getTripCount(), "-");
+        }
+        delete[] sites;
+    }
+    delete graph;
+    return 0;
+}
@@ -451,14 +451,16 @@ void UIManager::drawBinDetail() {
     
     // Draw fill history as a list with bars
     const int* history = bin.getFillHistory();
+    int window = bin.getHistoryDays();
     int capacity = bin.getCapacity();
     int currentDay = simulation.getTime();
     
     // Note: Initial state (Day 0) is now recorded in constructor
-    // Day 0 → history[0], Day 1 → history[1], etc. (with circular wraparound after 7 days)
+    // Day 0 → history[0], Day 1 → history[1], etc. (with circular wraparound after `window` days)
     
-    // Calculate which days to show (last 7 or fewer)
-    int startDay = (currentDay >= 6) ? currentDay - 6 : 0;
+    // Calculate which days to show (last 7 or fewer, never more than the window holds)
+    int shown = window < 7 ? window : 7;
+    int startDay = (currentDay >= shown - 1) ? currentDay - (shown - 1) : 0;
     int endDay = currentDay;
     
     for (int i = 0; i < 7; i++) {
@@ -466,8 +468,8 @@ void UIManager::drawBinDetail() {
         int simDay = startDay + i;
         
         if (simDay <= endDay) {
-            // Day N's data is at history index N % 7
-            int actualIdx = simDay % 7;
+            // Day N's data is at history index N % window
+            int actualIdx = simDay % window;
             int fillValue = history[actualIdx];
             
             // Draw day label and value
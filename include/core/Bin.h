@@ -12,8 +12,17 @@ namespace project {
 
 /**
  * @brief Garbage bin with capacity, current fill level, and a daily fill rate.
+ *
+ * The last `getHistoryDays()` recorded fill levels are kept in a ring. Recording a
+ * level also updates running aggregates (sum of the levels, sum and sum of squares
+ * of the day-to-day changes inside the window), so every statistic is read in O(1)
+ * whatever the window length. Windows up to DEFAULT_HISTORY_DAYS live inside the
+ * object; longer ones are allocated.
  */
 class Bin {
+public:
+    static const int DEFAULT_HISTORY_DAYS = 7;  ///< History window of a new bin
+
 private:
     std::string id;
     std::string location;
@@ -22,8 +31,17 @@ private:
     int initialFill;  // Store initial fill permanently
     int fillRate;
     int nodeId;
-    int fillHistory[7];  // Last 7 days of fill data
-    int historyIndex;
+    int inlineHistory[DEFAULT_HISTORY_DAYS];  // ring storage for short windows
+    int* fillHistory;         // Last `historyDays` fill levels (inlineHistory or owned)
+    int historyDays;
+    int historyIndex;         // slot the next level is written to
+    int recordedDays;         // levels recorded so far, at most historyDays
+    long long historySum;     // sum of the ring (unrecorded slots are 0)
+    long long changeSum;      // sum of day-to-day changes between recorded levels
+    long long changeSquares;  // sum of their squares
+
+    void allocateHistory(int days);
+    void copyHistory(const Bin& other);
 
 public:
     /**
@@ -34,15 +52,31 @@ public:
      * @param currentFill Initial fill level.
      * @param fillRate Daily fill rate (units/day).
      * @param nodeId Graph node index where the bin is located.
+     * @param historyDays Fill levels kept for prediction (at least 1).
      */
     Bin(const std::string& id, const std::string& location, int capacity, int currentFill,
-        int fillRate, int nodeId);
+        int fillRate, int nodeId, int historyDays = DEFAULT_HISTORY_DAYS);
 
     /**
      * @brief Default constructor (needed for array allocation).
      */
     Bin();
 
+    /**
+     * @brief Copy constructor (deep copy of a long history).
+     */
+    Bin(const Bin& other);
+
+    /**
+     * @brief Assignment operator.
+     */
+    Bin& operator=(const Bin& other);
+
+    /**
+     * @brief Destructor to free a long history.
+     */
+    ~Bin();
+
     /**
      * @brief Updates the fill level for one time step (day).
      * @post The `currentFill` amount is increased by `fillRate`, capped at `capacity`.
@@ -58,16 +92,39 @@ public:
 
     /**
      * @brief Records current fill level in history for prediction.
+     *
+     * O(1): the oldest level leaves the window and the aggregates are patched.
      * @param fillLevel The fill level to record.
      */
     void recordFillLevel(int fillLevel);
 
     /**
      * @brief Calculates average fill rate from historical data.
+     *
+     * The mean of the window's slots, unrecorded slots counting as 0. O(1).
      * @return Average fill rate based on history.
      */
     double getAverageFillRate() const;
 
+    /**
+     * @brief Mean change between consecutive recorded levels in the window. O(1).
+     * @return Average daily change (negative after collections), 0 with fewer than
+     *         two recorded levels.
+     */
+    double getAverageDailyChange() const;
+
+    /**
+     * @brief Population variance of those daily changes. O(1).
+     * @return Variance, 0 with fewer than two recorded levels.
+     */
+    double getDailyChangeVariance() const;
+
+    /**
+     * @brief Changes the history window and forgets the recorded levels.
+     * @param days Fill levels kept (values below 1 are raised to 1).
+     */
+    void setHistoryDays(int days);
+
     /**
      * @brief Checks if bin has overflowed.
      * @return true if currentFill >= capacity.
@@ -82,8 +139,10 @@ public:
     int getInitialFill() const;
     int getFillRate() const;
     int getNodeId() const;
-    const int* getFillHistory() const;
+    const int* getFillHistory() const;  // ring of getHistoryDays() levels
     int getHistoryIndex() const;
+    int getHistoryDays() const;
+    int getRecordedDays() const;
     // Set
     void setCurrentFill(int fill);
 };
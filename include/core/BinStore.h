@@ -0,0 +1,142 @@
+/**
+ * @file BinStore.h
+ * @brief Structure-of-arrays copy of the bins' hot fields with a vectorized day update.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "core/Facilities.h"
+#include "utils/Simd.h"
+
+namespace project {
+
+/**
+ * @brief Capacity, fill, fill rate and node of every bin in separate aligned arrays.
+ *
+ * A Bin object spreads these four ints over two cache lines next to its strings and
+ * history, so a day update over millions of bins mostly waits for memory. Here one
+ * day is a single pass over 16 bytes per bin: add the fill rate, clamp at capacity,
+ * count bins at capacity and write the fill into a day-major ring of the last
+ * `getHistoryDays()` fills (the longest history window among the loaded bins). With
+ * AVX2 the pass handles eight bins per instruction; the kernel is picked at run time,
+ * so the same binary runs on CPUs without it.
+ *
+ * Arrays are padded to a multiple of eight with empty bins that never fill, so the
+ * vector loop has no scalar tail. The day update gives exactly the fills of
+ * `Bin::updateFill`; `writeTo` copies them back, history included, for planners that
+ * read Bin objects.
+ */
+class BinStore {
+public:
+    using Kernel = SimdKernel;  ///< Implementation of the day update
+
+private:
+    int binCount;
+    int paddedCount;  // binCount rounded up to a multiple of 8
+    int* capacity;
+    int* fill;
+    int* fillRate;
+    int* node;
+    int* history;      // historyDays rows of paddedCount fills, oldest overwritten
+    int historyDays;   // longest Bin::getHistoryDays() at `load`
+    int historyRow;    // row the next day is written to
+    int daysAdvanced;  // days since `load`
+    int unwritten;     // days advanced since the last `writeTo`
+    Kernel kernel;
+
+    void release();
+
+public:
+    /**
+     * @brief Constructs an empty store.
+     */
+    BinStore();
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~BinStore();
+
+    BinStore(const BinStore&) = delete;
+    BinStore& operator=(const BinStore&) = delete;
+
+    /**
+     * @brief Copies every bin's capacity, fill, fill rate and node.
+     *
+     * Forgets the days advanced before; the bins' own history is not copied. The
+     * ring keeps as many days as the longest history window among the bins.
+     * @param facilities Facilities holding the bins.
+     */
+    void load(const Facilities& facilities);
+
+    /**
+     * @brief Forgets every bin (a later `load` copies them again).
+     */
+    void clear();
+
+    /**
+     * @brief Advances every bin by one day.
+     *
+     * Same as `Bin::updateFill` on each bin: fill += rate, capped at capacity.
+     * @return Bins at or over capacity afterwards (what `Simulation` counts as
+     *         overflow events).
+     */
+    int advanceDay();
+
+    /**
+     * @brief Empties a bin by an amount, like `Bin::collect`.
+     * @param index Bin index.
+     * @param amount Collected amount; negative amounts are ignored.
+     */
+    void collect(int index, int amount);
+
+    /**
+     * @brief Writes the fills back into the bins.
+     *
+     * Records the fill of each day advanced since the last `writeTo` (or `load`; at
+     * most `getHistoryDays()`, which covers every bin's window) in the bin's history,
+     * as `Bin::updateFill` would have, then sets the current fill. Called once a day
+     * this is one history entry per bin.
+     * @param facilities The facilities the store was loaded from.
+     */
+    void writeTo(Facilities& facilities);
+
+    /**
+     * @brief Selects the day-update implementation.
+     * @param selected Kernel; Avx2 without CPU support runs the scalar loop.
+     */
+    void setKernel(Kernel selected);
+
+    /**
+     * @brief Returns the kernel `advanceDay` actually runs (never Auto).
+     */
+    Kernel getKernel() const;
+
+    /**
+     * @brief Checks whether this CPU can run the AVX2 kernel.
+     */
+    static bool hasAvx2();
+
+    int getBinCount() const;
+    int getCapacity(int index) const;
+    int getFill(int index) const;
+    int getFillRate(int index) const;
+    int getNode(int index) const;
+
+    /**
+     * @brief Returns the number of days the history ring keeps.
+     */
+    int getHistoryDays() const;
+
+    /**
+     * @brief Fill of a bin some days ago, as recorded by `advanceDay`.
+     * @param index Bin index.
+     * @param daysAgo 0 for the last day advanced, up to `getHistoryDays()` - 1.
+     * @return The recorded fill, or 0 if fewer days were advanced since `load`.
+     */
+    int getHistory(int index, int daysAgo) const;
+};
+
+}  // namespace project
@@ -0,0 +1,156 @@
+/**
+ * @file CriticalBinIndex.h
+ * @brief Bins ordered by predicted overflow day, for critical-bin queries without a scan.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "core/Facilities.h"
+#include "core/OverflowPredictor.h"
+#include "data_structures/IndexedPriorityQueue.hpp"
+
+namespace project {
+
+/**
+ * @brief Indexed min-heap of bins keyed by the day each is predicted to overflow.
+ *
+ * `RoutePlanner::hasCriticalBins` asks the planner's `OverflowPredictor` about every
+ * bin every day. Here a bin's key is an absolute day: today plus the predictor's
+ * `predictDaysToOverflow` (history average, or the attached forecast model). A bin
+ * is critical exactly when the predictor says so, i.e. its key is at most today
+ * plus the threshold, as long as the keys are refreshed with the same predictor.
+ *
+ * While a bin's prediction simply counts down one day per day its key does not
+ * move. `update` recomputes a key and touches the heap only when it moved, so the
+ * daily refresh is a comparison per bin and heap work for the moved ones. "Any
+ * critical bin?" then looks at the heap top in O(1) and the k most urgent bins cost
+ * O(k log B). Bins that never fill are not queued.
+ */
+class CriticalBinIndex {
+private:
+    IndexedPriorityQueue<long long> queue;  // bin index -> predicted overflow day
+    int* taken;                             // bins popped by a query, pushed back afterwards
+    long long* takenDays;                   // ... and their keys
+    int binCount;
+    int criticalThreshold;  // critical: overflow within this many days
+    bool enabled;
+
+    /**
+     * @brief Pops up to `limit` bins with a key of at most `lastDay`, then restores them.
+     * @return Number of bins written to `bins` (most urgent first).
+     */
+    int collect(int limit, long long lastDay, int* bins);
+
+public:
+    /**
+     * @brief Creates an empty, disabled index.
+     * @param threshold Critical threshold in days, as in `OverflowPredictor`.
+     */
+    explicit CriticalBinIndex(int threshold = 2);
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~CriticalBinIndex();
+
+    CriticalBinIndex(const CriticalBinIndex&) = delete;
+    CriticalBinIndex& operator=(const CriticalBinIndex&) = delete;
+
+    /**
+     * @brief Keys every bin. O(B log B).
+     * @param facilities Facilities holding the bins.
+     * @param predictor Predictor the critical checks use.
+     * @param today Current simulation day.
+     */
+    void build(const Facilities& facilities, const OverflowPredictor& predictor, int today);
+
+    /**
+     * @brief Recomputes one bin's key; the heap changes only if the key moved.
+     *
+     * O(1) when the overflow day is unchanged, O(log B) otherwise.
+     * @param index Facilities index of the bin.
+     * @param bin The bin.
+     * @param predictor Predictor the critical checks use.
+     * @param today Current simulation day.
+     * @return true if the key moved (or the bin entered or left the heap).
+     */
+    bool update(int index, const Bin& bin, const OverflowPredictor& predictor, int today);
+
+    /**
+     * @brief Forgets every bin (a later `build` keys them again).
+     */
+    void clear();
+
+    /**
+     * @brief Predicted overflow day of a bin.
+     * @param bin The bin.
+     * @param index Facilities index of the bin (for an attached forecast model).
+     * @param predictor Predictor the critical checks use.
+     * @param today Current simulation day.
+     * @return Day it overflows (today - 1 if it already does), LLONG_MAX if it never fills.
+     */
+    static long long overflowDay(const Bin& bin, int index, const OverflowPredictor& predictor,
+                                 int today);
+
+    /**
+     * @brief Checks whether some bin is critical today. O(1).
+     * @param today Current simulation day.
+     */
+    bool hasCritical(int today) const;
+
+    /**
+     * @brief Lists the critical bins, most urgent first. O(c log B) for c of them.
+     * @param today Current simulation day.
+     * @param bins Output array with room for `size()` entries.
+     * @return Number of critical bins.
+     */
+    int getCriticalBins(int today, int* bins);
+
+    /**
+     * @brief Lists the k most urgent bins. O(k log B).
+     * @param k Bins wanted.
+     * @param bins Output array with room for k entries.
+     * @return Number of bins written (fewer when fewer are queued).
+     */
+    int getMostUrgent(int k, int* bins);
+
+    /**
+     * @brief Checks whether a bin is queued (it fills and the index is built).
+     */
+    bool contains(int index) const;
+
+    /**
+     * @brief Stored overflow day of a queued bin.
+     * @pre `contains(index)` is true.
+     */
+    long long getOverflowDay(int index) const;
+
+    /**
+     * @brief Returns the number of queued bins.
+     */
+    int size() const;
+
+    /**
+     * @brief Returns the number of bins the index was built for.
+     */
+    int getBinCount() const;
+
+    /**
+     * @brief Updates the critical threshold (no re-keying needed).
+     * @param threshold New threshold in days.
+     */
+    void setCriticalThreshold(int threshold);
+    int getCriticalThreshold() const;
+
+    /**
+     * @brief Turns the index on or off (the simulation then scans every bin).
+     *
+     * Turning it off forgets every bin, since collections no longer re-key them.
+     */
+    void setEnabled(bool value);
+    bool isEnabled() const;
+};
+
+}  // namespace project
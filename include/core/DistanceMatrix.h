@@ -0,0 +1,158 @@
+/**
+ * @file DistanceMatrix.h
+ * @brief Precomputed shortest-path distances between all points of interest.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include <ostream>
+
+namespace project {
+
+class RoutePlanner;
+class ThreadPool;
+
+/**
+ * @brief Dense distance table over the bin, depot and disposal nodes.
+ *
+ * The road graph does not change during a run, so the table is built once (one
+ * one-to-many search per point, spread over a thread pool) and then answers
+ * point-to-point queries in O(1). Distances are stored in 16-bit cells when every
+ * finite distance fits, otherwise in 32-bit cells. Rows are written straight into the
+ * 16-bit table; only when a distance does not fit is it dropped and the rows searched
+ * again into 32-bit cells, so the two tables are never held at once.
+ */
+class DistanceMatrix {
+public:
+    /**
+     * @brief Cell width selection.
+     */
+    enum class Storage {
+        Auto,   ///< 16-bit cells when all distances fit, 32-bit otherwise
+        Bits32  ///< Always 32-bit cells
+    };
+
+    static const int MAX_POINTS = 20000;  ///< Largest table built (400M cells)
+
+private:
+    int pointCount;           // number of points of interest
+    int* pointNodes;          // point index -> graph node
+    int nodeCount;            // size of the node -> point table
+    int* nodeToPoint;         // graph node -> point index, -1 when not a point
+    unsigned short* cells16;  // compact cells (UNREACHABLE_16 = unreachable)
+    int* cells32;             // wide cells (INT_MAX = unreachable)
+    double buildMillis;       // wall time of the last build
+    int buildThreads;         // worker count used by the last build
+    long long buildPeak;      // most bytes held at once by the last build
+
+    static const unsigned short UNREACHABLE_16 = 0xFFFF;
+
+    void release();
+    void copyFrom(const DistanceMatrix& other);
+
+    /**
+     * @brief Fills 16-bit cells row by row.
+     * @return `false` (cells freed) as soon as a finite distance does not fit.
+     */
+    bool fillCompact(const RoutePlanner& planner, ThreadPool& pool);
+
+    /**
+     * @brief Fills 32-bit cells row by row.
+     */
+    void fillWide(const RoutePlanner& planner, ThreadPool& pool);
+
+public:
+    /**
+     * @brief Constructs an empty matrix (every lookup misses).
+     */
+    DistanceMatrix();
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~DistanceMatrix();
+
+    /**
+     * @brief Copy constructor.
+     */
+    DistanceMatrix(const DistanceMatrix& other);
+
+    /**
+     * @brief Assignment operator.
+     */
+    DistanceMatrix& operator=(const DistanceMatrix& other);
+
+    /**
+     * @brief Builds the table for the given points.
+     *
+     * Duplicate and invalid node IDs are ignored. Each row is one one-to-many
+     * search, and rows are computed in parallel.
+     * @param planner Planner whose graph and search are used (must not have this
+     *                matrix attached yet).
+     * @param nodes Array of point-of-interest node IDs.
+     * @param count Number of entries in `nodes`.
+     * @param storage Cell width selection.
+     * @param threads Worker threads; 0 or less uses the hardware thread count.
+     * @return `false` if there are more than MAX_POINTS distinct points (table left empty).
+     */
+    bool build(const RoutePlanner& planner, const int* nodes, int count,
+               Storage storage = Storage::Auto, int threads = 0);
+
+    /**
+     * @brief Checks whether a node is a point of interest in the table.
+     * @param node Graph node ID.
+     * @return `true` if lookups involving this node are O(1).
+     */
+    bool contains(int node) const {
+        return node >= 0 && node < nodeCount && nodeToPoint[node] != -1;
+    }
+
+    /**
+     * @brief Looks up the shortest distance between two points of interest.
+     * @param from Source node ID.
+     * @param to Destination node ID.
+     * @pre `contains(from)` and `contains(to)` are true.
+     * @return The distance, or INT_MAX if unreachable.
+     */
+    int lookup(int from, int to) const;
+
+    /**
+     * @brief Gets the number of points of interest.
+     */
+    int getPointCount() const;
+
+    /**
+     * @brief Checks whether 16-bit cells are in use.
+     */
+    bool isCompact() const;
+
+    /**
+     * @brief Returns the memory held by the table and its index arrays.
+     * @return Size in bytes.
+     */
+    long long getMemoryUsage() const;
+
+    /**
+     * @brief Returns the most memory held at once during the last build.
+     *
+     * Index arrays, the cell table being filled and the workers' row buffers.
+     * @return Size in bytes.
+     */
+    long long getPeakMemoryUsage() const;
+
+    /**
+     * @brief Returns the wall time of the last build.
+     * @return Milliseconds.
+     */
+    double getBuildMillis() const;
+
+    /**
+     * @brief Prints points, cell width, memory footprint, build peak and build time.
+     * @param out Output stream.
+     */
+    void printReport(std::ostream& out) const;
+};
+
+}  // namespace project
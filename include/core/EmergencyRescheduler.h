@@ -0,0 +1,136 @@
+/**
+ * @file EmergencyRescheduler.h
+ * @brief Inserts newly critical bins into a planned route by cheapest insertion.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "core/PlanningState.h"
+#include "core/Route.h"
+#include "core/RoutePlanner.h"
+
+namespace project {
+
+/**
+ * @brief Adds bins to an existing route without planning it again.
+ *
+ * `attach` copies a route and remembers the driving distance of each of its legs
+ * (start, stops, depot) and the load of each trip between disposal stops. `insert`
+ * then tries the bin between every pair of consecutive stops whose trip still has
+ * room and keeps the position with the smallest detour
+ * `d(prev, bin) + d(bin, next) - d(prev, next)`. The last term comes from the leg
+ * table, so one insertion costs two distance lookups per position, O(route length)
+ * in total, and the table is patched in place afterwards.
+ *
+ * When no trip has room, the bin starts a new trip at the end of the route after
+ * the disposal site nearest to the last stop. A bin fuller than the truck is
+ * planned as if it held one truckload; the truck collects what fits.
+ */
+class EmergencyRescheduler {
+private:
+    const RoutePlanner& planner;  // distance oracle
+    const PlanningState* state;   // snapshot of the attached route (not owned)
+    Route route;                  // working copy
+    int* stopNodes;               // graph node of each stop
+    int* stopTrips;               // trip of each stop (disposal stops end a trip)
+    int* legDistances;            // legDistances[k]: leg into stop k; [length]: back to depot
+    int* tripLoads;               // planned load of each trip
+    int tripCount;
+    int slots;                    // allocated entries in the stop arrays
+    long long lookups;            // distance lookups since attach
+
+    /**
+     * @brief Makes room for at least `count` stops, keeping the contents.
+     * @param count Required stops.
+     */
+    void reserve(int count);
+
+    /**
+     * @brief Counted distance lookup.
+     */
+    int distance(int from, int to);
+
+    /**
+     * @brief Cheapest position in a trip that still has room for a bin.
+     * @param bin State slot of the bin.
+     * @param position Set to the insert position, or -1 if no trip has room.
+     * @param legIn Set to the distance from the previous stop.
+     * @param legOut Set to the distance to the next stop.
+     * @param trip Set to the trip of that position.
+     * @return Added distance at that position (undefined when `position` is -1).
+     */
+    long long findPosition(int bin, int& position, int& legIn, int& legOut, int& trip);
+
+    /**
+     * @brief Inserts a stop into the working route and patches the tables.
+     * @param position Insert position.
+     * @param node Graph node of the stop.
+     * @param bin State slot of a bin, or -1 for a disposal stop.
+     * @param legIn Distance from the previous stop.
+     * @param legOut Distance to the next stop.
+     * @param trip Trip the stop belongs to.
+     */
+    void insertStop(int position, int node, int bin, int legIn, int legOut, int trip);
+
+public:
+    /**
+     * @brief Creates a rescheduler that reads distances from a planner.
+     * @param planner Planner answering `computeDistance`; must outlive this object.
+     */
+    explicit EmergencyRescheduler(const RoutePlanner& planner);
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~EmergencyRescheduler();
+
+    EmergencyRescheduler(const EmergencyRescheduler&) = delete;
+    EmergencyRescheduler& operator=(const EmergencyRescheduler&) = delete;
+
+    /**
+     * @brief Starts from a planned route.
+     *
+     * The truck starts at the state's truck node with its current load and ends the
+     * route at the depot, as in `Simulation`. Costs one lookup per leg.
+     * @param route Route over the state's bin slots (optional disposal stops).
+     * @param state Snapshot the route was planned on; must outlive later calls.
+     */
+    void attach(const Route& route, const PlanningState& state);
+
+    /**
+     * @brief Inserts one bin at its cheapest feasible position.
+     * @param bin State slot of the bin; it must not be on the route yet.
+     * @return Added driving distance, or -1 if the bin cannot be reached.
+     */
+    int insert(int bin);
+
+    /**
+     * @brief Added distance of the cheapest insertion into a trip with room, without
+     *        inserting.
+     *
+     * Costs the same lookups as `insert` but never opens a new trip.
+     * @param bin State slot of a bin that is not on the route.
+     * @return Added driving distance, or -1 if no trip has room or the bin cannot be
+     *         reached.
+     */
+    int insertionCost(int bin);
+
+    /**
+     * @brief Returns the route with every insertion so far.
+     */
+    const Route& getRoute() const;
+
+    /**
+     * @brief Planned driving distance of the current route.
+     */
+    long long getPlannedDistance() const;
+
+    /**
+     * @brief Distance lookups since the last `attach` (including its own).
+     */
+    long long getLookups() const;
+};
+
+}  // namespace project
@@ -16,14 +16,17 @@ namespace project {
 /**
  * @brief Central container for all physical entities.
  *
- * Owns the garbage bins, facilities (depot/disposal), and the garbage truck,
- * providing centralized resource management and access for the simulation.
+ * Owns the garbage bins, facilities (depot/disposal), and the fleet of garbage
+ * trucks, providing centralized resource management and access for the simulation.
+ * The first truck is the one single-truck code works with (`getTruck()`).
  */
 class Facilities {
 private:
     Bin* bins;
     int binCount;
-    Truck truck;
+    int binCapacity;  // Allocated slots in `bins` (grows by doubling)
+    Truck* trucks;    // Fleet; always holds at least one truck
+    int truckCount;
     Facility* facilities;
     int facilityCount;
 
@@ -42,7 +45,7 @@ public:
     /**
      * @brief Adds a garbage bin to the collection.
      * @param bin The bin instance to add.
-     * @post The internal `bins` array is resized to include the new bin.
+     * @post The internal `bins` array holds the new bin (amortized O(1)).
      */
     void addBin(const Bin& bin);
 
@@ -59,6 +62,12 @@ public:
      */
     Bin* getBins();
 
+    /**
+     * @brief Returns the raw pointer to the array of bins (read-only).
+     * @return Pointer to the start of the `Bin` array.
+     */
+    const Bin* getBins() const;
+
     /**
      * @brief Returns a reference to a specific bin by its index.
      * @param index The index of the bin.
@@ -85,6 +94,13 @@ public:
      */
     int getFacilityCount() const;
 
+    /**
+     * @brief Returns a facility by index.
+     * @param index Index (0 .. getFacilityCount() - 1).
+     * @return Const reference to the facility.
+     */
+    const Facility& getFacility(int index) const;
+
     /**
      * @brief Finds and returns the depot node ID.
      * @return Node ID of the depot, or -1 if not found.
@@ -99,16 +115,36 @@ public:
     int* getDisposalNodes(int& count) const;
 
     /**
-     * @brief Sets the garbage truck instance.
+     * @brief Sets the first garbage truck of the fleet.
      * @param truck The truck instance.
      */
     void setTruck(const Truck& truck);
 
     /**
-     * @brief Returns a reference to the garbage truck.
+     * @brief Returns a reference to the first garbage truck of the fleet.
      * @return Reference to the `Truck` object.
      */
     Truck& getTruck();
+
+    /**
+     * @brief Appends a truck to the fleet, after the one set with `setTruck`.
+     * @param truck The truck instance.
+     */
+    void addTruck(const Truck& truck);
+
+    /**
+     * @brief Returns a truck of the fleet.
+     * @param index Truck index.
+     * @pre `index` must be a valid index (0 <= index < truckCount).
+     * @return Reference to the requested `Truck` object.
+     */
+    Truck& getTruck(int index) const;
+
+    /**
+     * @brief Returns the number of trucks in the fleet (at least 1).
+     * @return The truck count.
+     */
+    int getTruckCount() const;
 };
 
 }  // namespace project
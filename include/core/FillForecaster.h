@@ -0,0 +1,139 @@
+/**
+ * @file FillForecaster.h
+ * @brief Holt-Winters forecast of each bin's daily inflow with a weekly season.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "core/Facilities.h"
+#include "core/ForecastModel.h"
+
+namespace project {
+
+/**
+ * @brief Per-bin level, trend and 7-day season of the waste added each day.
+ *
+ * The history average of `Bin` is flat: a bin that fills twice as fast on market
+ * days looks the same every day, so the spike is predicted late. This model learns
+ * the spike. Each day every bin observes the amount that was added to it and its
+ * state is updated with additive Holt-Winters smoothing:
+ *
+ *     level  = a (y - season[d]) + (1 - a)(level + trend)
+ *     trend  = b (level - previous level) + (1 - b) trend
+ *     season[d] = g (y - level) + (1 - g) season[d]
+ *
+ * where d is the weekday of the observation. An update is O(1) and a bin's state is
+ * nine floats in one array. Days to overflow sum the forecast of the coming days
+ * until the free space is used up.
+ *
+ * Attach it to an `OverflowPredictor` (or the planners that own one) to replace the
+ * history average. Bins are addressed by their Facilities index.
+ */
+class FillForecaster : public ForecastModel {
+public:
+    static const int SEASON_DAYS = 7;         ///< Length of the season (one week)
+    static const int MAX_FORECAST_DAYS = 60;  ///< Days summed before extrapolating
+
+    /**
+     * @brief Smoothed state of one bin.
+     */
+    struct State {
+        float level;                // inflow per day without the season
+        float trend;                // change of the level per day
+        float season[SEASON_DAYS];  // added to the level on each weekday
+    };
+
+private:
+    State* states;
+    int binCount;
+    int day;  // weekday counter of the next observation
+    double alpha;
+    double beta;
+    double gamma;
+    bool enabled;
+
+public:
+    /**
+     * @brief Creates an empty, disabled model.
+     * @param alpha Level smoothing (0-1).
+     * @param beta Trend smoothing (0-1).
+     * @param gamma Season smoothing (0-1).
+     */
+    explicit FillForecaster(double alpha = 0.3, double beta = 0.02, double gamma = 0.3);
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~FillForecaster() override;
+
+    FillForecaster(const FillForecaster&) = delete;
+    FillForecaster& operator=(const FillForecaster&) = delete;
+
+    /**
+     * @brief Starts every bin at its configured fill rate, no trend and no season.
+     * @param facilities Facilities holding the bins.
+     */
+    void load(const Facilities& facilities);
+
+    /**
+     * @brief Starts `count` bins at a zero level (set them with `setLevel`).
+     * @param count Number of bins.
+     */
+    void reset(int count);
+
+    /**
+     * @brief Overrides the level of one bin, e.g. with a known fill rate.
+     * @param index Bin index.
+     * @param level Inflow per day.
+     */
+    void setLevel(int index, double level);
+
+    /**
+     * @brief Updates one bin with the amount added to it today. O(1).
+     *
+     * Days on which the bin hit its capacity only show part of the inflow; skip them
+     * rather than teaching the model a low value.
+     * @param index Bin index.
+     * @param inflow Amount added today.
+     */
+    void observe(int index, double inflow) override;
+
+    /**
+     * @brief Moves to the next weekday once every bin has been observed.
+     */
+    void advanceDay() override;
+
+    /**
+     * @brief Forecast inflow of a bin some days ahead (never negative).
+     * @param index Bin index.
+     * @param ahead 1 for the next observed day, 2 for the one after, ...
+     * @return Expected amount added on that day.
+     */
+    double forecast(int index, int ahead) const override;
+
+    /**
+     * @brief Days until the forecast inflow fills the free space of a bin.
+     *
+     * Same convention as `OverflowPredictor::predictDaysToOverflow`: whole days the
+     * bin can still take, at least 1. Beyond MAX_FORECAST_DAYS the average of the
+     * summed days is extrapolated.
+     * @param index Bin index.
+     * @param remaining Free space of the bin.
+     * @return Days to overflow, or INT_MAX when nothing is expected to be added.
+     */
+    int predictDaysToOverflow(int index, int remaining) const override;
+
+    /**
+     * @brief Turns the model on or off (the simulation then uses the history average).
+     */
+    void setEnabled(bool value);
+    bool isEnabled() const;
+
+    int getBinCount() const override;
+    int getDay() const;
+    const State& getState(int index) const;
+};
+
+}  // namespace project
@@ -0,0 +1,134 @@
+/**
+ * @file FleetPlanner.h
+ * @brief Splits the bins between the trucks of a fleet and plans their routes in parallel.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "core/Facilities.h"
+#include "core/PlanningState.h"
+#include "core/Route.h"
+#include "core/RouteImprover.h"
+#include "core/RoutePlanner.h"
+#include "utils/ThreadPool.h"
+
+namespace project {
+
+/**
+ * @brief Per-truck route construction for a fleet sharing one depot.
+ *
+ * Every bin belongs to exactly one truck's territory. Territories are grown
+ * around seed bins picked farthest-first (each seed as far as possible from the
+ * previous ones), and bins are handed to the nearest seed with room left, so all
+ * trucks get about the same number of bins and compact districts.
+ *
+ * Each truck owns a PlanningState holding its bins, every disposal site and the
+ * truck itself. `plan` captures the day's states and runs the configured planning
+ * engine plus local search for all trucks at once on a thread pool; neither the
+ * facilities nor the shared RoutePlanner are written, so no locking is needed.
+ */
+class FleetPlanner {
+private:
+    RoutePlanner& planner;    // shared distance oracle and planning engine
+    int truckCount;
+    int binCount;
+    int* territoryOf;         // bin -> truck, -1 before `assignBins`
+    int* territoryStart;      // truck t owns territoryBins[territoryStart[t] .. [t + 1])
+    int* territoryBins;       // global bin indices grouped by truck
+    PlanningState* states;    // per-truck planning input (own bins only)
+    RouteImprover** improvers;  // per-truck local search
+    Route* routes;            // last routes, in global bin indices
+    long long plannedBefore;  // planned distance of the last call before local search
+    long long plannedAfter;   // ... and after it
+    double lastMillis;
+    ThreadPool pool;
+
+public:
+    /**
+     * @brief Creates a fleet planner for every truck in `facilities`.
+     * @param planner Shared planner (distance matrix etc. already attached); must outlive
+     *                this object.
+     * @param facilities System facilities with all bins and trucks loaded.
+     * @param threads Worker threads for per-truck planning (0 = hardware count).
+     */
+    FleetPlanner(RoutePlanner& planner, const Facilities& facilities, int threads = 0);
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~FleetPlanner();
+
+    FleetPlanner(const FleetPlanner&) = delete;
+    FleetPlanner& operator=(const FleetPlanner&) = delete;
+
+    /**
+     * @brief Splits the bins into one territory per truck.
+     *
+     * One distance query batch per truck (O(bins) each with a distance matrix),
+     * then a balanced nearest-seed assignment: every territory gets at most
+     * ceil(bins / trucks) bins. Bins no seed can reach go to the smallest territory.
+     * @param facilities System facilities.
+     */
+    void assignBins(const Facilities& facilities);
+
+    /**
+     * @brief Plans and improves one route per truck, in parallel.
+     *
+     * Reads the current bin fills and truck states; `facilities` is not modified.
+     * @param facilities System facilities.
+     * @param improveBudgetMs Local-search time limit per truck (0 only splits trips).
+     */
+    void plan(const Facilities& facilities, double improveBudgetMs);
+
+    /**
+     * @brief Returns the last route of a truck.
+     * @param truck Truck index.
+     * @return Route with global bin indices and disposal stops.
+     */
+    const Route& getRoute(int truck) const;
+
+    /**
+     * @brief Returns the truck whose territory holds a bin.
+     * @param bin Bin index.
+     * @return Truck index, or -1 if the bin is unknown.
+     */
+    int getTerritoryOf(int bin) const;
+
+    /**
+     * @brief Returns the number of bins in a truck's territory.
+     * @param truck Truck index.
+     */
+    int getTerritorySize(int truck) const;
+
+    /**
+     * @brief Returns the number of trucks planned for.
+     */
+    int getTruckCount() const;
+
+    /**
+     * @brief Planned distance of all routes of the last call before / after local search.
+     */
+    long long getPlannedBefore() const;
+    long long getPlannedAfter() const;
+
+    /**
+     * @brief Wall time of the last `plan` call in milliseconds.
+     */
+    double getLastMillis() const;
+
+    /**
+     * @brief Returns the number of worker threads.
+     */
+    int getThreadCount() const;
+
+    /**
+     * @brief Takes the bins' risks from a forecast model.
+     * @param model Model indexed like the facilities' bins, or nullptr for the
+     *              history average.
+     */
+    void setForecaster(const ForecastModel* model);
+};
+
+}  // namespace project
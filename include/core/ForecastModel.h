@@ -0,0 +1,63 @@
+/**
+ * @file ForecastModel.h
+ * @brief Interface of the per-bin inflow forecasts the overflow predictor can use.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+namespace project {
+
+/**
+ * @brief Online model of the waste added to each bin per day.
+ *
+ * A model sees every bin's inflow once a day (`observe`, then `advanceDay` once all
+ * bins are done) and predicts the coming days from its own per-bin state. Bins are
+ * addressed by their Facilities index. `OverflowPredictor` and the planners take a
+ * model through this interface, so any of `SmoothingForecaster` (flat exponential
+ * smoothing), `FillForecaster` (Holt-Winters with a weekly season) or another model
+ * can be plugged in.
+ */
+class ForecastModel {
+public:
+    virtual ~ForecastModel() = default;
+
+    /**
+     * @brief Updates one bin with the amount added to it today.
+     * @param index Bin index.
+     * @param inflow Amount added today.
+     */
+    virtual void observe(int index, double inflow) = 0;
+
+    /**
+     * @brief Moves to the next day once every bin has been observed.
+     */
+    virtual void advanceDay() = 0;
+
+    /**
+     * @brief Forecast inflow of a bin some days ahead (never negative).
+     * @param index Bin index.
+     * @param ahead 1 for the next observed day, 2 for the one after, ...
+     * @return Expected amount added on that day.
+     */
+    virtual double forecast(int index, int ahead) const = 0;
+
+    /**
+     * @brief Days until the forecast inflow fills the free space of a bin.
+     *
+     * Same convention as `OverflowPredictor::predictDaysToOverflow`: whole days the
+     * bin can still take, at least 1.
+     * @param index Bin index.
+     * @param remaining Free space of the bin.
+     * @return Days to overflow, or INT_MAX when nothing is expected to be added.
+     */
+    virtual int predictDaysToOverflow(int index, int remaining) const = 0;
+
+    /**
+     * @brief Returns the number of bins the model holds state for.
+     */
+    virtual int getBinCount() const = 0;
+};
+
+}  // namespace project
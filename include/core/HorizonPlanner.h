@@ -0,0 +1,122 @@
+/**
+ * @file HorizonPlanner.h
+ * @brief Chooses which bins to collect today and which can wait (rolling horizon).
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "core/EmergencyRescheduler.h"
+#include "core/Facilities.h"
+#include "core/OverflowPredictor.h"
+#include "core/PlanningState.h"
+#include "core/RoutePlanner.h"
+
+namespace project {
+
+/**
+ * @brief Rolling-horizon selection of today's bins (inventory routing heuristic).
+ *
+ * Every day a plain planner visits each non-empty bin. This selector keeps only
+ * the bins that cannot wait, then adds the ones that are cheap to serve on the way:
+ * - must: bins the predictor calls critical (overflowing, or at most the critical
+ *   threshold of days left per `OverflowPredictor::predictDaysToOverflow`) and bins
+ *   whose current fill rate would make them overflow before tomorrow's collection;
+ * - optional: other non-empty bins due within the horizon, most urgent first. One
+ *   joins today's route when its cheapest insertion into a trip with room costs at
+ *   most `detourFactor` x (planned distance per must bin) x (fill / capacity), so
+ *   nearly full bins on the way are taken and nearly empty ones wait.
+ *
+ * The must bins are routed once with the planner's engine, optional bins are
+ * scored by EmergencyRescheduler insertion (O(route length) lookups each), and the
+ * chosen bins are captured into a subset PlanningState for the real planning run.
+ * A day without must bins plans no route at all. Deferred bins are looked at again
+ * the next day, so the horizon rolls forward by one day per call.
+ */
+class HorizonPlanner {
+private:
+    RoutePlanner& planner;
+    OverflowPredictor predictor;    // days to overflow, critical threshold
+    EmergencyRescheduler inserter;  // prices optional bins on the must route
+    PlanningState mustState;        // today's must bins (reused)
+    PlanningState allBins;          // every bin, slot == bin index (reused)
+    int* selected;                  // Facilities indices chosen for today
+    int* days;                      // days to overflow of every bin (one batch per call)
+    bool* critical;                 // critical flag of every bin
+    int selectedSlots;
+    bool enabled;
+    int horizonDays;      // optional bins are due within this many days
+    double detourFactor;  // scales the detour allowance of optional bins
+
+    // Results of the last `select` call
+    int mustCount;
+    int optionalCount;
+    int deferredCount;
+
+public:
+    /**
+     * @brief Creates a selector on top of a route planner (disabled).
+     * @param planner Planner routing the must bins; must outlive this object.
+     * @param horizonDays Optional bins are due within this many days.
+     * @param detourFactor Detour allowance scale of optional bins (0 = must bins only).
+     */
+    explicit HorizonPlanner(RoutePlanner& planner, int horizonDays = 7,
+                            double detourFactor = 0.5);
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~HorizonPlanner();
+
+    HorizonPlanner(const HorizonPlanner&) = delete;
+    HorizonPlanner& operator=(const HorizonPlanner&) = delete;
+
+    /**
+     * @brief Captures today's bins of one truck into `today`.
+     *
+     * Must bins come first, then the optional bins in the order they were accepted.
+     * Route slots of `today` map back to Facilities indices via `getBinIndex`.
+     * @param facilities System facilities (not modified).
+     * @param today State to fill with the chosen bins, the sites and the truck.
+     * @param truck Truck index.
+     * @return Number of bins chosen for today.
+     */
+    int select(const Facilities& facilities, PlanningState& today, int truck = 0);
+
+    /**
+     * @brief Turns the selection on or off (the simulation then plans every bin).
+     */
+    void setEnabled(bool value);
+    bool isEnabled() const;
+
+    /**
+     * @brief Sets the horizon of optional bins.
+     * @param days Bins due within this many days may be collected early.
+     */
+    void setHorizonDays(int days);
+    int getHorizonDays() const;
+
+    /**
+     * @brief Sets the detour allowance scale of optional bins.
+     * @param factor 0 keeps must bins only; larger values collect more bins early.
+     */
+    void setDetourFactor(double factor);
+    double getDetourFactor() const;
+
+    /**
+     * @brief Predicts must and optional bins from a forecast model.
+     * @param model Model indexed like the facilities' bins, or nullptr for the
+     *              history average.
+     */
+    void setForecaster(const ForecastModel* model);
+
+    /**
+     * @brief Bins of the last call: must, added on the way, and left for later.
+     */
+    int getMustCount() const;
+    int getOptionalCount() const;
+    int getDeferredCount() const;
+};
+
+}  // namespace project
@@ -0,0 +1,112 @@
+/**
+ * @file LandmarkOracle.h
+ * @brief ALT (A*, landmarks, triangle inequality) lower bounds on road distances.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include <ostream>
+
+#include "data_structures/CsrGraph.h"
+
+namespace project {
+
+/**
+ * @brief Distances to and from K landmark nodes, giving O(K) distance lower bounds.
+ *
+ * For any landmark L the triangle inequality gives
+ * `d(u, v) >= d(u, L) - d(v, L)` and `d(u, v) >= d(L, v) - d(L, u)`; the bound is
+ * the largest of these over all landmarks. Landmarks are chosen greedily, each one
+ * as far as possible from those already picked, so they sit on the edges of the city
+ * where the bounds are tightest. The same bounds drive a landmark-guided A*.
+ *
+ * Tables are node-major (`table[node * K + i]`) so one bound touches two cache lines.
+ */
+class LandmarkOracle {
+private:
+    const CsrGraph& network;  // road graph (owned by the planner)
+    int nodeCount;
+    int landmarkCount;
+    int* landmarks;     // landmark index -> node
+    int* fromLandmark;  // d(L_i, v) at [v * K + i], INT_MAX if unreachable
+    int* toLandmark;    // d(v, L_i) at [v * K + i], INT_MAX if unreachable
+    double buildMillis;
+
+    void release();
+
+public:
+    /**
+     * @brief Creates an empty oracle (every bound is 0) over a road graph.
+     * @param graph Forward road graph; must outlive the oracle.
+     */
+    explicit LandmarkOracle(const CsrGraph& graph);
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~LandmarkOracle();
+
+    LandmarkOracle(const LandmarkOracle&) = delete;
+    LandmarkOracle& operator=(const LandmarkOracle&) = delete;
+
+    /**
+     * @brief Picks landmarks and fills the distance tables.
+     *
+     * Costs two full Dijkstra searches per landmark (forward and on the reversed graph).
+     * @param count Number of landmarks (clamped to the node count).
+     * @post Previous tables are discarded.
+     */
+    void build(int count);
+
+    /**
+     * @brief Lower bound on the road distance from one node to another.
+     * @param from Source node.
+     * @param to Destination node.
+     * @return A value not larger than the true distance; INT_MAX when the landmarks
+     *         prove `to` unreachable; 0 for invalid nodes or an empty oracle.
+     */
+    int lowerBound(int from, int to) const;
+
+    /**
+     * @brief Exact distance by A* using the landmark bounds as heuristic.
+     * @param from Source node.
+     * @param to Destination node.
+     * @param settledCount Optional output: nodes removed from the queue.
+     * @return Shortest distance, or INT_MAX if unreachable or invalid.
+     */
+    int distance(int from, int to, int* settledCount = nullptr) const;
+
+    /**
+     * @brief Returns the number of landmarks.
+     */
+    int getLandmarkCount() const { return landmarkCount; }
+
+    /**
+     * @brief Returns the node of a landmark.
+     * @param index Landmark index.
+     * @return Node ID, or -1 for an invalid index.
+     */
+    int getLandmark(int index) const;
+
+    /**
+     * @brief Returns the memory held by the landmark tables.
+     * @return Size in bytes.
+     */
+    long long getMemoryUsage() const;
+
+    /**
+     * @brief Returns how long the last `build` took.
+     * @return Milliseconds.
+     */
+    double getBuildMillis() const { return buildMillis; }
+
+    /**
+     * @brief Writes a one-line summary (landmarks, memory, build time).
+     * @param out Output stream.
+     */
+    void printReport(std::ostream& out) const;
+};
+
+}  // namespace project
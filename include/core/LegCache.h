@@ -0,0 +1,92 @@
+/**
+ * @file LegCache.h
+ * @brief Cache of driven legs (node sequences) keyed by (from, to).
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "core/Path.h"
+#include "core/RoutePlanner.h"
+
+namespace project {
+
+/**
+ * @struct LegEntry
+ * @brief Node for the chaining linked list of the leg cache.
+ */
+struct LegEntry {
+    int from;
+    int to;
+    Path path;
+    LegEntry* next;
+
+    LegEntry(int f, int t);
+};
+
+/**
+ * @brief Remembers the geometry of every leg the planner has been asked for.
+ *
+ * The road graph is frozen for a whole simulation and trucks drive the same
+ * depot/bin/disposal legs day after day, so each leg is searched once and later
+ * requests are answered from a chained hash table.
+ */
+class LegCache {
+private:
+    const RoutePlanner& planner;
+    LegEntry** buckets;  // Array of pointers to chain heads
+    int capacity;        // Number of buckets
+    int size;            // Number of cached legs
+    long long hits;      // Requests answered from the cache
+    long long misses;    // Requests that ran a search
+
+    int hashFunction(int from, int to) const;
+
+    /** @brief Doubles the bucket array and relinks the entries. */
+    void resize();
+
+public:
+    /**
+     * @brief Creates an empty cache.
+     * @param planner Planner whose `computePath` fills the cache; must outlive it.
+     * @param initialCap Starting number of buckets.
+     */
+    explicit LegCache(const RoutePlanner& planner, int initialCap = 101);
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~LegCache();
+
+    LegCache(const LegCache&) = delete;
+    LegCache& operator=(const LegCache&) = delete;
+
+    /**
+     * @brief Returns the shortest path of a leg, searching only on the first request.
+     * @param from Source node.
+     * @param to Destination node.
+     * @return Cached path; empty with distance INT_MAX when unreachable. The reference
+     *         stays valid until `clear` or destruction.
+     */
+    const Path& getLeg(int from, int to);
+
+    /**
+     * @brief Checks whether a leg has already been computed.
+     */
+    bool contains(int from, int to) const;
+
+    /** @brief Drops every cached leg and resets the counters. */
+    void clear();
+
+    /** @return Number of cached legs. */
+    int getSize() const;
+
+    /** @return Requests answered without a search. */
+    long long getHits() const;
+
+    /** @return Requests that needed a search. */
+    long long getMisses() const;
+};
+
+}  // namespace project
@@ -0,0 +1,199 @@
+/**
+ * @file LnsPlanner.h
+ * @brief Anytime large-neighborhood search (destroy and repair) for the daily route.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "core/Facilities.h"
+#include "core/PlanningState.h"
+#include "core/Route.h"
+#include "core/RoutePlanner.h"
+
+namespace project {
+
+/**
+ * @brief Improves a planned route for as long as it is allowed to run.
+ *
+ * Starting from a route built by `RoutePlanner::planRoute`, every iteration removes a
+ * few bins and reinserts each of them at its cheapest feasible position (or in a new
+ * trip at the end of the day). Three removal operators are drawn at random:
+ * - random: any bins;
+ * - worst: bins whose detour costs most, biased towards the worst ones;
+ * - related: one bin and its nearest neighbours, so a whole street is rebuilt.
+ *
+ * A new solution is kept when it is within a shrinking threshold of the best one
+ * (record-to-record travel), which lets the search leave local optima early on and
+ * turns into pure descent as the deadline approaches. The best route found so far is
+ * returned when the time budget or iteration limit is reached, so the caller always
+ * gets an answer on time. Trips respect truck capacity; each disposal stop is moved to
+ * the cheapest site and dropped when the trips around it fit together.
+ */
+class LnsPlanner {
+public:
+    /**
+     * @brief Removal (destroy) operators.
+     */
+    enum class Removal {
+        Random,   ///< Uniformly chosen bins
+        Worst,    ///< Bins with the most expensive detours
+        Related   ///< A bin and its nearest neighbours
+    };
+
+private:
+    const RoutePlanner& planner;  // distance oracle
+    double timeBudgetMs;          // wall-clock limit per `improve` call (0 = none)
+    int maxIterations;            // iteration limit per `improve` call (0 = none)
+    unsigned int seed;            // random seed, reused by every call
+
+    // Results of the last `improve` call
+    long long initialDistance;
+    long long finalDistance;
+    long long iterations;
+    long long accepted;
+    int improvements;
+    long long removalCalls[3];
+    int removalImprovements[3];
+    double lastMillis;
+
+    // Best distance over time: (milliseconds since start, distance) at every new best
+    double* traceMillis;
+    long long* traceDistance;
+    int traceLength;
+    int traceCapacity;
+
+    /**
+     * @brief Appends a point to the best-distance trace.
+     * @param millis Time since the start of the call.
+     * @param distance Best driving distance at that time.
+     */
+    void recordBest(double millis, long long distance);
+
+public:
+    /**
+     * @brief Creates an LNS planner that reads distances from a planner.
+     * @param planner Planner answering `computeDistances`; must outlive this object.
+     * @param timeBudgetMs Time limit of one `improve` call in milliseconds (0 = none).
+     * @param maxIterations Iteration limit of one `improve` call (0 = none).
+     */
+    explicit LnsPlanner(const RoutePlanner& planner, double timeBudgetMs = 200.0,
+                        int maxIterations = 0);
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~LnsPlanner();
+
+    LnsPlanner(const LnsPlanner&) = delete;
+    LnsPlanner& operator=(const LnsPlanner&) = delete;
+
+    /**
+     * @brief Returns the best route found from a seed route within the limits.
+     *
+     * Same contract as `RouteImprover::improve`: the truck's current node, load and
+     * capacity are read from `state`, the route ends at the depot and bin fills are
+     * the amounts collected. With neither limit set only the seed is split into trips.
+     * @param route Seed route (bin slots of `state`, optional disposal stops).
+     * @param state Snapshot the route was planned on.
+     * @return Route with the same bins and explicit disposal stops; its total distance
+     *         is set to the planned driving distance.
+     */
+    Route improve(const Route& route, const PlanningState& state);
+
+    /**
+     * @brief Improves a route of the first truck, reading a snapshot of `facilities`.
+     * @param route Seed route (bins in visiting order, optional disposal stops).
+     * @param facilities System facilities (not modified).
+     * @return Best route, see `improve(const Route&, const PlanningState&)`.
+     */
+    Route improve(const Route& route, Facilities& facilities);
+
+    /**
+     * @brief Sets the time limit of one `improve` call.
+     * @param ms Milliseconds; 0 removes the limit.
+     */
+    void setTimeBudget(double ms);
+
+    /**
+     * @brief Returns the time limit of one `improve` call in milliseconds.
+     */
+    double getTimeBudget() const;
+
+    /**
+     * @brief Sets the iteration limit of one `improve` call.
+     * @param count Destroy-and-repair iterations; 0 removes the limit.
+     */
+    void setMaxIterations(int count);
+
+    /**
+     * @brief Returns the iteration limit of one `improve` call.
+     */
+    int getMaxIterations() const;
+
+    /**
+     * @brief Sets the random seed; equal seeds and inputs give equal iteration-limited runs.
+     * @param value Seed value.
+     */
+    void setSeed(unsigned int value);
+
+    /**
+     * @brief Planned distance of the seed route (split into trips) and of the result.
+     */
+    long long getInitialDistance() const;
+    long long getFinalDistance() const;
+
+    /**
+     * @brief Destroy-and-repair iterations of the last call.
+     */
+    long long getIterations() const;
+
+    /**
+     * @brief Iterations per second of the last call.
+     */
+    double getIterationsPerSecond() const;
+
+    /**
+     * @brief Iterations whose solution was kept as the new current one.
+     */
+    long long getAcceptedCount() const;
+
+    /**
+     * @brief Iterations that found a new best route.
+     */
+    int getImprovementCount() const;
+
+    /**
+     * @brief How often a removal operator ran, and how often it led to a new best route.
+     * @param removal Operator.
+     */
+    long long getRemovalCalls(Removal removal) const;
+    int getRemovalImprovements(Removal removal) const;
+
+    /**
+     * @brief Number of points in the best-distance trace of the last call.
+     *
+     * The first point is the seed at time 0, then one point per new best route.
+     */
+    int getTraceLength() const;
+
+    /**
+     * @brief Time of a trace point in milliseconds since the start of the call.
+     * @param index Point index (0 .. getTraceLength() - 1).
+     */
+    double getTraceMillis(int index) const;
+
+    /**
+     * @brief Best driving distance at a trace point.
+     * @param index Point index (0 .. getTraceLength() - 1).
+     */
+    long long getTraceDistance(int index) const;
+
+    /**
+     * @brief Wall time of the last call in milliseconds.
+     */
+    double getLastMillis() const;
+};
+
+}  // namespace project
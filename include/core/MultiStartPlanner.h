@@ -0,0 +1,146 @@
+/**
+ * @file MultiStartPlanner.h
+ * @brief Best of several randomized greedy routes, built in parallel.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "core/Facilities.h"
+#include "core/PlanningState.h"
+#include "core/Route.h"
+#include "core/RoutePlanner.h"
+#include "utils/ThreadPool.h"
+
+namespace project {
+
+/**
+ * @brief Multi-start greedy: N randomized constructions, keeps the shortest.
+ *
+ * Start 0 is the plain greedy route; every other start runs
+ * `RoutePlanner::planRandomizedGreedy` with noisy distances and a restricted
+ * candidate list, so it can leave the path the deterministic rule gets stuck on. Starts run
+ * concurrently on a thread pool and only read the shared snapshot.
+ *
+ * A start only competes when it collects every bin of the greedy route (a random
+ * start can strand the truck where the rest is unreachable); then more bins win,
+ * then the shorter driving distance from the depot back to the depot, unloading at
+ * the nearest site whenever the next bin would not fit and once more at the end of
+ * the shift, as the simulation drives it. The seed of start s depends only on the
+ * planner seed and s, and ties go to the lowest start, so the result does not depend
+ * on the thread count or scheduling. The result is never longer than the greedy
+ * route for the same bins and never drops one of them.
+ */
+class MultiStartPlanner {
+private:
+    RoutePlanner& planner;  // greedy construction and distances
+    ThreadPool* pool;       // created on the first parallel call
+    int threadCount;        // requested workers (0 = hardware count)
+    int starts;
+    unsigned int seed;
+    int candidateListSize;
+    double noise;
+
+    // Results of the last `plan` call
+    long long* startDistances;
+    int startCapacity;
+    int bestStart;
+    double lastMillis;
+
+public:
+    /**
+     * @brief Creates a multi-start planner on top of a route planner.
+     * @param planner Planner providing the greedy rule; must outlive this object.
+     * @param starts Randomized constructions per call (1 = greedy only).
+     * @param threads Worker threads (0 = hardware count).
+     */
+    explicit MultiStartPlanner(RoutePlanner& planner, int starts = 16, int threads = 0);
+
+    /**
+     * @brief Destructor to stop the workers and free allocated memory.
+     */
+    ~MultiStartPlanner();
+
+    MultiStartPlanner(const MultiStartPlanner&) = delete;
+    MultiStartPlanner& operator=(const MultiStartPlanner&) = delete;
+
+    /**
+     * @brief Plans every start and returns the shortest route.
+     *
+     * Same contract as `RoutePlanner::planRoute(const PlanningState&)` with the greedy
+     * engine; the state is only read.
+     * @param state Snapshot of the bins and the truck.
+     * @return Best route over the state's bin slots.
+     */
+    Route plan(const PlanningState& state);
+
+    /**
+     * @brief Plans on a snapshot of `facilities`, then performs the best route.
+     * @param facilities System facilities (bins and the first truck are modified).
+     * @return Best route.
+     */
+    Route plan(Facilities& facilities);
+
+    /**
+     * @brief Sets the number of constructions per call.
+     * @param count Starts (at least 1).
+     */
+    void setStarts(int count);
+
+    /**
+     * @brief Returns the number of constructions per call.
+     */
+    int getStarts() const;
+
+    /**
+     * @brief Sets the number of worker threads; the pool is restarted on the next call.
+     * @param threads Workers (0 = hardware count).
+     */
+    void setThreads(int threads);
+
+    /**
+     * @brief Returns the number of worker threads used by `plan`.
+     */
+    int getThreadCount() const;
+
+    /**
+     * @brief Sets the random seed; equal seeds and inputs give equal routes.
+     * @param value Seed value.
+     */
+    void setSeed(unsigned int value);
+
+    /**
+     * @brief Sets the randomization of starts 1..N-1.
+     *
+     * Defaults to no candidate list and 20% distance noise. Drawing from a list of
+     * two or more nearby bins diversifies more but makes most starts much longer.
+     * @param listSize Bins each choice is drawn from (at least 1).
+     * @param relativeNoise Distance noise, e.g. 0.2 for up to +20%.
+     */
+    void setRandomization(int listSize, double relativeNoise);
+
+    /**
+     * @brief Start that produced the last route (0 = the greedy one).
+     */
+    int getBestStart() const;
+
+    /**
+     * @brief Driving distance of a start in the last call.
+     * @param start Start index (0 .. getStarts() - 1 of that call).
+     */
+    long long getStartDistance(int start) const;
+
+    /**
+     * @brief Driving distance of the greedy route and of the best one in the last call.
+     */
+    long long getGreedyDistance() const;
+    long long getBestDistance() const;
+
+    /**
+     * @brief Wall time of the last call in milliseconds.
+     */
+    double getLastMillis() const;
+};
+
+}  // namespace project
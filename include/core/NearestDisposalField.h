@@ -0,0 +1,109 @@
+/**
+ * @file NearestDisposalField.h
+ * @brief Precomputed nearest disposal facility and distance for every graph node.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "data_structures/CsrGraph.h"
+
+namespace project {
+
+/**
+ * @brief Per-node "nearest disposal + distance" labels.
+ *
+ * Built with one multi-source Dijkstra over the reversed road graph, starting from
+ * every disposal node at once, so each node learns the disposal site it can reach
+ * most cheaply. Lookups are O(1). Ties go to the disposal site added first, which
+ * matches scanning the facilities in order.
+ *
+ * Adding or closing a site only re-searches the nodes whose label can change.
+ */
+class NearestDisposalField {
+private:
+    const CsrGraph& forward;  // road graph (owned by the planner)
+    CsrGraph reverse;         // transpose of `forward`
+    int nodeCount;
+    int* nearest;     // node -> nearest disposal node, -1 if none reachable
+    int* distance;    // node -> distance to that disposal node, INT_MAX if none
+    int* sourceRank;  // node -> insertion order if it is an open disposal site, else -1
+    int sourceCount;  // open disposal sites
+    int nextRank;     // rank handed to the next added site
+
+    /**
+     * @brief Tie-breaking key: distance first, then insertion order of the site.
+     */
+    long long keyOf(int dist, int site) const;
+
+    /**
+     * @brief Dijkstra over the reversed graph from the nodes already in `queue`,
+     *        improving labels only.
+     */
+    template <typename Queue>
+    void propagate(Queue& queue);
+
+public:
+    /**
+     * @brief Creates an empty field over a road graph.
+     * @param network Forward road graph; must outlive the field.
+     */
+    explicit NearestDisposalField(const CsrGraph& network);
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~NearestDisposalField();
+
+    NearestDisposalField(const NearestDisposalField&) = delete;
+    NearestDisposalField& operator=(const NearestDisposalField&) = delete;
+
+    /**
+     * @brief Recomputes every label from scratch.
+     * @param disposalNodes Array of disposal node IDs, in facility order.
+     * @param count Number of entries.
+     */
+    void build(const int* disposalNodes, int count);
+
+    /**
+     * @brief Opens a new disposal site and updates only the labels it improves.
+     * @param node Disposal node ID; ignored if invalid or already open.
+     */
+    void addDisposal(int node);
+
+    /**
+     * @brief Closes a disposal site and relabels only the nodes that used it.
+     * @param node Disposal node ID; ignored if it is not open.
+     */
+    void removeDisposal(int node);
+
+    /**
+     * @brief Returns the nearest reachable disposal node.
+     * @param node Current node.
+     * @return Disposal node ID, or -1 if none is reachable or `node` is invalid.
+     */
+    int getNearest(int node) const {
+        return node >= 0 && node < nodeCount ? nearest[node] : -1;
+    }
+
+    /**
+     * @brief Returns the distance to the nearest reachable disposal node.
+     * @param node Current node.
+     * @return Distance, or INT_MAX if none is reachable or `node` is invalid.
+     */
+    int getDistance(int node) const;
+
+    /**
+     * @brief Gets the number of open disposal sites.
+     */
+    int getDisposalCount() const;
+
+    /**
+     * @brief Returns the memory held by the labels and the reversed graph.
+     * @return Size in bytes.
+     */
+    long long getMemoryUsage() const;
+};
+
+}  // namespace project
@@ -8,6 +8,8 @@
 #pragma once
 
 #include "core/Bin.h"
+#include "core/ForecastModel.h"
+#include "utils/Simd.h"
 
 namespace project {
 
@@ -16,10 +18,21 @@ namespace project {
  *
  * Uses historical fill rate data and current state to predict when bins
  * will overflow. Provides critical metrics for routing priority decisions.
+ * With a ForecastModel attached, bins given with their index are predicted
+ * from its forecast instead of the history average. A safety margin
+ * makes the history prediction cautious with bins whose daily change varies.
  */
 class OverflowPredictor {
 private:
-    int criticalThreshold;  // Days - if predicted overflow < this, bin is critical
+    int criticalThreshold;             // Days - if predicted overflow < this, bin is critical
+    SimdKernel kernel;                 // Implementation of predictBatch
+    const ForecastModel* forecaster;   // Inflow model by bin index; nullptr = history
+    double safetyMargin;               // Standard deviations of daily change added to the rate
+
+    /**
+     * @brief Fill rate the history prediction divides by (0 or less: no prediction).
+     */
+    double effectiveRate(const Bin& bin) const;
 
 public:
     /**
@@ -34,34 +47,104 @@ public:
      * Uses the bin's average historical fill rate if available, otherwise
      * falls back to the current fill rate.
      * Formula: (Capacity - CurrentFill) / EffectiveFillRate
+     * With a forecaster and an index, `ForecastModel::predictDaysToOverflow` is used.
      * @param bin The bin object to evaluate.
+     * @param index Facilities index of the bin, or -1 for the history average.
      * @pre The bin's fill rate must be greater than zero.
      * @return The estimated number of days until the bin reaches full capacity.
      *         Returns -1 if already overflowing.
      */
-    int predictDaysToOverflow(const Bin& bin) const;
+    int predictDaysToOverflow(const Bin& bin, int index = -1) const;
 
     /**
      * @brief Checks if a bin is under critical overflow risk.
      * @param bin The bin object to evaluate.
+     * @param index Facilities index of the bin, or -1 for the history average.
      * @return `true` if predicted overflow is within critical threshold days.
      */
-    bool isCritical(const Bin& bin) const;
+    bool isCritical(const Bin& bin, int index = -1) const;
 
     /**
      * @brief Calculates overflow risk score for routing decisions.
      *
      * Lower score = higher priority (more urgent).
      * @param bin The bin to evaluate.
+     * @param index Facilities index of the bin, or -1 for the history average.
      * @return Risk score (days to overflow, lower is more urgent).
      */
-    double getOverflowRisk(const Bin& bin) const;
+    double getOverflowRisk(const Bin& bin, int index = -1) const;
+
+    /**
+     * @brief Predicts every bin of an array in one pass.
+     *
+     * Gives for each bin what `predictDaysToOverflow`, `getOverflowRisk` and
+     * `isCritical` would, except that very long predictions are capped at
+     * INT_MAX - 1 days. Bins are read in blocks into column arrays for the
+     * column kernel below. With a forecaster, bin k is forecaster bin k and the
+     * bins are predicted one by one.
+     * @param bins Bin array, e.g. `Facilities::getBins()`.
+     * @param count Number of bins.
+     * @param days Output days to overflow (-1 overflowing, INT_MAX unknown), or nullptr.
+     * @param risks Output risk scores, or nullptr.
+     * @param critical Output critical flags, or nullptr.
+     */
+    void predictBatch(const Bin* bins, int count, int* days, double* risks,
+                      bool* critical) const;
+
+    /**
+     * @brief Column kernel of `predictBatch`: four bins per AVX2 instruction.
+     *
+     * The -1 and INT_MAX cases are blended in with masks instead of branches.
+     * @param capacities Bin capacities.
+     * @param fills Current fills.
+     * @param averageRates `Bin::getAverageFillRate` of each bin.
+     * @param fillRates Configured fill rates (used when the average is not positive).
+     * @param count Number of bins.
+     * @param days Output days to overflow.
+     * @param risks Output risk scores.
+     * @param critical Output critical flags.
+     */
+    void predictBatch(const int* capacities, const int* fills, const double* averageRates,
+                      const int* fillRates, int count, int* days, double* risks,
+                      bool* critical) const;
+
+    /**
+     * @brief Selects the implementation of `predictBatch`.
+     * @param selected Kernel; Avx2 without CPU support runs the scalar loop.
+     */
+    void setKernel(SimdKernel selected);
+
+    /**
+     * @brief Returns the kernel `predictBatch` actually runs (never Auto).
+     */
+    SimdKernel getKernel() const;
+
+    /**
+     * @brief Predicts bins given with an index from a forecast model.
+     * @param model Model indexed like `Facilities::getBins()`, or nullptr for the
+     *        history average; must outlive its use here.
+     */
+    void setForecaster(const ForecastModel* model);
+    const ForecastModel* getForecaster() const;
+
+    /**
+     * @brief Makes history predictions cautious with bins that fill unevenly.
+     *
+     * With a positive margin the rate is the larger of the usual rate and the bin's
+     * average daily change, plus `margin` standard deviations of the daily change
+     * (`Bin::getAverageDailyChange`, `Bin::getDailyChangeVariance`, both O(1)). Bins
+     * with a steady fill are predicted as before; erratic ones come up earlier.
+     * @param margin Standard deviations; 0 (default) turns it off.
+     */
+    void setSafetyMargin(double margin);
+    double getSafetyMargin() const;
 
     /**
      * @brief Updates the critical threshold.
      * @param threshold New threshold in days.
      */
     void setCriticalThreshold(int threshold);
+    int getCriticalThreshold() const;
 };
 
 }  // namespace project
\ No newline at end of file
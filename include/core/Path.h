@@ -0,0 +1,103 @@
+/**
+ * @file Path.h
+ * @brief Node-by-node geometry of a driven or planned path.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+namespace project {
+
+/**
+ * @brief Sequence of graph nodes with the total road distance along it.
+ *
+ * Produced by `RoutePlanner::computePath` for one leg; legs are chained with
+ * `appendLeg` to describe a whole day of driving.
+ */
+class Path {
+private:
+    int* nodes;    // Visited nodes in driving order
+    int length;    // Number of nodes
+    int capacity;  // Allocated size of `nodes`
+    int distance;  // Total road distance
+
+    /**
+     * @brief Grows the node array to hold at least `needed` entries.
+     */
+    void reserve(int needed);
+
+public:
+    /**
+     * @brief Constructs an empty path.
+     */
+    Path();
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~Path();
+
+    /**
+     * @brief Copy constructor.
+     */
+    Path(const Path& other);
+
+    /**
+     * @brief Assignment operator.
+     */
+    Path& operator=(const Path& other);
+
+    /**
+     * @brief Appends a node to the end of the path.
+     * @param node Graph node ID.
+     */
+    void addNode(int node);
+
+    /**
+     * @brief Appends a leg and adds its distance.
+     *
+     * The first node of `leg` is skipped when it equals the current last node, so
+     * consecutive legs share their joint.
+     * @param leg Path starting where this one ends.
+     */
+    void appendLeg(const Path& leg);
+
+    /**
+     * @brief Gets the node at a position.
+     * @param position Position in the path (0-based).
+     * @return Node ID, or -1 for an invalid position.
+     */
+    int getNodeAt(int position) const;
+
+    /**
+     * @brief Gets the number of nodes in the path.
+     * @return Path length.
+     */
+    int getLength() const;
+
+    /**
+     * @brief Sets the total distance of the path.
+     * @param value Distance value.
+     */
+    void setDistance(int value);
+
+    /**
+     * @brief Gets the total distance of the path.
+     * @return Distance.
+     */
+    int getDistance() const;
+
+    /**
+     * @brief Checks if the path has no nodes.
+     * @return true if empty.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Removes all nodes and resets the distance (keeps the allocation).
+     */
+    void clear();
+};
+
+}  // namespace project
@@ -0,0 +1,165 @@
+/**
+ * @file PlanningState.h
+ * @brief Compact snapshot of the bins and one truck, used as planning input.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "core/Facilities.h"
+
+namespace project {
+
+class ForecastModel;
+class OverflowPredictor;
+
+/**
+ * @brief Everything a planner reads, copied out of Facilities into flat arrays.
+ *
+ * Planners take the state by const reference and keep their own working copies,
+ * so the real bins and trucks are never touched while a route is planned. The
+ * same state can be planned from by several threads at once.
+ *
+ * The state holds a set of bins (all of them, or a subset such as one truck's
+ * territory) in slots 0 .. getBinCount() - 1. Routes planned on a state index
+ * these slots; `getBinIndex` maps them back to Facilities indices (identical for
+ * a full capture). Buffers are reused, so capturing every day allocates nothing
+ * once the state has grown to the bin count.
+ */
+class PlanningState {
+private:
+    int binCount;
+    int binSlots;        // Allocated entries in the bin arrays
+    int* binIndex;       // Facilities index of each slot
+    int* fills;          // Current fill of each bin
+    int* capacities;     // Capacity of each bin
+    int* nodes;          // Graph node of each bin
+    double* risks;       // Predicted days to overflow (OverflowPredictor risk score)
+    int disposalCount;
+    int disposalSlots;
+    int* disposalNodes;  // Disposal sites in facility order
+    int depotNode;
+    int truckNode;
+    int truckLoad;
+    int truckCapacity;
+    const ForecastModel* forecaster;  // Risks from this model when set (not owned)
+
+    /**
+     * @brief Makes room for at least `count` bins (contents are not kept).
+     * @param count Required bin slots.
+     */
+    void reserveBins(int count);
+
+    /**
+     * @brief Copies one bin into a slot.
+     * @param slot Destination slot.
+     * @param index Facilities index of the bin.
+     * @param facilities System facilities.
+     * @param predictor Predictor giving the risk.
+     */
+    void captureBin(int slot, int index, const Facilities& facilities,
+                    const OverflowPredictor& predictor);
+
+    /**
+     * @brief Copies the depot, disposal sites and one truck.
+     * @param facilities System facilities.
+     * @param truck Truck index.
+     */
+    void captureSites(const Facilities& facilities, int truck);
+
+public:
+    /**
+     * @brief Constructs an empty state (no bins, no sites).
+     */
+    PlanningState();
+
+    /**
+     * @brief Constructs a state holding every bin and one truck.
+     * @param facilities System facilities.
+     * @param truck Truck index.
+     */
+    explicit PlanningState(const Facilities& facilities, int truck = 0);
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~PlanningState();
+
+    /**
+     * @brief Copy constructor.
+     */
+    PlanningState(const PlanningState& other);
+
+    /**
+     * @brief Assignment operator.
+     */
+    PlanningState& operator=(const PlanningState& other);
+
+    /**
+     * @brief Replaces the contents with every bin and one truck.
+     * @param facilities System facilities.
+     * @param truck Truck index.
+     */
+    void capture(const Facilities& facilities, int truck = 0);
+
+    /**
+     * @brief Replaces the contents with some of the bins and one truck.
+     * @param facilities System facilities.
+     * @param truck Truck index.
+     * @param bins Facilities indices of the bins to keep, in slot order.
+     * @param count Number of entries in `bins`.
+     */
+    void capture(const Facilities& facilities, int truck, const int* bins, int count);
+
+    /**
+     * @brief Returns the number of bins in the state.
+     */
+    int getBinCount() const;
+
+    /**
+     * @brief Per-slot bin data.
+     * @param slot Slot (0 .. getBinCount() - 1).
+     */
+    int getBinIndex(int slot) const;
+    int getFill(int slot) const;
+    int getCapacity(int slot) const;
+    int getNode(int slot) const;
+    double getRisk(int slot) const;
+
+    /**
+     * @brief Returns the graph nodes of all bins, one per slot.
+     */
+    const int* getNodes() const;
+
+    /**
+     * @brief Returns the depot node, or -1 without a depot.
+     */
+    int getDepotNode() const;
+
+    /**
+     * @brief Returns the number of disposal sites.
+     */
+    int getDisposalCount() const;
+
+    /**
+     * @brief Returns the disposal site nodes (nullptr when there are none).
+     */
+    const int* getDisposalNodes() const;
+
+    /**
+     * @brief State of the captured truck.
+     */
+    int getTruckNode() const;
+    int getTruckLoad() const;
+    int getTruckCapacity() const;
+
+    /**
+     * @brief Takes the risks of later captures from a forecast model.
+     * @param model Model indexed like the facilities' bins, or nullptr for the
+     *              history average.
+     */
+    void setForecaster(const ForecastModel* model);
+};
+
+}  // namespace project
@@ -13,12 +13,14 @@ namespace project {
  * @brief Represents a planned collection route.
  *
  * A route is a sequence of bin indices that the truck should visit,
- * along with metadata about the route's efficiency.
+ * along with metadata about the route's efficiency. It may also contain
+ * disposal stops, where the truck unloads at a given node before continuing.
  */
 class Route {
 private:
-    int* binIndices;     // Array of bin indices to visit
+    int* binIndices;     // Array of bin indices to visit (disposal stops stored as -(node + 1))
     int length;          // Number of bins in route
+    int capacity;        // Allocated slots in binIndices (grows by doubling)
     int totalDistance;   // Total travel distance
     bool needsDisposal;  // Whether truck needs to visit disposal during route
 
@@ -56,15 +58,51 @@ public:
      */
     void addBin(int binIndex);
 
+    /**
+     * @brief Adds a disposal stop to the end of the route.
+     * @param node Graph node of the disposal facility.
+     * @post `requiresDisposal()` is true.
+     */
+    void addDisposalStop(int node);
+
+    /**
+     * @brief Inserts a bin before a position, shifting later stops back.
+     * @param position Insert position (0 .. getLength(); getLength() appends).
+     * @param binIndex Index of bin to insert.
+     */
+    void insertBin(int position, int binIndex);
+
+    /**
+     * @brief Inserts a disposal stop before a position.
+     * @param position Insert position (0 .. getLength()).
+     * @param node Graph node of the disposal facility.
+     * @post `requiresDisposal()` is true.
+     */
+    void insertDisposalStop(int position, int node);
+
     /**
      * @brief Gets the bin index at a specific position in route.
      * @param position Position in route (0-based).
-     * @return Bin index at that position.
+     * @return Bin index at that position, or -1 for a disposal stop.
      */
     int getBinAt(int position) const;
 
     /**
-     * @brief Gets the number of bins in this route.
+     * @brief Checks whether a position is a disposal stop.
+     * @param position Position in route (0-based).
+     * @return true if the truck unloads there.
+     */
+    bool isDisposalAt(int position) const;
+
+    /**
+     * @brief Gets the disposal node of a disposal stop.
+     * @param position Position in route (0-based).
+     * @return Graph node, or -1 if the position is not a disposal stop.
+     */
+    int getDisposalNodeAt(int position) const;
+
+    /**
+     * @brief Gets the number of stops (bins and disposal stops) in this route.
      * @return Route length.
      */
     int getLength() const;
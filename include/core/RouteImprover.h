@@ -0,0 +1,122 @@
+/**
+ * @file RouteImprover.h
+ * @brief Local-search post-optimizer (2-opt, Or-opt, relocate) for planned routes.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "core/Facilities.h"
+#include "core/PlanningState.h"
+#include "core/Route.h"
+#include "core/RoutePlanner.h"
+
+namespace project {
+
+/**
+ * @brief Shortens a planned route without breaking truck capacity.
+ *
+ * The bins of the route are first split into trips: a disposal stop is inserted
+ * before every bin that would not fit in the truck, and wherever the route already
+ * had one. Local search then applies
+ * improving moves until none is left or the time budget runs out:
+ * - 2-opt: reverse a stretch of one trip;
+ * - Or-opt: move two or three consecutive bins elsewhere, possibly reversed;
+ * - relocate: move a single bin, also into another trip;
+ * - pick the best disposal site for each stop and drop stops whose trips fit together.
+ *
+ * Distances between the route's stops are read once from the planner (O(1) each when
+ * a DistanceMatrix is attached) into a local table. Prefix sums of forward and
+ * backward leg costs make every move's delta O(1) even on one-way streets, and only
+ * positions next to each bin's nearest neighbours are tried.
+ */
+class RouteImprover {
+private:
+    const RoutePlanner& planner;  // distance oracle
+    double timeBudgetMs;          // wall-clock limit per `improve` call
+    int neighborCount;            // candidate neighbours per bin
+
+    // Results of the last `improve` call
+    long long initialDistance;
+    long long finalDistance;
+    int twoOptMoves;
+    int orOptMoves;
+    int relocateMoves;
+    int disposalMoves;
+    double lastMillis;
+
+public:
+    /**
+     * @brief Creates an improver that reads distances from a planner.
+     * @param planner Planner answering `computeDistances`; must outlive the improver.
+     * @param timeBudgetMs Time limit of one `improve` call in milliseconds.
+     * @param neighborCount Nearest bins considered around each stop.
+     */
+    explicit RouteImprover(const RoutePlanner& planner, double timeBudgetMs = 20.0,
+                           int neighborCount = 8);
+
+    /**
+     * @brief Returns an improved copy of a route.
+     *
+     * The truck's current node, load and capacity are read from `state`; the route
+     * ends at the depot. Bin fills are taken as the amounts collected. Disposal stops
+     * already in `route` are kept as trip boundaries (their sites are re-chosen), and
+     * more are added before any bin that would not fit.
+     * @param route Route to improve (bin slots of `state`, in visiting order).
+     * @param state Snapshot the route was planned on.
+     * @return Route with the same bins and explicit disposal stops; its total distance
+     *         is set to the planned driving distance.
+     */
+    Route improve(const Route& route, const PlanningState& state);
+
+    /**
+     * @brief Improves a route of the first truck, reading a snapshot of `facilities`.
+     * @param route Route to improve (bins in visiting order).
+     * @param facilities System facilities (not modified).
+     * @return Improved route, see `improve(const Route&, const PlanningState&)`.
+     */
+    Route improve(const Route& route, Facilities& facilities);
+
+    /**
+     * @brief Sets the time limit of one `improve` call.
+     * @param ms Milliseconds; 0 only splits the route into trips.
+     */
+    void setTimeBudget(double ms);
+
+    /**
+     * @brief Returns the time limit of one `improve` call in milliseconds.
+     */
+    double getTimeBudget() const;
+
+    /**
+     * @brief Sets how many nearest bins are tried around each stop.
+     * @param count Neighbour list length (at least 1).
+     */
+    void setNeighborCount(int count);
+
+    /**
+     * @brief Planned distance of the last route before local search.
+     */
+    long long getInitialDistance() const;
+
+    /**
+     * @brief Planned distance of the last route after local search.
+     */
+    long long getFinalDistance() const;
+
+    /**
+     * @brief Moves applied in the last call, by type.
+     */
+    int getTwoOptMoves() const;
+    int getOrOptMoves() const;
+    int getRelocateMoves() const;
+    int getDisposalMoves() const;
+
+    /**
+     * @brief Wall time of the last call in milliseconds.
+     */
+    double getLastMillis() const;
+};
+
+}  // namespace project
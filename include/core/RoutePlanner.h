@@ -7,11 +7,24 @@
 
 #pragma once
 
+#include <atomic>
+#include <climits>
+
+#include "core/DistanceMatrix.h"
 #include "core/Facilities.h"
+#include "core/LandmarkOracle.h"
+#include "core/NearestDisposalField.h"
 #include "core/OverflowPredictor.h"
+#include "core/Path.h"
+#include "core/PlanningState.h"
 #include "core/Route.h"
+#include "core/ScoringPolicy.h"
+#include "data_structures/ContractionHierarchy.h"
+#include "data_structures/CsrGraph.h"
 #include "data_structures/Graph.h"
+#include "data_structures/IndexedPriorityQueue.hpp"
 #include "data_structures/PriorityQueue.hpp"
+#include "utils/Random.h"
 
 namespace project {
 
@@ -20,44 +33,350 @@ namespace project {
  *
  * Routing decisions balance overflow risk and travel distance through
  * multi-objective optimization to minimize travel while preventing overflows.
+ * Routes are planned on a PlanningState snapshot without touching the real bins
+ * and trucks. Once configured, `planRoute` may run concurrently on any number of
+ * states (or the same one); the only shared state it writes are atomic counters.
  */
 class RoutePlanner {
+public:
+    /**
+     * @brief Algorithm used for point-to-point distance queries.
+     */
+    enum class SearchMode {
+        Dijkstra,       ///< Uninformed search (default)
+        AStar,          ///< Goal-directed search guided by node coordinates
+        Bidirectional,  ///< Dijkstra from both ends, meeting in the middle
+        Landmarks,      ///< A* guided by the attached LandmarkOracle (ALT)
+        Hierarchy       ///< Upward searches in the attached ContractionHierarchy
+    };
+
+    /**
+     * @brief Construction algorithm used by `planRoute`.
+     */
+    enum class PlanningEngine {
+        Greedy,  ///< Repeatedly visit the best-scored bin (default)
+        Savings,   ///< Clarke-Wright savings trips, see SavingsPlanner
+        GiantTour  ///< One tour split optimally into trips, see SplitPlanner
+    };
+
 private:
     const Graph& graph;
+    CsrGraph network;                           // Frozen CSR copy of `graph` used by all searches
+    CsrGraph reverseNetwork;                    // Incoming edges, for backward searches (lazy)
+    const DistanceMatrix* matrix;               // Optional precomputed distances (not owned)
+    const NearestDisposalField* disposalField;  // Optional nearest-disposal labels (not owned)
+    const LandmarkOracle* landmarks;            // Optional ALT lower bounds (not owned)
+    const ContractionHierarchy* hierarchy;      // Optional offline CH index (not owned)
+    SearchMode searchMode;                      // Algorithm for computeDistance graph searches
+    PlanningEngine planningEngine;              // Algorithm behind planRoute
+    std::atomic<long long> candidatesScored;    // Bins considered by selectNextBin
+    std::atomic<long long> candidatesPruned;    // ... of which skipped thanks to lower bounds
     OverflowPredictor predictor;
 
     /**
-     * @brief Calculates priority score for a bin.
+     * @brief Greedy choice of the next bin on a snapshot.
+     *
+     * With a generator, the distance part of every score is scaled by (1 + noise * u)
+     * for a uniform u in [0, 1), and the bin is drawn uniformly from the
+     * `candidateListSize` best noisy scores that share the top bin's risk, so the
+     * urgency order is kept. Lower-bound pruning is skipped then, since it only keeps
+     * the best bin.
+     * @param state Planning input.
+     * @param collected Per-slot flags of bins already on the route.
+     * @param currentNode Truck location.
+     * @param score Scoring policy (see ScoringPolicy.h).
+     * @param distancesFrom Distance oracle for the candidate bins.
+     * @param rng Generator for a randomized choice, or nullptr for the plain greedy one.
+     * @param candidateListSize Restricted candidate list length (randomized only).
+     * @param noise Relative score noise (randomized only).
+     * @return Slot of the chosen reachable non-empty bin, or -1.
+     */
+    template <class Policy, class Oracle>
+    int selectNextBin(const PlanningState& state, const bool* collected, int currentNode,
+                      const Policy& score, const Oracle& distancesFrom, Random* rng = nullptr,
+                      int candidateListSize = 1, double noise = 0.0);
+
+    /**
+     * @brief Greedy construction on a snapshot with a fixed policy and oracle.
+     * @param state Planning input (only read).
+     * @param score Scoring policy.
+     * @param distancesFrom Distance oracle.
+     * @param endNode Set to where the truck would stand afterwards (last bin or site).
+     * @param endLoad Set to the truck's load afterwards.
+     * @param rng Generator for randomized choices, or nullptr (see `selectNextBin`).
+     * @param candidateListSize Restricted candidate list length (randomized only).
+     * @param noise Relative score noise (randomized only).
+     * @return Route over the state's bin slots.
+     */
+    template <class Policy, class Oracle>
+    Route buildGreedy(const PlanningState& state, const Policy& score,
+                      const Oracle& distancesFrom, int& endNode, int& endLoad, Random* rng,
+                      int candidateListSize, double noise);
+
+    /**
+     * @brief Greedy construction on a snapshot; picks the distance oracle.
+     *
+     * Reads the distance matrix directly when it holds every bin, the depot and the
+     * disposal sites, and goes through `computeDistances` otherwise.
+     * @return Route over the state's bin slots (see `buildGreedy`).
+     */
+    template <class Policy>
+    Route planGreedy(const PlanningState& state, const Policy& score, int& endNode,
+                     int& endLoad, Random* rng = nullptr, int candidateListSize = 1,
+                     double noise = 0.0);
+
+    /**
+     * @brief Nearest of some disposal sites (or the attached field's answer).
+     * @param currentNode Current truck location.
+     * @param sites Disposal site nodes.
+     * @param count Number of sites.
+     * @return Node of the nearest site, or -1 if none is reachable.
+     */
+    int nearestDisposal(int currentNode, const int* sites, int count) const;
+
+    /**
+     * @brief One-directional Dijkstra (or A*) over `network`.
+     * @param from The source node (valid).
+     * @param to The destination node (valid).
+     * @param guided Adds the straight-line bound to queue keys (requires coordinates).
+     * @param predecessors Optional output array of size node count: previous node on the
+     *                     shortest path tree, -1 for the source and unreached nodes.
+     * @param settledCount Optional output: number of nodes removed from the queue.
+     * @return The shortest distance, or INT_MAX if unreachable.
+     */
+    int singleSearch(int from, int to, bool guided, int* predecessors, int* settledCount) const;
+
+    /**
+     * @brief Bidirectional Dijkstra over `network` and `reverseNetwork`.
+     * @param from The source node (valid).
+     * @param to The destination node (valid).
+     * @param settledCount Optional output: nodes settled by both searches together.
+     * @return The shortest distance, or INT_MAX if unreachable.
+     */
+    int bidirectionalDistance(int from, int to, int* settledCount) const;
+
+    /**
+     * @brief Drops candidate bins that cannot beat the most promising one.
      *
-     * Combines overflow risk and distance into single score.
-     * Lower score = higher priority.
-     * @param bin Bin to evaluate.
-     * @param distance Distance from current location.
-     * @return Priority score.
+     * Compares each bin's lower-bound score with the exact score of the bin with the
+     * best lower bound. Ties are kept so the final choice does not change.
+     * @param state Planning input.
+     * @param currentNode Truck location.
+     * @param score Scoring policy; must not decrease with the distance.
+     * @param candidates Bin slots; compacted in place.
+     * @param targetNodes Matching bin nodes; compacted in place.
+     * @param candidateCount Number of candidates (at least one).
+     * @return Number of candidates kept.
      */
-    double calculatePriority(const Bin& bin, int distance) const;
+    template <class Policy>
+    int pruneByLowerBound(const PlanningState& state, int currentNode, const Policy& score,
+                          int* candidates, int* targetNodes, int candidateCount);
 
 public:
     /**
      * @brief Constructs a route planner instance.
+     *
+     * Freezes the graph into a CSR layout, so edges added to `graph` afterwards
+     * are not seen by the planner. If the graph keeps a reverse index, the incoming
+     * edges are frozen too; otherwise they are derived on demand.
      * @param graph Reference to the city graph.
      */
     explicit RoutePlanner(const Graph& graph);
 
     /**
-     * @brief Plans a complete collection route for the truck.
+     * @brief Attaches a precomputed distance table.
+     *
+     * Queries between two points of the table are then answered in O(1); all other
+     * queries still run a graph search.
+     * @param distances Table built over this planner's graph, or nullptr to detach.
+     */
+    void setDistanceMatrix(const DistanceMatrix* distances);
+
+    /**
+     * @brief Attaches precomputed nearest-disposal labels.
+     *
+     * `findNearestDisposal` then answers in O(1) from the field instead of searching
+     * to every disposal site.
+     * @param field Field built over this planner's network for the same facilities,
+     *              or nullptr to detach.
+     */
+    void setDisposalField(const NearestDisposalField* field);
+
+    /**
+     * @brief Attaches landmark lower bounds.
+     *
+     * `selectNextBin` then skips the exact search for bins whose best possible score
+     * (lower-bound distance) is already worse than a known candidate, and
+     * SearchMode::Landmarks becomes available.
+     * @param oracle Oracle built over this planner's network, or nullptr to detach.
+     */
+    void setLandmarkOracle(const LandmarkOracle* oracle);
+
+    /**
+     * @brief Attaches a contraction hierarchy built or loaded for this planner's graph.
+     *
+     * SearchMode::Hierarchy then answers searches with it; each thread keeps its own
+     * HierarchyQuery workspace, so no query allocates after the first one.
+     * @param index Hierarchy over the same node ids, or nullptr to detach.
+     */
+    void setHierarchy(const ContractionHierarchy* index);
+
+    /**
+     * @brief Attaches a fill forecast model to the critical-bin checks.
+     * @param model Model indexed like the facilities' bins, or nullptr for the
+     *              history average.
+     */
+    void setForecaster(const ForecastModel* model);
+
+    /**
+     * @brief Returns how many candidate bins `selectNextBin` has scored so far.
+     */
+    long long getCandidatesScored() const;
+
+    /**
+     * @brief Returns how many of those candidates were pruned by lower bounds.
+     */
+    long long getCandidatesPruned() const;
+
+    /**
+     * @brief Selects the algorithm used by `computeDistance` when it has to search.
+     *
+     * A* needs coordinates on every node; without them the planner keeps using Dijkstra.
+     * Selecting Bidirectional builds the reverse CSR graph if it does not exist yet.
+     * Landmarks needs an attached LandmarkOracle and Hierarchy an attached
+     * ContractionHierarchy of the same size; otherwise they search with Dijkstra.
+     * All modes return identical distances.
+     * @param mode Search algorithm.
+     */
+    void setSearchMode(SearchMode mode);
+
+    /**
+     * @brief Returns the configured search algorithm.
+     * @return The search mode.
+     */
+    SearchMode getSearchMode() const;
+
+    /**
+     * @brief Selects the algorithm that builds routes in `planRoute`.
+     *
+     * Greedy follows bin priorities (overflow risk first); Savings ignores them and
+     * minimizes distance, which scales to thousands of bins per day. GiantTour also
+     * minimizes distance and places disposal trips optimally along one tour, which
+     * suits capacity-bound days with many trips. Selecting Savings builds the reverse
+     * CSR graph if it does not exist yet.
+     * @param engine Planning algorithm.
+     */
+    void setPlanningEngine(PlanningEngine engine);
+
+    /**
+     * @brief Returns the configured planning algorithm.
+     * @return The planning engine.
+     */
+    PlanningEngine getPlanningEngine() const;
+
+    /**
+     * @brief Returns the frozen CSR graph the planner searches.
+     * @return Const reference to the CSR graph.
+     */
+    const CsrGraph& getNetwork() const;
+
+    /**
+     * @brief Returns the incoming-edge CSR graph used by backward searches.
+     * @return Const reference; empty until the graph keeps a reverse index or the
+     *         Bidirectional search mode or Savings engine is selected.
+     */
+    const CsrGraph& getReverseNetwork() const;
+
+    /**
+     * @brief Returns the attached distance matrix.
+     * @return The matrix, or nullptr if none is attached.
+     */
+    const DistanceMatrix* getDistanceMatrix() const;
+
+    /**
+     * @brief Checks whether the distance matrix holds every point of a snapshot.
+     * @param state Snapshot whose bins, depot and disposal sites are checked.
+     * @return `true` if a matrix is attached and contains all of them.
+     */
+    bool matrixCovers(const PlanningState& state) const;
+
+    /**
+     * @brief Plans a complete collection route for the captured truck.
      *
      * Considers truck capacity, bin priorities, and disposal facility locations
-     * to create an efficient multi-bin route.
+     * to create an efficient multi-bin route, starting at the depot with the truck's
+     * current load. Delegates to SavingsPlanner or SplitPlanner when the Savings or
+     * GiantTour engine is selected.
+     * The state is only read.
+     * @param state Snapshot of the bins and the truck.
+     * @return Route over the state's bin slots.
+     */
+    Route planRoute(const PlanningState& state);
+
+    /**
+     * @brief Plans a route for the first truck and performs it on `facilities`.
+     *
+     * Plans on a snapshot, then empties the planned bins and leaves the truck where
+     * and as loaded as the planner left it (at a disposal site when the last step was
+     * an unload). The Savings and GiantTour engines perform their route with
+     * `applyRoute`.
      * @param facilities The system's physical facilities and assets.
      * @return Route object containing sequence of bins to visit.
      */
     Route planRoute(Facilities& facilities);
 
+    /**
+     * @brief Greedy route with a caller-chosen scoring policy.
+     *
+     * Same construction as the Greedy engine (whatever engine is selected), with the
+     * policy inlined into the candidate loop; `planRoute(state)` is this call with
+     * RiskFirstScoring. Safe to call concurrently, like `planRoute`.
+     * @param state Snapshot of the bins and the truck (only read).
+     * @param score Scoring policy, e.g. NearestFirstScoring or WeightedScoring.
+     * @return Route over the state's bin slots.
+     */
+    template <class Policy>
+    Route planRoute(const PlanningState& state, const Policy& score) {
+        int endNode = 0;
+        int endLoad = 0;
+        return planGreedy(state, score, endNode, endLoad);
+    }
+
+    /**
+     * @brief One randomized greedy construction (a start of MultiStartPlanner).
+     *
+     * Like the greedy engine, but each step scales the distance part of every score
+     * by up to (1 + noise) and draws the next bin from the `candidateListSize` best
+     * scores of equal risk. Equal seeds and inputs give equal routes. With a list of
+     * one and no noise this is the greedy route. Safe to call concurrently, like
+     * `planRoute`.
+     * @param state Snapshot of the bins and the truck (only read).
+     * @param seed Random seed.
+     * @param candidateListSize Bins the choice is drawn from (at least 1).
+     * @param noise Relative distance noise, e.g. 0.2 for up to +20%.
+     * @return Route over the state's bin slots.
+     */
+    Route planRandomizedGreedy(const PlanningState& state, unsigned int seed,
+                               int candidateListSize, double noise);
+
+    /**
+     * @brief Performs a planned route's collections on the first truck.
+     *
+     * The truck starts at the depot, unloads at every disposal stop and, like the
+     * planners, at the nearest site before a bin that would not fit.
+     * @param route Route over Facilities bin indices.
+     * @param facilities System facilities (bins and the first truck are modified).
+     */
+    void applyRoute(const Route& route, Facilities& facilities) const;
+
     /**
      * @brief Selects the next single bin for the truck to visit.
      *
      * Greedy selection based on priority score (overflow risk + distance).
+     * Distances to all candidate bins come from one one-to-many search. With a
+     * LandmarkOracle attached, bins whose lower-bound score exceeds the exact score
+     * of the most promising bin are dropped from that search first; the choice is
+     * unchanged.
      * @param facilities The system's physical facilities and assets.
      * @return The index of the selected bin. Returns -1 if no bin needs collection.
      */
@@ -65,28 +384,285 @@ public:
 
     /**
      * @brief Finds the nearest disposal facility from current location.
+     *
+     * O(1) when a NearestDisposalField is attached.
      * @param currentNode Current truck location.
      * @param facilities System facilities.
      * @return Node ID of nearest disposal facility, or -1 if none found.
      */
     int findNearestDisposal(int currentNode, const Facilities& facilities) const;
 
+    /**
+     * @brief Finds the nearest disposal site of a planning snapshot.
+     * @param currentNode Current truck location.
+     * @param state Snapshot holding the disposal sites.
+     * @return Node ID of nearest disposal facility, or -1 if none found.
+     */
+    int findNearestDisposal(int currentNode, const PlanningState& state) const;
+
     /**
      * @brief Computes the shortest path distance between two nodes.
      *
-     * Uses Dijkstra's algorithm with custom PriorityQueue.
+     * Answered from the attached DistanceMatrix when both nodes are in it, otherwise
+     * searches the CSR graph with an indexed heap (decrease-key) using the selected
+     * search mode (A* only when the graph has coordinates).
      * @param from The source node.
      * @param to The destination node.
-     * @return The shortest distance value between the two nodes.
+     * @return The shortest distance value between the two nodes, or INT_MAX if
+     *         `to` is unreachable or either node is invalid.
      */
     int computeDistance(int from, int to) const;
 
+    /**
+     * @brief Computes a shortest path together with the nodes it passes through.
+     *
+     * Always searches the graph (the distance matrix holds no geometry), recording
+     * predecessors; A* is used when selected and coordinates exist. Use a LegCache
+     * to avoid repeating the search for legs driven again.
+     * @param from The source node.
+     * @param to The destination node.
+     * @param path Output: nodes from `from` to `to` inclusive and the distance; left
+     *             empty (distance INT_MAX) when unreachable or invalid.
+     * @return The shortest distance, or INT_MAX if unreachable or invalid.
+     */
+    int computePath(int from, int to, Path& path) const;
+
+    /**
+     * @brief Runs one point-to-point graph search, bypassing the distance matrix.
+     *
+     * The heuristic of A* is the straight-line distance scaled so it never exceeds
+     * the weight of any edge, which keeps the result exact. Bidirectional runs only
+     * after `setSearchMode(SearchMode::Bidirectional)` prepared the reverse graph and
+     * falls back to Dijkstra before that; Hierarchy likewise needs `setHierarchy`.
+     * @param from The source node.
+     * @param to The destination node.
+     * @param mode Search algorithm; AStar falls back to Dijkstra without coordinates.
+     * @param settledCount Optional output: number of nodes removed from the queue.
+     * @return The shortest distance, or INT_MAX if unreachable or invalid.
+     */
+    int searchDistance(int from, int to, SearchMode mode, int* settledCount = nullptr) const;
+
+    /**
+     * @brief Computes shortest path distances from one source to many targets.
+     *
+     * Runs a single Dijkstra search that stops as soon as every target node has
+     * been settled, instead of one search per target. In SearchMode::Hierarchy the
+     * source's upward space is searched once and each target gets a pruned backward
+     * search instead.
+     * @param from The source node.
+     * @param targets Array of target node IDs (duplicates allowed).
+     * @param targetCount Number of entries in `targets`.
+     * @param distances Output array of size `targetCount`; INT_MAX for unreachable
+     *                  or invalid targets.
+     */
+    void computeDistances(int from, const int* targets, int targetCount, int* distances) const;
+
     /**
      * @brief Checks if any bins require immediate attention.
      * @param facilities System facilities.
      * @return true if any bin is critical (near overflow).
      */
     bool hasCriticalBins(const Facilities& facilities) const;
+
+    /**
+     * @brief Checks one bin with the same predictor as `hasCriticalBins`.
+     * @param bin Bin to check.
+     * @param index Facilities index of the bin (-1 ignores an attached forecaster).
+     * @return true if the bin is critical (near overflow).
+     */
+    bool isCriticalBin(const Bin& bin, int index = -1) const;
+
+    /**
+     * @brief Returns the predictor behind `hasCriticalBins` and `isCriticalBin`.
+     */
+    const OverflowPredictor& getPredictor() const;
 };
 
+// Şablon üyeler: politika ve mesafe kaynağı derleme zamanında bilinir, skor satır içi
+
+// Alt sınır (lower bound) ile kazanamayacak bin'leri aramadan önce ele
+template <class Policy>
+int RoutePlanner::pruneByLowerBound(const PlanningState& state, int currentNode,
+                                    const Policy& score, int* candidates, int* targetNodes,
+                                    int candidateCount) {
+    double* bestPossible = new double[candidateCount];
+    int mostPromising = 0;
+    for (int k = 0; k < candidateCount; k++) {
+        int bound = landmarks->lowerBound(currentNode, targetNodes[k]);
+        bestPossible[k] = score(state.getRisk(candidates[k]), bound);
+        if (bestPossible[k] < bestPossible[mostPromising])
+            mostPromising = k;
+    }
+
+    // En umut verici bin'in gerçek skoru; bunu aşan alt sınırlar asla kazanamaz
+    int exact = computeDistance(currentNode, targetNodes[mostPromising]);
+    double limit = score(state.getRisk(candidates[mostPromising]), exact);
+
+    int kept = 0;
+    for (int k = 0; k < candidateCount; k++) {
+        if (bestPossible[k] <= limit) {  // eşitlikte tut: index sırasına göre seçim değişmesin
+            candidates[kept] = candidates[k];
+            targetNodes[kept] = targetNodes[k];
+            kept++;
+        }
+    }
+    candidatesPruned += candidateCount - kept;
+
+    delete[] bestPossible;
+    return kept;
+}
+
+template <class Policy, class Oracle>
+int RoutePlanner::selectNextBin(const PlanningState& state, const bool* collected,
+                                int currentNode, const Policy& score,
+                                const Oracle& distancesFrom, Random* rng,
+                                int candidateListSize, double noise) {
+    int binCount = state.getBinCount();
+    if (binCount == 0)
+        return -1;
+
+    // Boş olmayan bin'leri topla, hepsine tek Dijkstra ile mesafe hesapla
+    int* candidates = new int[binCount];
+    int* targetNodes = new int[binCount];
+    int* distances = new int[binCount];
+    int candidateCount = 0;
+
+    for (int i = 0; i < binCount; i++) {
+        if (state.getFill(i) == 0 || (collected != nullptr && collected[i]))
+            continue;  // eğer bin boşsa (ya da rotada zaten toplandıysa) atla
+
+        candidates[candidateCount] = i;
+        targetNodes[candidateCount] = state.getNode(i);
+        candidateCount++;
+    }
+
+    candidatesScored += candidateCount;
+    if (landmarks != nullptr && candidateCount > 1 && rng == nullptr)
+        candidateCount = pruneByLowerBound(state, currentNode, score, candidates, targetNodes,
+                                           candidateCount);
+
+    distancesFrom(currentNode, targetNodes, candidateCount, distances);
+
+    double bestScore = INT_MAX;
+    int bestIndex = -1;
+
+    if (rng != nullptr) {
+        // Rastgele seçim: gürültülü skorlara göre en iyi k bin (sıralı), biri rastgele
+        int listSize = candidateListSize > 1 ? candidateListSize : 1;
+        double* listScores = new double[listSize];
+        int* listBins = new int[listSize];
+        int listed = 0;
+        for (int k = 0; k < candidateCount; k++) {
+            double noisy = score(state.getRisk(candidates[k]), distances[k]);
+            if (noisy >= INT_MAX)
+                continue;  // ulaşılamaz, plain greedy de seçmez
+            noisy += distances[k] * noise * rng->unit();  // gürültü yalnızca mesafe payına
+            if (listed == listSize && noisy >= listScores[listed - 1])
+                continue;
+            int at = listed < listSize ? listed++ : listed - 1;
+            while (at > 0 && listScores[at - 1] > noisy) {
+                listScores[at] = listScores[at - 1];
+                listBins[at] = listBins[at - 1];
+                at--;
+            }
+            listScores[at] = noisy;
+            listBins[at] = candidates[k];
+        }
+        // Liste yalnızca en iyiyle aynı aciliyetteki bin'lerden oluşur
+        int sameRisk = 0;
+        while (sameRisk < listed &&
+               state.getRisk(listBins[sameRisk]) == state.getRisk(listBins[0]))
+            sameRisk++;
+        if (listed > 0)
+            bestIndex = listBins[rng->below(sameRisk)];
+        delete[] listScores;
+        delete[] listBins;
+    } else {
+        for (int k = 0; k < candidateCount; k++) {
+            // bin'in öncelik skoru hesaplanır
+            double candidateScore = score(state.getRisk(candidates[k]), distances[k]);
+
+            if (candidateScore < bestScore) {  // daha öncelikli var mı kontrol edilir
+                bestScore = candidateScore;
+                bestIndex = candidates[k];
+            }
+        }
+    }
+
+    delete[] candidates;
+    delete[] targetNodes;
+    delete[] distances;
+
+    return bestIndex;
+}
+
+template <class Policy, class Oracle>
+Route RoutePlanner::buildGreedy(const PlanningState& state, const Policy& score,
+                                const Oracle& distancesFrom, int& endNode, int& endLoad,
+                                Random* rng, int candidateListSize, double noise) {
+    Route route;  // Initialize an empty route
+    int binCount = state.getBinCount();
+    bool* collected = new bool[binCount > 0 ? binCount : 1];  // anlık görüntü değişmez
+    for (int i = 0; i < binCount; i++) {
+        collected[i] = false;
+    }
+
+    // Truck’ın başlangıç noktası olan depot node’u; yük truck’ın mevcut yükü
+    int currentNode = state.getDepotNode();
+    int load = state.getTruckLoad();
+    int capacity = state.getTruckCapacity();
+
+    while (true) {
+        int nextBinIndex = selectNextBin(state, collected, currentNode, score, distancesFrom,
+                                         rng, candidateListSize, noise);
+        if (nextBinIndex == -1)
+            break;
+
+        int fill = state.getFill(nextBinIndex);
+
+        // Boş truck'a bile sığmayan bin atlanır; önce boşaltmaya gitmek boşuna yol olur
+        if (fill > capacity) {
+            collected[nextBinIndex] = true;
+            continue;
+        }
+
+        // Check capacity
+        if (fill > capacity - load) {
+            int disposalNode =  // Mevcut konuma göre en yakın boşaltma tesisi node’u
+                findNearestDisposal(currentNode, state);
+            if (disposalNode == -1) {
+                collected[nextBinIndex] = true;  // boşaltılamıyor: atla, tekrar seçilmesin
+                continue;
+            }
+            route.setNeedsDisposal(true);  // Bu rotada boşaltma yapılacağını belirtir
+            currentNode = disposalNode;
+            load = 0;
+            continue;
+        }
+
+        // Visit bin
+        route.addBin(nextBinIndex);        // Bin rota listesine eklenir
+        load += fill;                      // Bin’deki mevcut atık truck’a yüklenir
+        currentNode = state.getNode(nextBinIndex);  // Truck bin’in bulunduğu node’a gider
+        collected[nextBinIndex] = true;             // Bin’in içi boşaltılır (fill = 0)
+    }
+
+    delete[] collected;
+    endNode = currentNode;
+    endLoad = load;
+    return route;
+}
+
+template <class Policy>
+Route RoutePlanner::planGreedy(const PlanningState& state, const Policy& score, int& endNode,
+                               int& endLoad, Random* rng, int candidateListSize,
+                               double noise) {
+    // Tablo her noktayı içeriyorsa sorgu başına üyelik kontrolü olmadan doğrudan okunur
+    if (matrixCovers(state))
+        return buildGreedy(state, score, MatrixDistances(*matrix), endNode, endLoad, rng,
+                           candidateListSize, noise);
+    return buildGreedy(state, score, PlannerDistances(*this), endNode, endLoad, rng,
+                       candidateListSize, noise);
+}
+
 }  // namespace project
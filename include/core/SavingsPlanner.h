@@ -0,0 +1,110 @@
+/**
+ * @file SavingsPlanner.h
+ * @brief Clarke-Wright savings construction of the daily collection route.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "core/Facilities.h"
+#include "core/PlanningState.h"
+#include "core/Route.h"
+
+namespace project {
+
+class RoutePlanner;
+
+/**
+ * @brief Parallel Clarke-Wright savings planner for a truck that unloads between trips.
+ *
+ * Every bin starts as its own depot round trip. Joining the trip ending at bin `i`
+ * with the trip starting at bin `j` saves `d(i, depot) + d(depot, j) - d(i, j)`;
+ * the savings list is computed once, sorted, and merges are applied in order while
+ * the joined trip still fits in the truck. Several trips grow at the same time
+ * (the "parallel" variant), which gives far better routes than growing one at a time.
+ *
+ * Savings are only computed between each bin and its nearest bins, found with
+ * bounded graph searches spread over a thread pool; that keeps the list O(n * K)
+ * instead of O(n^2) for large instances. The finished trips are chained from the
+ * depot, nearest trip first, and the truck unloads at the nearest disposal site
+ * whenever the next trip would not fit, just like the greedy planner does.
+ */
+class SavingsPlanner {
+private:
+    const RoutePlanner& planner;  // distance oracle and road graph
+    int neighborCount;            // savings computed per bin
+    int threadCount;              // workers for the neighbour searches (0 = hardware)
+
+    // Results of the last `plan` call
+    int savingsCount;
+    int mergeCount;
+    int tripCount;
+    double lastMillis;
+
+public:
+    /**
+     * @brief Creates a savings planner on top of a route planner.
+     * @param planner Planner providing distances; must outlive this object.
+     * @param neighborCount Nearest bins paired with each bin in the savings list.
+     * @param threads Worker threads for the neighbour searches (0 = hardware count,
+     *                1 = run on the calling thread).
+     */
+    explicit SavingsPlanner(const RoutePlanner& planner, int neighborCount = 20, int threads = 0);
+
+    /**
+     * @brief Plans a complete collection route for the captured truck.
+     *
+     * Same contract as `RoutePlanner::planRoute(const PlanningState&)`: every
+     * non-empty bin reachable from the depot is on the route, except trips the truck
+     * can no longer reach. The state is only read.
+     * @param state Snapshot of the bins and the truck.
+     * @return Route over the state's bin slots, in visiting order, with explicit
+     *         disposal stops.
+     */
+    Route plan(const PlanningState& state);
+
+    /**
+     * @brief Plans a route for the first truck and performs it on `facilities`.
+     *
+     * Like `RoutePlanner::planRoute(Facilities&)`: bins are emptied and the truck is
+     * moved and loaded.
+     * @param facilities The system's physical facilities and assets.
+     * @return Route with bins in visiting order and explicit disposal stops.
+     */
+    Route plan(Facilities& facilities);
+
+    /**
+     * @brief Sets how many nearest bins each bin is paired with.
+     * @param count Neighbour count (at least 1).
+     */
+    void setNeighborCount(int count);
+
+    /**
+     * @brief Sets the worker count for the neighbour searches.
+     * @param threads Worker threads (0 = hardware count).
+     */
+    void setThreadCount(int threads);
+
+    /**
+     * @brief Positive savings considered by the last call.
+     */
+    int getSavingsCount() const;
+
+    /**
+     * @brief Trip merges applied by the last call.
+     */
+    int getMergeCount() const;
+
+    /**
+     * @brief Trips (disposal stops + 1) in the last route.
+     */
+    int getTripCount() const;
+
+    /**
+     * @brief Wall time of the last call in milliseconds.
+     */
+    double getLastMillis() const;
+};
+
+}  // namespace project
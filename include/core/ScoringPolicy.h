@@ -0,0 +1,99 @@
+/**
+ * @file ScoringPolicy.h
+ * @brief Bin scoring policies and distance oracles for the greedy route planner.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * `RoutePlanner::planRoute(state, policy)` is a template over both, so the score is
+ * computed inline in the candidate loop instead of through a function pointer.
+ *
+ * A scoring policy is any copyable type with
+ * `double operator()(double risk, int distance) const`; lower scores are visited
+ * first. `risk` is PlanningState::getRisk (days until overflow, 0 when overflowing) and
+ * `distance` is INT_MAX for unreachable bins. Scores of INT_MAX or more are never
+ * chosen, so a policy must keep unreachable bins there, and it must not decrease when
+ * the distance grows, since landmark pruning scores lower-bound distances.
+ *
+ * A distance oracle is any type with
+ * `void operator()(int from, const int* targets, int count, int* distances) const`,
+ * answering like `RoutePlanner::computeDistances`.
+ */
+
+#pragma once
+
+#include <climits>
+
+#include "core/DistanceMatrix.h"
+
+namespace project {
+
+class RoutePlanner;
+
+/**
+ * @brief Overflow risk first, distance as tie-breaker (the planner's default).
+ */
+struct RiskFirstScoring {
+    double operator()(double risk, int distance) const {
+        // 1000 > en uzun mesafe: bir günlük risk farkı her zaman mesafeden ağır basar
+        return risk * 1000 + distance;
+    }
+};
+
+/**
+ * @brief Nearest bin first; ignores overflow risk.
+ */
+struct NearestFirstScoring {
+    double operator()(double, int distance) const { return distance; }
+};
+
+/**
+ * @brief Linear trade-off between risk and distance.
+ *
+ * With `riskWeight` 1000 this is RiskFirstScoring; smaller weights let a close bin
+ * go before a slightly more urgent one far away.
+ */
+struct WeightedScoring {
+    double riskWeight;      ///< Score per day until overflow (non-negative)
+    double distanceWeight;  ///< Score per distance unit (positive)
+
+    explicit WeightedScoring(double riskWeight, double distanceWeight = 1.0)
+        : riskWeight(riskWeight), distanceWeight(distanceWeight) {}
+
+    double operator()(double risk, int distance) const {
+        if (distance == INT_MAX)
+            return distance;  // ağırlık < 1 olsa da ulaşılamaz kalsın
+        return riskWeight * risk + distanceWeight * distance;
+    }
+};
+
+/**
+ * @brief Distance oracle reading a DistanceMatrix directly.
+ *
+ * Skips the per-query membership checks of `RoutePlanner::computeDistances`, so the
+ * matrix must contain the source and every target.
+ */
+struct MatrixDistances {
+    const DistanceMatrix& matrix;
+
+    explicit MatrixDistances(const DistanceMatrix& matrix) : matrix(matrix) {}
+
+    void operator()(int from, const int* targets, int count, int* distances) const {
+        for (int i = 0; i < count; i++) {
+            distances[i] = matrix.lookup(from, targets[i]);
+        }
+    }
+};
+
+/**
+ * @brief Distance oracle forwarding to `RoutePlanner::computeDistances` (matrix when
+ *        it covers the query, one-to-many search otherwise).
+ */
+struct PlannerDistances {
+    const RoutePlanner& planner;
+
+    explicit PlannerDistances(const RoutePlanner& planner) : planner(planner) {}
+
+    void operator()(int from, const int* targets, int count, int* distances) const;
+};
+
+}  // namespace project
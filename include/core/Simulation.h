@@ -7,8 +7,23 @@
 
 #pragma once
 
+#include "core/CriticalBinIndex.h"
+#include "core/DistanceMatrix.h"
+#include "core/EmergencyRescheduler.h"
 #include "core/Facilities.h"
+#include "core/FillForecaster.h"
+#include "core/FleetPlanner.h"
+#include "core/HorizonPlanner.h"
+#include "core/LandmarkOracle.h"
+#include "core/LegCache.h"
+#include "core/LnsPlanner.h"
+#include "core/MultiStartPlanner.h"
+#include "core/NearestDisposalField.h"
+#include "core/Path.h"
+#include "core/PlanningState.h"
+#include "core/RouteImprover.h"
 #include "core/RoutePlanner.h"
+#include "core/SmoothingForecaster.h"
 #include "data_structures/Graph.h"
 
 namespace project {
@@ -24,6 +39,20 @@ private:
     Graph& graph;
     Facilities& facilities;
     RoutePlanner planner;
+    DistanceMatrix distances;            // Bin/depot/disposal distances, built once per run
+    NearestDisposalField disposalField;  // Nearest disposal site for every node
+    LandmarkOracle landmarks;            // Lower bounds for pruning when there is no matrix
+    LegCache legs;                       // Geometry of every leg driven so far
+    Path dayPath;                        // Nodes driven during the last step
+    PlanningState state;                 // Snapshot the day's route is planned on (reused)
+    MultiStartPlanner multiStart;        // Optional best-of-N randomized greedy (1 = off)
+    HorizonPlanner horizon;              // Optional choice of today's bins (off by default)
+    LnsPlanner lns;                      // Optional destroy-and-repair before local search
+    RouteImprover improver;              // Local search applied to every daily route
+    EmergencyRescheduler rescheduler;    // Inserts critical bins into the day's routes
+    FillForecaster forecaster;           // Optional seasonal overflow forecast (off by default)
+    SmoothingForecaster smoothing;       // Optional flat smoothed forecast (off by default)
+    CriticalBinIndex criticalIndex;      // Optional heap of overflow days instead of a scan
     int currentTime;
     int maxTime;  // Total simulation duration (e.g., 7 days)
 
@@ -31,15 +60,55 @@ private:
     int overflowCount;
     int totalDistance;
     int collectionsCompleted;
+    long long plannedDistanceBefore;  // Sum of planned daily distances before local search
+    long long plannedDistanceAfter;   // ... and after it
+    int emergencyInsertions;          // Critical bins added to planned routes
+    long long emergencyLookups;       // Distance lookups those insertions needed
+    long long deferredBinDays;        // Non-empty bins left for a later day, summed over days
+    int earlyCollections;             // Optional bins the horizon planner added on the way
+    FleetPlanner* fleet;              // Per-truck territories; nullptr for a single truck
+    int* truckDistance;               // Distance driven by each truck
+    int* truckCollections;            // Collections made by each truck
 
     // Initial state storage for reset
     int* initialBinFills;
-    int initialTruckLoad;
-    int initialTruckNode;
+    int* initialTruckLoads;
+    int* initialTruckNodes;
+
+    /**
+     * @brief Builds the distance matrix over all bins, the depot and disposal sites.
+     * @post The planner answers distances between those nodes from the matrix.
+     */
+    void buildDistanceMatrix();
+
+    /**
+     * @brief Drives one leg: looks up its geometry and appends it to the day's path.
+     * @param from Current truck node.
+     * @param to Destination node.
+     * @param record Appends the leg to the day's path (only the first truck's legs are).
+     * @return Leg distance, or INT_MAX if unreachable (nothing is appended then).
+     */
+    int drive(int from, int to, bool record = true);
+
+    /**
+     * @brief Drives a planned route with one truck, collecting and unloading on the way.
+     *
+     * Unloads early when the truck fills up and returns to the depot at the end.
+     * @param truckIndex Truck that drives the route.
+     * @param route Route with global bin indices and disposal stops.
+     * @post Distance and collections are added to the totals and to the truck's own.
+     */
+    void executeRoute(int truckIndex, const Route& route);
+
+    static const int LANDMARK_COUNT = 8;  // landmarks built when the matrix is unavailable
 
 public:
     /**
      * @brief Constructs a simulation instance.
+     *
+     * Precomputes the distance matrix between all points of interest; the road
+     * graph must not change afterwards. With more than one truck the bins are split
+     * into territories and every truck's route is planned in parallel each day.
      * @param graph Reference to the city graph.
      * @param facilities Reference to the physical facilities.
      * @param duration Total simulation days (default 7 for one week).
@@ -57,7 +126,7 @@ public:
      * Each step:
      * 1. Updates all bin fill levels
      * 2. Records fill history for predictions
-     * 3. Plans collection route
+     * 3. Plans collection route and shortens it with local search
      * 4. Executes truck movements and collections
      * 5. Handles disposal trips when truck is full
      * 6. Tracks overflow events
@@ -96,19 +165,16 @@ public:
      */
     Facilities& getFacilities();
 
-    /**
-     * @brief Checks for overflow events and updates counter.
-     * @post Increments overflowCount for each bin at or over capacity.
-     */
-    void checkOverflows();
-
     /**
      * @brief Handles dynamic rescheduling when critical bins detected.
      *
-     * Called when sensor data indicates unexpected rapid filling.
-     * Adjusts current route to prioritize critical bins.
+     * Called when sensor data indicates unexpected rapid filling. Critical bins
+     * missing from the day's routes are inserted into their truck's route at the
+     * cheapest feasible position (most urgent first) instead of planning again.
+     * @param routes Planned route of each truck; modified in place.
+     * @param truckCount Number of routes.
      */
-    void handleEmergencyReschedule();
+    void handleEmergencyReschedule(Route* routes, int truckCount);
 
     // Performance metrics getters
 
@@ -130,6 +196,149 @@ public:
      */
     int getCollectionsCompleted() const;
 
+    /**
+     * @brief Gets the number of critical bins inserted into planned routes.
+     * @return Insertion count.
+     */
+    int getEmergencyInsertions() const;
+
+    /**
+     * @brief Gets the non-empty bins the horizon planner left for later, summed over days.
+     * @return Deferred bin-days.
+     */
+    long long getDeferredBinDays() const;
+
+    /**
+     * @brief Gets the bins the horizon planner collected before they were due.
+     * @return Early collection count.
+     */
+    int getEarlyCollections() const;
+
+    /**
+     * @brief Returns the precomputed distance matrix.
+     * @return Const reference to the matrix.
+     */
+    const DistanceMatrix& getDistanceMatrix() const;
+
+    /**
+     * @brief Gets the distance driven by one truck.
+     * @param truck Truck index.
+     * @return Distance, or 0 for an invalid index.
+     */
+    int getTruckDistance(int truck) const;
+
+    /**
+     * @brief Gets the number of collections made by one truck.
+     * @param truck Truck index.
+     * @return Collection count, or 0 for an invalid index.
+     */
+    int getTruckCollections(int truck) const;
+
+    /**
+     * @brief Returns the fleet planner.
+     * @return Planner with the truck territories, or nullptr for a single truck.
+     */
+    const FleetPlanner* getFleetPlanner() const;
+
+    /**
+     * @brief Selects the algorithm that plans each day's route.
+     * @param engine Planning algorithm (greedy by default).
+     */
+    void setPlanningEngine(RoutePlanner::PlanningEngine engine);
+
+    /**
+     * @brief Answers the planner's graph searches with a contraction hierarchy.
+     *
+     * Pairs outside the distance matrix then cost two small upward searches instead
+     * of a Dijkstra over the whole network; distances stay the same.
+     * @param index Hierarchy built or loaded for this simulation's graph (not owned),
+     *              or nullptr to go back to Dijkstra.
+     */
+    void setHierarchy(const ContractionHierarchy* index);
+
+    /**
+     * @brief Returns the local-search stage applied to each daily route.
+     *
+     * Use `setTimeBudget(0)` to keep the greedy order (trips are still split
+     * with explicit disposal stops).
+     * @return Reference to the improver.
+     */
+    RouteImprover& getRouteImprover();
+
+    /**
+     * @brief Returns the large-neighborhood search stage run before local search.
+     *
+     * Disabled until a time budget or iteration limit is set, e.g.
+     * `getLnsPlanner().setTimeBudget(200)` for 200 ms per day. Single-truck runs only.
+     * @return Reference to the LNS planner.
+     */
+    LnsPlanner& getLnsPlanner();
+
+    /**
+     * @brief Returns the multi-start stage that replaces the single greedy construction.
+     *
+     * Disabled with one start (the default); e.g. `getMultiStartPlanner().setStarts(16)`
+     * keeps the best of 16 randomized greedy routes each day. Greedy engine and
+     * single-truck runs only.
+     * @return Reference to the multi-start planner.
+     */
+    MultiStartPlanner& getMultiStartPlanner();
+
+    /**
+     * @brief Returns the rolling-horizon selector of each day's bins.
+     *
+     * Disabled by default (every non-empty bin is planned). With
+     * `getHorizonPlanner().setEnabled(true)` bins that can wait are deferred.
+     * Single-truck runs only.
+     * @return Reference to the horizon planner.
+     */
+    HorizonPlanner& getHorizonPlanner();
+
+    /**
+     * @brief Returns the Holt-Winters forecast of the bins' daily inflow.
+     *
+     * Disabled by default (overflow is predicted from the fill history). With
+     * `getForecaster().setEnabled(true)` every step feeds it the day's inflow and
+     * critical checks, risks and the horizon selection use its weekly forecast.
+     * @return Reference to the forecaster.
+     */
+    FillForecaster& getForecaster();
+
+    /**
+     * @brief Returns the exponentially smoothed forecast of the bins' daily inflow.
+     *
+     * Disabled by default. Enabled like `getForecaster()`, which wins when both are.
+     * @return Reference to the model.
+     */
+    SmoothingForecaster& getSmoothingForecaster();
+
+    /**
+     * @brief Returns the index of bins by predicted overflow day.
+     *
+     * Disabled by default (every bin is predicted each day to find critical ones).
+     * With `getCriticalIndex().setEnabled(true)` the daily check and the emergency
+     * reschedule read the heap instead. Keys come from the planner's predictor
+     * (history average or the enabled forecast model), so the index finds the same
+     * critical bins as the scan. The daily fill pass re-keys bins whose predicted
+     * day moved, and collections re-key the collected bins.
+     * @return Reference to the index.
+     */
+    CriticalBinIndex& getCriticalIndex();
+
+    /**
+     * @brief Returns every node the (first) truck drove through during the last step.
+     *
+     * Includes emergency reschedules; consecutive legs share their joint node.
+     * @return Path of the last day (empty before the first step).
+     */
+    const Path& getDayPath() const;
+
+    /**
+     * @brief Returns the cache of driven legs.
+     * @return Const reference to the cache.
+     */
+    const LegCache& getLegCache() const;
+
     /**
      * @brief Prints simulation statistics and results.
      */
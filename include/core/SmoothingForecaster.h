@@ -0,0 +1,99 @@
+/**
+ * @file SmoothingForecaster.h
+ * @brief Simple exponential smoothing of each bin's daily inflow.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "core/Facilities.h"
+#include "core/ForecastModel.h"
+
+namespace project {
+
+/**
+ * @brief One smoothed inflow level per bin, no trend and no season.
+ *
+ * Each observed day moves the level towards the amount added:
+ *
+ *     level = a y + (1 - a) level
+ *
+ * Recent days weigh more than in the 7-day history average, so a bin whose use
+ * changes is followed within a few days, but weekly peaks are smoothed away (use
+ * `FillForecaster` for those). A bin's state is one float; an update is O(1) and
+ * days to overflow are one division.
+ */
+class SmoothingForecaster : public ForecastModel {
+private:
+    float* levels;
+    int binCount;
+    double alpha;
+    bool enabled;
+
+public:
+    /**
+     * @brief Creates an empty, disabled model.
+     * @param alpha Level smoothing (0-1).
+     */
+    explicit SmoothingForecaster(double alpha = 0.3);
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~SmoothingForecaster() override;
+
+    SmoothingForecaster(const SmoothingForecaster&) = delete;
+    SmoothingForecaster& operator=(const SmoothingForecaster&) = delete;
+
+    /**
+     * @brief Starts every bin at its configured fill rate.
+     * @param facilities Facilities holding the bins.
+     */
+    void load(const Facilities& facilities);
+
+    /**
+     * @brief Starts `count` bins at a zero level (set them with `setLevel`).
+     * @param count Number of bins.
+     */
+    void reset(int count);
+
+    /**
+     * @brief Overrides the level of one bin, e.g. with a known fill rate.
+     * @param index Bin index.
+     * @param level Inflow per day.
+     */
+    void setLevel(int index, double level);
+
+    /**
+     * @brief Moves one bin's level towards today's inflow. O(1).
+     *
+     * As with `FillForecaster`, skip days on which the bin hit its capacity.
+     */
+    void observe(int index, double inflow) override;
+
+    /**
+     * @brief Nothing to do: the model has no weekday.
+     */
+    void advanceDay() override;
+
+    /**
+     * @brief The smoothed level, whatever the day (never negative).
+     */
+    double forecast(int index, int ahead) const override;
+
+    /**
+     * @brief Free space divided by the level. O(1).
+     */
+    int predictDaysToOverflow(int index, int remaining) const override;
+
+    int getBinCount() const override;
+
+    /**
+     * @brief Turns the model on or off (the simulation then uses the history average).
+     */
+    void setEnabled(bool value);
+    bool isEnabled() const;
+};
+
+}  // namespace project
@@ -0,0 +1,101 @@
+/**
+ * @file SplitPlanner.h
+ * @brief Giant-tour construction with an optimal split into disposal trips.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "core/Facilities.h"
+#include "core/PlanningState.h"
+#include "core/Route.h"
+
+namespace project {
+
+class RoutePlanner;
+
+/**
+ * @brief Route-first, cluster-second planner (Prins split) for a truck that unloads.
+ *
+ * First every non-empty bin reachable from the depot is ordered into one giant tour,
+ * ignoring capacity: nearest unvisited bin first, found with a Dijkstra search that
+ * stops at the first such bin. Then a Bellman-style shortest path over the tour
+ * positions chooses where the truck leaves the tour for the nearest disposal site.
+ * A trip over tour bins i..j costs the leg into bin i (from the depot, or from the
+ * site the previous trip unloaded at), the tour legs inside it and the leg to the
+ * site nearest to bin j (to the depot after the last bin). Only trips that fit in
+ * the truck are tried, so the split costs O(n * k) for trips of at most k bins and
+ * needs O(n) distance lookups; within the tour order it is optimal.
+ *
+ * When the truck starts loaded, the first trip may begin with an unload at the
+ * site nearest to the depot. If the sites cannot reach the rest of the tour, the
+ * longest feasible prefix is kept and the route ends at a site; a depot that cannot
+ * be reached from the last bin adds no return leg.
+ */
+class SplitPlanner {
+private:
+    const RoutePlanner& planner;  // distance oracle and road graph
+
+    // Results of the last `plan` call
+    int tourLength;
+    long long tourDistance;
+    long long splitDistance;
+    int tripCount;
+    double lastMillis;
+
+public:
+    /**
+     * @brief Creates a split planner on top of a route planner.
+     * @param planner Planner providing distances; must outlive this object.
+     */
+    explicit SplitPlanner(const RoutePlanner& planner);
+
+    /**
+     * @brief Plans a complete collection route for the captured truck.
+     *
+     * Same contract as `RoutePlanner::planRoute(const PlanningState&)`; the state is
+     * only read.
+     * @param state Snapshot of the bins and the truck.
+     * @return Route over the state's bin slots, in visiting order, with explicit
+     *         disposal stops.
+     */
+    Route plan(const PlanningState& state);
+
+    /**
+     * @brief Plans a route for the first truck and performs it on `facilities`.
+     *
+     * Like `RoutePlanner::planRoute(Facilities&)`: bins are emptied and the truck is
+     * moved and loaded.
+     * @param facilities The system's physical facilities and assets.
+     * @return Route with bins in visiting order and explicit disposal stops.
+     */
+    Route plan(Facilities& facilities);
+
+    /**
+     * @brief Bins in the giant tour of the last call.
+     */
+    int getTourLength() const;
+
+    /**
+     * @brief Depot-to-depot length of the giant tour without disposal trips.
+     */
+    long long getTourDistance() const;
+
+    /**
+     * @brief Planned distance of the split route (-1 if only a prefix could be kept).
+     */
+    long long getSplitDistance() const;
+
+    /**
+     * @brief Trips (disposal stops + 1) in the last route.
+     */
+    int getTripCount() const;
+
+    /**
+     * @brief Wall time of the last call in milliseconds.
+     */
+    double getLastMillis() const;
+};
+
+}  // namespace project
@@ -0,0 +1,252 @@
+/**
+ * @file ContractionHierarchy.h
+ * @brief Contraction-hierarchies index for fast exact shortest-path queries.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "data_structures/CsrGraph.h"
+#include "data_structures/Graph.h"
+#include "data_structures/IndexedPriorityQueue.hpp"
+
+namespace project {
+
+/**
+ * @brief Preprocessed road graph answering point-to-point queries with tiny searches.
+ *
+ * Preprocessing contracts the nodes one by one in order of importance (edge
+ * difference, contracted neighbours and hierarchy level). Removing a node `u` adds a shortcut
+ * `v -> x` for every pair of neighbours whose shortest path ran through `u`, unless a
+ * bounded witness search finds an equally short path around it. Every original edge
+ * and shortcut then points either "up" (towards a later contracted node) or "down".
+ *
+ * A query searches upwards from the source over the upward edges and upwards from
+ * the target over reversed downward edges; the two searches meet at the highest node
+ * of the shortest path, so distances are identical to Dijkstra on the original graph.
+ * Edge directions are respected, so one-way streets are handled.
+ *
+ * The index is immutable once built and can be saved to disk, so preprocessing can
+ * run offline. Queries go through a HierarchyQuery workspace.
+ */
+class ContractionHierarchy {
+private:
+    int nodeCount;
+    int* rank;          // node -> contraction order (higher = more important)
+    int* upOffsets;     // CSR offsets of upward edges
+    Edge* upEdges;      // u -> v with rank[v] > rank[u]
+    int* downOffsets;   // CSR offsets of downward edges, indexed by head node
+    Edge* downEdges;    // at node v: (u, w) for every edge u -> v with rank[u] > rank[v]
+    int upCount;        // number of upward edges
+    int downCount;      // number of downward edges
+    int shortcutCount;  // shortcuts added during contraction
+    double buildMillis;
+
+    /**
+     * @brief Releases all arrays.
+     */
+    void release();
+
+    /**
+     * @brief Copies arrays from another hierarchy.
+     * @param other Source hierarchy.
+     */
+    void copyFrom(const ContractionHierarchy& other);
+
+public:
+    /**
+     * @brief Constructs an empty (unbuilt) hierarchy.
+     */
+    ContractionHierarchy();
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~ContractionHierarchy();
+
+    /**
+     * @brief Copy constructor.
+     */
+    ContractionHierarchy(const ContractionHierarchy& other);
+
+    /**
+     * @brief Assignment operator.
+     */
+    ContractionHierarchy& operator=(const ContractionHierarchy& other);
+
+    /**
+     * @brief Contracts every node of a graph and builds the search graphs.
+     *
+     * Witness searches give up after `witnessLimit` settled nodes; a smaller limit
+     * preprocesses faster but adds a few unnecessary shortcuts. Results stay exact.
+     * @param graph Road graph.
+     * @param witnessLimit Settled-node budget of each witness search.
+     * @post Any previous contents are discarded.
+     */
+    void build(const CsrGraph& graph, int witnessLimit = 500);
+
+    /**
+     * @brief Convenience overload for an adjacency-list graph (e.g. from `JsonParser::loadGraph`).
+     * @param graph Road graph.
+     * @param witnessLimit Settled-node budget of each witness search.
+     */
+    void build(const Graph& graph, int witnessLimit = 500);
+
+    /**
+     * @brief Writes the preprocessed index to a binary file.
+     * @param path Output file path.
+     * @return `true` on success.
+     */
+    bool save(const char* path) const;
+
+    /**
+     * @brief Reads an index written by `save`.
+     * @param path Input file path.
+     * @return `true` on success; on failure the hierarchy is left empty.
+     */
+    bool load(const char* path);
+
+    /**
+     * @brief Point-to-point distance using a temporary workspace.
+     *
+     * Allocates O(n) scratch memory per call; use a HierarchyQuery for repeated queries.
+     * @param from Source node.
+     * @param to Destination node.
+     * @return Shortest distance, or INT_MAX if unreachable or invalid.
+     */
+    int distance(int from, int to) const;
+
+    /**
+     * @brief Checks whether the index has been built or loaded.
+     */
+    bool isBuilt() const { return rank != nullptr; }
+
+    /**
+     * @brief Returns the number of nodes covered by the index.
+     */
+    int getNodeCount() const { return nodeCount; }
+
+    /**
+     * @brief Returns the contraction order of a node.
+     * @param node Node index.
+     * @return Rank, or -1 for an invalid node.
+     */
+    int getRank(int node) const;
+
+    /**
+     * @brief Returns the number of shortcuts added by preprocessing.
+     */
+    int getShortcutCount() const { return shortcutCount; }
+
+    /**
+     * @brief Returns the memory held by the search graphs and ranks.
+     * @return Size in bytes.
+     */
+    long long getMemoryUsage() const;
+
+    /**
+     * @brief Returns how long the last `build` took.
+     * @return Milliseconds (0 after `load`).
+     */
+    double getBuildMillis() const { return buildMillis; }
+
+    /**
+     * @brief Upward edges of a node (towards higher rank).
+     * @pre `node` is in range.
+     */
+    const Edge* upBegin(int node) const { return upEdges + upOffsets[node]; }
+    const Edge* upEnd(int node) const { return upEdges + upOffsets[node + 1]; }
+
+    /**
+     * @brief Reversed downward edges into a node (tails have higher rank).
+     * @pre `node` is in range.
+     */
+    const Edge* downBegin(int node) const { return downEdges + downOffsets[node]; }
+    const Edge* downEnd(int node) const { return downEdges + downOffsets[node + 1]; }
+};
+
+/**
+ * @brief Reusable scratch space for ContractionHierarchy queries.
+ *
+ * Distance arrays are allocated once and reset sparsely (only touched entries),
+ * so each query costs time proportional to its search space, not to the graph.
+ * One workspace per thread; the hierarchy itself is shared read-only.
+ */
+class HierarchyQuery {
+private:
+    const ContractionHierarchy& hierarchy;
+    int nodeCount;
+    int* forwardDist;   // distance from the source, INT_MAX if unreached
+    int* backwardDist;  // distance to the target, INT_MAX if unreached
+    int* forwardTouched;
+    int* backwardTouched;
+    int forwardTouchedCount;
+    int backwardTouchedCount;
+    IndexedPriorityQueue<int> forwardQueue;
+    IndexedPriorityQueue<int> backwardQueue;
+    int settled;  // nodes settled by the last query
+
+    void resetForward();
+    void resetBackward();
+
+    /**
+     * @brief Stall-on-demand tests: a node reached suboptimally is settled but not expanded.
+     */
+    bool stalledForward(int node) const;
+    bool stalledBackward(int node) const;
+
+    /**
+     * @brief Settles the complete upward search space of a source.
+     */
+    void searchUpFrom(int from);
+
+    /**
+     * @brief Backward search from a target, pruned by the best meeting found so far.
+     * @return Distance from the settled forward space to `to`.
+     */
+    int searchDownTo(int to);
+
+public:
+    /**
+     * @brief Creates a workspace for a built hierarchy.
+     * @param index Hierarchy to query; must outlive the workspace.
+     */
+    explicit HierarchyQuery(const ContractionHierarchy& index);
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~HierarchyQuery();
+
+    HierarchyQuery(const HierarchyQuery&) = delete;
+    HierarchyQuery& operator=(const HierarchyQuery&) = delete;
+
+    /**
+     * @brief Bidirectional upward search between two nodes.
+     * @param from Source node.
+     * @param to Destination node.
+     * @return Shortest distance, or INT_MAX if unreachable or invalid.
+     */
+    int distance(int from, int to);
+
+    /**
+     * @brief Distances from one source to many targets.
+     *
+     * The source's upward space is searched once; each target then only needs a
+     * small pruned backward search.
+     * @param from Source node.
+     * @param targets Array of target nodes (duplicates allowed).
+     * @param targetCount Number of entries in `targets`.
+     * @param distances Output array of size `targetCount`; INT_MAX for unreachable
+     *                  or invalid targets.
+     */
+    void distances(int from, const int* targets, int targetCount, int* distances);
+
+    /**
+     * @brief Returns how many nodes the last query settled (both directions).
+     */
+    int getSettledCount() const { return settled; }
+};
+
+}  // namespace project
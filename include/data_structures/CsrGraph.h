@@ -0,0 +1,199 @@
+/**
+ * @file CsrGraph.h
+ * @brief Frozen compressed-sparse-row (CSR) view of the city graph.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include <cmath>
+
+#include "data_structures/Graph.h"
+
+namespace project {
+
+/**
+ * @brief Read-only graph stored as an offset array plus a packed edge array.
+ *
+ * The outgoing edges of node `v` are `edges[offsets[v]] .. edges[offsets[v + 1] - 1]`,
+ * so neighbor iteration is a contiguous scan with O(1) setup. Built once from a
+ * `Graph` (e.g. after `JsonParser::loadGraph`) and never modified afterwards.
+ * When every node of the source graph has coordinates they are copied too, which
+ * enables the straight-line lower bound used by A*.
+ */
+class CsrGraph {
+private:
+    int nodeCount;         ///< Number of nodes
+    int edgeCount;         ///< Number of directed edges
+    int* offsets;          ///< Start index of each node's edges (size nodeCount + 1)
+    Edge* edges;           ///< Packed edge array (size edgeCount)
+    int* xs;               ///< Node X coordinates, or nullptr when not every node has one
+    int* ys;               ///< Node Y coordinates, or nullptr when not every node has one
+    double distanceScale;  ///< Largest s with s * euclid(u, v) <= weight(u, v) on every edge
+
+    /**
+     * @brief Releases the offset and edge arrays.
+     */
+    void release();
+
+    /// Graph accessor returning a node's outgoing or incoming edge list
+    typedef const LinkedList<Edge>& (Graph::*AdjacencyGetter)(int) const;
+
+    /**
+     * @brief Packs the edge lists returned by `lists` into the CSR arrays.
+     * @param graph Source adjacency-list graph.
+     * @param lists Accessor selecting forward or reverse lists.
+     */
+    void pack(const Graph& graph, AdjacencyGetter lists);
+
+    /**
+     * @brief Copies node positions and derives `distanceScale` from the edge weights.
+     * @param graph Source adjacency-list graph.
+     */
+    void buildPositions(const Graph& graph);
+
+    /**
+     * @brief Copies arrays from another CSR graph.
+     * @param other Source graph.
+     */
+    void copyFrom(const CsrGraph& other);
+
+public:
+    /**
+     * @brief Constructs an empty CSR graph.
+     */
+    CsrGraph();
+
+    /**
+     * @brief Builds the CSR representation of a graph.
+     * @param graph Source adjacency-list graph.
+     */
+    explicit CsrGraph(const Graph& graph);
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~CsrGraph();
+
+    /**
+     * @brief Copy constructor.
+     */
+    CsrGraph(const CsrGraph& other);
+
+    /**
+     * @brief Assignment operator.
+     */
+    CsrGraph& operator=(const CsrGraph& other);
+
+    /**
+     * @brief Rebuilds the CSR arrays from a graph.
+     *
+     * Edge order inside each node is preserved.
+     * @param graph Source adjacency-list graph.
+     * @post Any previous contents are discarded.
+     */
+    void build(const Graph& graph);
+
+    /**
+     * @brief Rebuilds the CSR arrays from the graph's incoming edges.
+     *
+     * Uses the graph's reverse index (`Graph::enableReverseIndex`) when present, so
+     * the transpose comes straight from the adjacency lists; otherwise the forward
+     * graph is packed and transposed.
+     * @param graph Source adjacency-list graph.
+     * @post Node `v`'s edges are the edges entering `v`, with `toNode` set to the tail.
+     */
+    void buildReverse(const Graph& graph);
+
+    /**
+     * @brief Builds the transpose (every edge u -> v becomes v -> u).
+     *
+     * Used by backward searches such as "distance from every node to a facility".
+     * @return New CSR graph with reversed edges.
+     */
+    CsrGraph transposed() const;
+
+    /**
+     * @brief Returns a pointer to the first outgoing edge of a node.
+     * @param node Node index.
+     * @return Pointer to the first edge; equals `edgesEnd(node)` when the node has no edges
+     *         or is out of range.
+     */
+    const Edge* edgesBegin(int node) const {
+        if (node < 0 || node >= nodeCount) {
+            return nullptr;
+        }
+        return edges + offsets[node];
+    }
+
+    /**
+     * @brief Returns a pointer one past the last outgoing edge of a node.
+     * @param node Node index.
+     * @return End pointer of the node's edge range.
+     */
+    const Edge* edgesEnd(int node) const {
+        if (node < 0 || node >= nodeCount) {
+            return nullptr;
+        }
+        return edges + offsets[node + 1];
+    }
+
+    /**
+     * @brief Checks whether every node has map coordinates.
+     * @return `true` if positions (and so the A* heuristic) are available.
+     */
+    bool hasPositions() const { return xs != nullptr; }
+
+    /**
+     * @brief Lower bound on the road distance between two nodes.
+     *
+     * Straight-line distance scaled by `distanceScale`, so it never exceeds the
+     * weight of any edge and is consistent (safe for A* with a closed set).
+     * @param from Node index.
+     * @param to Node index.
+     * @return Lower bound, or 0 when positions are unavailable.
+     * @pre Both nodes are in range.
+     */
+    int straightLineBound(int from, int to) const {
+        if (xs == nullptr) {
+            return 0;
+        }
+        double dx = static_cast<double>(xs[from]) - xs[to];
+        double dy = static_cast<double>(ys[from]) - ys[to];
+        return static_cast<int>(distanceScale * std::sqrt(dx * dx + dy * dy));
+    }
+
+    /**
+     * @brief Returns the weight-per-unit-length factor used by `straightLineBound`.
+     * @return Scale factor (0 when positions are unavailable).
+     */
+    double getDistanceScale() const;
+
+    /**
+     * @brief Returns the out-degree of a node.
+     * @param node Node index.
+     * @return Number of outgoing edges, 0 for an invalid node.
+     */
+    int getDegree(int node) const;
+
+    /**
+     * @brief Returns the total number of nodes.
+     * @return The node count.
+     */
+    int getNodeCount() const;
+
+    /**
+     * @brief Returns the total number of directed edges.
+     * @return The edge count.
+     */
+    int getEdgeCount() const;
+
+    /**
+     * @brief Returns the memory held by the CSR arrays.
+     * @return Size in bytes.
+     */
+    long long getMemoryUsage() const;
+};
+
+}  // namespace project
@@ -29,12 +29,16 @@ struct Edge {
  * @brief Node in the pointer-based graph structure.
  */
 struct GraphNode {
-    int nodeId;              ///< Node identifier
-    LinkedList<Edge> edges;  ///< Adjacency list of edges
-    GraphNode* next;         ///< Pointer to next node in the list
-
-    GraphNode() : nodeId(0), next(nullptr) {}
-    GraphNode(int id) : nodeId(id), next(nullptr) {}
+    int nodeId;                     ///< Node identifier
+    LinkedList<Edge> edges;         ///< Adjacency list of edges
+    LinkedList<Edge> reverseEdges;  ///< Incoming edges (toNode = tail), if indexed
+    GraphNode* next;                ///< Pointer to next node in the list
+    int x;                          ///< X coordinate (valid when hasPosition)
+    int y;                          ///< Y coordinate (valid when hasPosition)
+    bool hasPosition;               ///< Whether coordinates were set for this node
+
+    GraphNode() : nodeId(0), next(nullptr), x(0), y(0), hasPosition(false) {}
+    GraphNode(int id) : nodeId(id), next(nullptr), x(0), y(0), hasPosition(false) {}
 };
 
 /**
@@ -45,11 +49,20 @@ struct GraphNode {
  */
 class Graph {
 private:
-    GraphNode* head;  ///< Head of the linked list of nodes
-    int nodeCount;    ///< Total number of nodes
+    GraphNode* head;        ///< Head of the linked list of nodes
+    GraphNode** nodeIndex;  ///< Direct node lookup table indexed by node ID
+    int nodeCount;          ///< Total number of nodes
+    bool reverseIndexed;    ///< Whether incoming edges are tracked in `reverseEdges`
+
+    /**
+     * @brief Rebuilds the node lookup table from the linked list of nodes.
+     */
+    void buildIndex();
 
     /**
      * @brief Finds a node by its ID.
+     *
+     * Uses the lookup table, so the cost is O(1) instead of a list walk.
      * @param nodeId The node ID to search for.
      * @return Pointer to the node, or nullptr if not found.
      */
@@ -89,7 +102,8 @@ public:
      * @param to Destination node index.
      * @param weight The weight/distance of the edge.
      * @pre `from` and `to` indices must be valid (0 <= index < nodeCount).
-     * @post A new `Edge` structure is added to the adjacency list of the `from` node.
+     * @post A new `Edge` structure is added to the adjacency list of the `from` node
+     *       (and to the reverse list of `to` when the reverse index is enabled).
      */
     void addEdge(int from, int to, int weight);
 
@@ -116,6 +130,62 @@ public:
      */
     const LinkedList<Edge>& getAdjList(int node) const;
 
+    /**
+     * @brief Starts tracking incoming edges for every node.
+     *
+     * Builds the reverse lists from the existing edges; later `addEdge` calls keep
+     * them in sync. Edges added through `getAdjList` directly are not tracked.
+     * @post `hasReverseIndex()` is true.
+     */
+    void enableReverseIndex();
+
+    /**
+     * @brief Checks whether incoming edges are being tracked.
+     * @return `true` after `enableReverseIndex`.
+     */
+    bool hasReverseIndex() const;
+
+    /**
+     * @brief Returns the incoming edges of a node.
+     *
+     * Each entry's `toNode` is the tail of the original edge, so the list reads
+     * like the adjacency list of the transposed graph.
+     * @param node The index of the node.
+     * @return Reference to the reverse list (empty if not indexed or invalid).
+     */
+    const LinkedList<Edge>& getReverseAdjList(int node) const;
+
+    /**
+     * @brief Sets the map coordinates of a node.
+     *
+     * Coordinates are optional; they only enable goal-directed (A*) searches.
+     * @param node The index of the node.
+     * @param x X coordinate.
+     * @param y Y coordinate.
+     */
+    void setNodePosition(int node, int x, int y);
+
+    /**
+     * @brief Checks whether a node has coordinates.
+     * @param node The index of the node.
+     * @return `true` if `setNodePosition` was called for the node.
+     */
+    bool hasNodePosition(int node) const;
+
+    /**
+     * @brief Returns the X coordinate of a node.
+     * @param node The index of the node.
+     * @return X coordinate, or 0 if the node has no position.
+     */
+    int getNodeX(int node) const;
+
+    /**
+     * @brief Returns the Y coordinate of a node.
+     * @param node The index of the node.
+     * @return Y coordinate, or 0 if the node has no position.
+     */
+    int getNodeY(int node) const;
+
     /**
      * @brief Returns the total number of nodes in the graph.
      * @return The node count.
@@ -0,0 +1,303 @@
+/**
+ * @file IndexedPriorityQueue.hpp
+ * @brief Array-backed d-ary min-heap over integer items with a position index.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+namespace project {
+
+/**
+ * @brief Indexed priority queue for items numbered 0 .. maxItems - 1.
+ *
+ * Every item appears at most once. A position table maps each item to its slot in
+ * the heap array, so `decreaseKey`, `changeKey` and `remove` run in O(log n) and
+ * `contains` in O(1). Dijkstra uses it to update a node's tentative distance in
+ * place instead of pushing a duplicate entry.
+ * Lower priority value = higher priority (processed first).
+ * @tparam Key Priority type (must support `<`).
+ * @tparam Arity Number of children per heap node.
+ */
+template <typename Key = int, int Arity = 4>
+class IndexedPriorityQueue {
+    static_assert(Arity >= 2, "IndexedPriorityQueue needs at least two children per node");
+
+private:
+    int* items;     ///< Heap slots -> item
+    Key* keys;      ///< Heap slots -> priority (kept beside items for cache locality)
+    int* position;  ///< Item -> heap slot, or -1 when absent
+    int heapSize;
+    int maxItems;
+
+    void place(int slot, int item, const Key& key) {
+        items[slot] = item;
+        keys[slot] = key;
+        position[item] = slot;
+    }
+
+    void siftUp(int slot) {
+        int item = items[slot];
+        Key key = keys[slot];
+        while (slot > 0) {
+            int parent = (slot - 1) / Arity;
+            if (!(key < keys[parent]))
+                break;
+            place(slot, items[parent], keys[parent]);
+            slot = parent;
+        }
+        place(slot, item, key);
+    }
+
+    void siftDown(int slot) {
+        int item = items[slot];
+        Key key = keys[slot];
+        while (true) {
+            int first = Arity * slot + 1;
+            if (first >= heapSize)
+                break;
+
+            int last = first + Arity < heapSize ? first + Arity : heapSize;
+            int smallest = first;
+            for (int c = first + 1; c < last; c++) {
+                if (keys[c] < keys[smallest]) {
+                    smallest = c;
+                }
+            }
+
+            if (!(keys[smallest] < key))
+                break;
+
+            place(slot, items[smallest], keys[smallest]);
+            slot = smallest;
+        }
+        place(slot, item, key);
+    }
+
+    void allocate(int count) {
+        maxItems = count > 0 ? count : 0;
+        items = maxItems > 0 ? new int[maxItems] : nullptr;
+        keys = maxItems > 0 ? new Key[maxItems] : nullptr;
+        position = maxItems > 0 ? new int[maxItems] : nullptr;
+        for (int i = 0; i < maxItems; i++) {
+            position[i] = -1;
+        }
+        heapSize = 0;
+    }
+
+    void release() {
+        delete[] items;
+        delete[] keys;
+        delete[] position;
+        items = nullptr;
+        keys = nullptr;
+        position = nullptr;
+        heapSize = 0;
+        maxItems = 0;
+    }
+
+public:
+    /**
+     * @brief Constructs a queue able to hold items 0 .. maxItems - 1.
+     * @param count Size of the item universe.
+     */
+    explicit IndexedPriorityQueue(int count = 0)
+        : items(nullptr), keys(nullptr), position(nullptr), heapSize(0), maxItems(0) {
+        allocate(count);
+    }
+
+    /**
+     * @brief Destructor to free allocated memory.
+     */
+    ~IndexedPriorityQueue() { release(); }
+
+    /**
+     * @brief Copy constructor.
+     */
+    IndexedPriorityQueue(const IndexedPriorityQueue& other)
+        : items(nullptr), keys(nullptr), position(nullptr), heapSize(0), maxItems(0) {
+        allocate(other.maxItems);
+        for (int i = 0; i < other.heapSize; i++) {
+            place(i, other.items[i], other.keys[i]);
+        }
+        heapSize = other.heapSize;
+    }
+
+    /**
+     * @brief Assignment operator.
+     */
+    IndexedPriorityQueue& operator=(const IndexedPriorityQueue& other) {
+        if (this != &other) {
+            release();
+            allocate(other.maxItems);
+            for (int i = 0; i < other.heapSize; i++) {
+                place(i, other.items[i], other.keys[i]);
+            }
+            heapSize = other.heapSize;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Discards all contents and resizes the item universe.
+     * @param count New number of items.
+     */
+    void resize(int count) {
+        release();
+        allocate(count);
+    }
+
+    /**
+     * @brief Checks whether an item is currently queued.
+     * @param item Item number.
+     * @return `true` if the item is in the heap.
+     */
+    bool contains(int item) const {
+        return item >= 0 && item < maxItems && position[item] != -1;
+    }
+
+    /**
+     * @brief Inserts an item that is not yet queued.
+     * @param item Item number.
+     * @param priority Priority value.
+     * @pre `contains(item)` is false.
+     */
+    void push(int item, const Key& priority) {
+        place(heapSize, item, priority);
+        heapSize++;
+        siftUp(heapSize - 1);
+    }
+
+    /**
+     * @brief Lowers the priority value of a queued item.
+     * @param item Item number.
+     * @param priority New priority, not larger than the current one.
+     * @pre `contains(item)` is true.
+     */
+    void decreaseKey(int item, const Key& priority) {
+        int slot = position[item];
+        keys[slot] = priority;
+        siftUp(slot);
+    }
+
+    /**
+     * @brief Sets a queued item's priority to any value.
+     * @param item Item number.
+     * @param priority New priority.
+     * @pre `contains(item)` is true.
+     */
+    void changeKey(int item, const Key& priority) {
+        int slot = position[item];
+        bool up = priority < keys[slot];
+        keys[slot] = priority;
+        if (up) {
+            siftUp(slot);
+        } else {
+            siftDown(slot);
+        }
+    }
+
+    /**
+     * @brief Inserts an item or lowers its priority, whichever applies.
+     * @param item Item number.
+     * @param priority Candidate priority.
+     * @return `true` if the queue changed.
+     */
+    bool pushOrDecrease(int item, const Key& priority) {
+        int slot = position[item];
+        if (slot == -1) {
+            push(item, priority);
+            return true;
+        }
+        if (priority < keys[slot]) {
+            decreaseKey(item, priority);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Removes an arbitrary queued item.
+     * @param item Item number; ignored when not queued.
+     */
+    void remove(int item) {
+        if (!contains(item))
+            return;
+
+        int slot = position[item];
+        position[item] = -1;
+        heapSize--;
+        if (slot == heapSize)
+            return;
+
+        bool up = keys[heapSize] < keys[slot];
+        place(slot, items[heapSize], keys[heapSize]);
+        if (up) {
+            siftUp(slot);
+        } else {
+            siftDown(slot);
+        }
+    }
+
+    /**
+     * @brief Returns the item with the smallest priority value.
+     * @pre The queue must not be empty.
+     */
+    int top() const { return items[0]; }
+
+    /**
+     * @brief Returns the smallest priority value.
+     * @pre The queue must not be empty.
+     */
+    const Key& topPriority() const { return keys[0]; }
+
+    /**
+     * @brief Returns the priority of a queued item.
+     * @pre `contains(item)` is true.
+     */
+    const Key& getPriority(int item) const { return keys[position[item]]; }
+
+    /**
+     * @brief Removes the highest priority item.
+     * @pre The queue must not be empty.
+     */
+    void pop() {
+        if (heapSize == 0)
+            return;
+
+        position[items[0]] = -1;
+        heapSize--;
+        if (heapSize > 0) {
+            place(0, items[heapSize], keys[heapSize]);
+            siftDown(0);
+        }
+    }
+
+    /**
+     * @brief Empties the queue in O(size) without touching the position table of absent items.
+     */
+    void clear() {
+        for (int i = 0; i < heapSize; i++) {
+            position[items[i]] = -1;
+        }
+        heapSize = 0;
+    }
+
+    /**
+     * @brief Checks if the queue contains any items.
+     */
+    bool isEmpty() const { return heapSize == 0; }
+
+    /**
+     * @brief Gets the number of queued items.
+     */
+    int size() const { return heapSize; }
+
+    /**
+     * @brief Gets the size of the item universe.
+     */
+    int getMaxItems() const { return maxItems; }
+};
+
+}  // namespace project
@@ -1,6 +1,6 @@
 /**
  * @file PriorityQueue.h
- * @brief Priority queue implemented using a node-based binary heap.
+ * @brief Priority queue implemented using an array-backed d-ary min-heap.
  * @author İrem Irmak Ünlüer
  * @date 2026-01-10
  */
@@ -15,174 +15,104 @@ namespace project {
  * Elements are sorted based on their priority value. This structure is essential
  * for implementing shortest path algorithms like Dijkstra's.
  * Lower priority value = higher priority (processed first).
+ *
+ * The heap lives in one contiguous array that doubles when full, so push and pop
+ * cost O(log n) with no per-element allocation. The children of slot `i` are
+ * slots `Arity * i + 1 .. Arity * i + Arity`.
  * @tparam T The data type stored.
+ * @tparam Arity Number of children per heap node (4 keeps the tree shallow).
  */
-template <typename T>
+template <typename T, int Arity = 4>
 class PriorityQueue {
+    static_assert(Arity >= 2, "PriorityQueue needs at least two children per node");
+
 private:
-    struct HeapNode {
+    struct HeapEntry {
         T data;
         int priority;
-        HeapNode* parent;
-        HeapNode* left;
-        HeapNode* right;
-
-        HeapNode(const T& d, int p)
-            : data(d), priority(p), parent(nullptr), left(nullptr), right(nullptr) {}
     };
 
-    HeapNode* root;
+    HeapEntry* heap;
     int heapSize;
+    int capacity;
 
     /**
-     * @brief Finds the last node in level-order traversal for insertion.
+     * @brief Doubles the backing array.
      */
-    HeapNode* findLastNode() const {
-        if (root == nullptr)
-            return nullptr;
-
-        // Use level-order traversal to find insertion point
-        HeapNode** queue = new HeapNode*[heapSize];
-        int front = 0, rear = 0;
-
-        queue[rear++] = root;
-        HeapNode* lastNode = nullptr;
-
-        while (front < rear) {
-            lastNode = queue[front++];
-
-            if (lastNode->left != nullptr) {
-                queue[rear++] = lastNode->left;
-            }
-            if (lastNode->right != nullptr) {
-                queue[rear++] = lastNode->right;
-            }
-        }
-
-        delete[] queue;
-        return lastNode;
-    }
-
-    /**
-     * @brief Finds the insertion parent for the next node.
-     */
-    HeapNode* findInsertionParent() const {
-        if (root == nullptr)
-            return nullptr;
-
-        HeapNode** queue = new HeapNode*[heapSize + 1];
-        int front = 0, rear = 0;
-
-        queue[rear++] = root;
-        HeapNode* insertParent = nullptr;
-
-        while (front < rear) {
-            HeapNode* current = queue[front++];
-
-            if (current->left == nullptr || current->right == nullptr) {
-                insertParent = current;
-                break;
-            }
-
-            queue[rear++] = current->left;
-            queue[rear++] = current->right;
+    void grow() {
+        int newCapacity = capacity == 0 ? 16 : capacity * 2;
+        HeapEntry* bigger = new HeapEntry[newCapacity];
+        for (int i = 0; i < heapSize; i++) {
+            bigger[i] = heap[i];
         }
-
-        delete[] queue;
-        return insertParent;
-    }
-
-    /**
-     * @brief Swaps data between two nodes.
-     */
-    void swapNodes(HeapNode* a, HeapNode* b) {
-        T tempData = a->data;
-        int tempPriority = a->priority;
-
-        a->data = b->data;
-        a->priority = b->priority;
-
-        b->data = tempData;
-        b->priority = tempPriority;
+        delete[] heap;
+        heap = bigger;
+        capacity = newCapacity;
     }
 
     /**
      * @brief Maintains min-heap property by moving element up.
      */
-    void heapifyUp(HeapNode* node) {
-        while (node->parent != nullptr && node->priority < node->parent->priority) {
-            swapNodes(node, node->parent);
-            node = node->parent;
+    void heapifyUp(int index) {
+        HeapEntry moving = heap[index];
+        while (index > 0) {
+            int parent = (index - 1) / Arity;
+            if (!(moving.priority < heap[parent].priority))
+                break;
+            heap[index] = heap[parent];  // shift parent down, place `moving` once at the end
+            index = parent;
         }
+        heap[index] = moving;
     }
 
     /**
      * @brief Maintains min-heap property by moving element down.
      */
-    void heapifyDown(HeapNode* node) {
+    void heapifyDown(int index) {
+        HeapEntry moving = heap[index];
         while (true) {
-            HeapNode* smallest = node;
-
-            if (node->left != nullptr && node->left->priority < smallest->priority) {
-                smallest = node->left;
-            }
+            int first = Arity * index + 1;
+            if (first >= heapSize)
+                break;
 
-            if (node->right != nullptr && node->right->priority < smallest->priority) {
-                smallest = node->right;
+            int last = first + Arity < heapSize ? first + Arity : heapSize;
+            int smallest = first;
+            for (int c = first + 1; c < last; c++) {
+                if (heap[c].priority < heap[smallest].priority) {
+                    smallest = c;
+                }
             }
 
-            if (smallest == node)
+            if (!(heap[smallest].priority < moving.priority))
                 break;
 
-            swapNodes(node, smallest);
-            node = smallest;
+            heap[index] = heap[smallest];
+            index = smallest;
         }
-    }
-
-    /**
-     * @brief Recursively copies a subtree.
-     */
-    HeapNode* copyTree(HeapNode* node, HeapNode* parent) {
-        if (node == nullptr)
-            return nullptr;
-
-        HeapNode* newNode = new HeapNode(node->data, node->priority);
-        newNode->parent = parent;
-        newNode->left = copyTree(node->left, newNode);
-        newNode->right = copyTree(node->right, newNode);
-
-        return newNode;
-    }
-
-    /**
-     * @brief Recursively deletes a subtree.
-     */
-    void deleteTree(HeapNode* node) {
-        if (node == nullptr)
-            return;
-
-        deleteTree(node->left);
-        deleteTree(node->right);
-        delete node;
+        heap[index] = moving;
     }
 
 public:
     /**
      * @brief Constructs an empty priority queue.
      */
-    PriorityQueue() : root(nullptr), heapSize(0) {}
+    PriorityQueue() : heap(nullptr), heapSize(0), capacity(0) {}
 
     /**
      * @brief Destructor to free allocated memory.
      */
-    ~PriorityQueue() { deleteTree(root); }
+    ~PriorityQueue() { delete[] heap; }
 
     /**
      * @brief Copy constructor.
      */
-    PriorityQueue(const PriorityQueue& other) : root(nullptr), heapSize(other.heapSize) {
-        if (other.root != nullptr) {
-            root = copyTree(other.root, nullptr);
+    PriorityQueue(const PriorityQueue& other)
+        : heap(nullptr), heapSize(other.heapSize), capacity(other.capacity) {
+        if (capacity > 0) {
+            heap = new HeapEntry[capacity];
+            for (int i = 0; i < heapSize; i++) {
+                heap[i] = other.heap[i];
+            }
         }
     }
 
@@ -191,12 +121,16 @@ public:
      */
     PriorityQueue& operator=(const PriorityQueue& other) {
         if (this != &other) {
-            deleteTree(root);
-            root = nullptr;
+            delete[] heap;
+            heap = nullptr;
             heapSize = other.heapSize;
+            capacity = other.capacity;
 
-            if (other.root != nullptr) {
-                root = copyTree(other.root, nullptr);
+            if (capacity > 0) {
+                heap = new HeapEntry[capacity];
+                for (int i = 0; i < heapSize; i++) {
+                    heap[i] = other.heap[i];
+                }
             }
         }
         return *this;
@@ -211,25 +145,13 @@ public:
      * @post New element is inserted into the heap in priority order.
      */
     void push(const T& value, int priority) {
-        HeapNode* newNode = new HeapNode(value, priority);
-
-        if (root == nullptr) {
-            root = newNode;
-            heapSize = 1;
-            return;
-        }
-
-        HeapNode* parent = findInsertionParent();
-        newNode->parent = parent;
-
-        if (parent->left == nullptr) {
-            parent->left = newNode;
-        } else {
-            parent->right = newNode;
+        if (heapSize == capacity) {
+            grow();
         }
-
+        heap[heapSize].data = value;
+        heap[heapSize].priority = priority;
         heapSize++;
-        heapifyUp(newNode);
+        heapifyUp(heapSize - 1);
     }
 
     /**
@@ -238,34 +160,13 @@ public:
      * @post The highest priority item (root) is removed from the heap.
      */
     void pop() {
-        if (root == nullptr)
-            return;
-
-        if (heapSize == 1) {
-            delete root;
-            root = nullptr;
-            heapSize = 0;
+        if (heapSize == 0)
             return;
-        }
-
-        HeapNode* lastNode = findLastNode();
-
-        // Swap root with last node
-        root->data = lastNode->data;
-        root->priority = lastNode->priority;
-
-        // Remove last node
-        if (lastNode->parent->left == lastNode) {
-            lastNode->parent->left = nullptr;
-        } else {
-            lastNode->parent->right = nullptr;
-        }
 
-        delete lastNode;
         heapSize--;
-
-        if (root != nullptr) {
-            heapifyDown(root);
+        if (heapSize > 0) {
+            heap[0] = heap[heapSize];  // move last entry to the root
+            heapifyDown(0);
         }
     }
 
@@ -274,26 +175,38 @@ public:
      * @pre The queue must not be empty.
      * @return Reference to the highest priority element.
      */
-    T& top() { return root->data; }
+    T& top() { return heap[0].data; }
 
     /**
      * @brief Returns the highest priority element (const version).
      * @pre The queue must not be empty.
      * @return Const reference to the highest priority element.
      */
-    const T& top() const { return root->data; }
+    const T& top() const { return heap[0].data; }
+
+    /**
+     * @brief Returns the priority of the highest priority element.
+     * @pre The queue must not be empty.
+     * @return Priority value of the root.
+     */
+    int topPriority() const { return heap[0].priority; }
 
     /**
      * @brief Checks if the queue contains any elements.
      * @return `true` if the queue is empty.
      */
-    bool isEmpty() const { return root == nullptr; }
+    bool isEmpty() const { return heapSize == 0; }
 
     /**
      * @brief Gets the number of elements in the queue.
      * @return Size of the queue.
      */
     int size() const { return heapSize; }
+
+    /**
+     * @brief Removes all elements but keeps the allocated array for reuse.
+     */
+    void clear() { heapSize = 0; }
 };
 
 }  // namespace project
@@ -41,6 +41,7 @@ public:
      *
      * First pass: reads bins and facilities to build location mappings.
      * Second pass: reads edges and converts string IDs to node indices.
+     * Facilities and bins that carry `x`/`y` fields also give their node coordinates.
      * @post Graph is populated with nodes and weighted edges.
      * @return The loaded `Graph` object.
      */
@@ -60,10 +61,20 @@ public:
      * @brief Loads and constructs the truck object from JSON.
      *
      * Truck position string is converted to node ID using mapper.
-     * @return The loaded `Truck` object.
+     * @return The first truck of the fleet (a default truck if there is none).
      */
     Truck loadTruck();
 
+    /**
+     * @brief Loads every truck of the fleet from JSON.
+     *
+     * Truck position strings are converted to node IDs using mapper.
+     * @param count Reference to store the number of trucks loaded.
+     * @post The `count` variable is updated with the truck count.
+     * @return Dynamically allocated array of `Truck` objects (nullptr if none).
+     */
+    Truck* loadTrucks(int& count);
+
     /**
      * @brief Loads and constructs facilities array from JSON.
      *
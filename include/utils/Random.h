@@ -0,0 +1,50 @@
+/**
+ * @file Random.h
+ * @brief Small seeded pseudo-random generator shared by the randomized planners.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+namespace project {
+
+/**
+ * @brief xorshift64* generator: small, fast and identical on every platform.
+ *
+ * Equal seeds give equal sequences, so randomized planning is reproducible.
+ */
+class Random {
+public:
+    /**
+     * @brief Seeds the generator.
+     * @param seed Seed value.
+     */
+    explicit Random(unsigned int seed)
+        : state(0x9E3779B97F4A7C15ULL ^ (static_cast<unsigned long long>(seed) << 1)) {}
+
+    /**
+     * @brief Next raw 64-bit value.
+     */
+    unsigned long long next() {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545F4914F6CDD1DULL;
+    }
+
+    /**
+     * @brief Uniform integer in [0, n) for n > 0.
+     */
+    int below(int n) { return static_cast<int>(next() % static_cast<unsigned long long>(n)); }
+
+    /**
+     * @brief Uniform double in [0, 1).
+     */
+    double unit() { return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0); }
+
+private:
+    unsigned long long state;
+};
+
+}  // namespace project
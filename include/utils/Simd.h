@@ -0,0 +1,51 @@
+/**
+ * @file Simd.h
+ * @brief Compile-time and run-time detection for the optional AVX2 kernels.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ *
+ * The build does not pass -mavx2: AVX2 kernels are compiled for that target with
+ * `PROJECT_AVX2_TARGET` and only called when `cpuHasAvx2()` is true, so one binary
+ * runs everywhere and uses the wider registers where it can. Kernel sources include
+ * <immintrin.h> themselves when `PROJECT_HAS_AVX2_KERNEL` is defined.
+ */
+
+#pragma once
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define PROJECT_HAS_AVX2_KERNEL 1
+#define PROJECT_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+namespace project {
+
+/**
+ * @brief Implementation of a kernel that has a vector and a scalar version.
+ */
+enum class SimdKernel {
+    Auto,    ///< AVX2 when the CPU supports it, scalar otherwise (default)
+    Scalar,  ///< Plain loop
+    Avx2     ///< AVX2; falls back to scalar without CPU support
+};
+
+/**
+ * @brief Checks whether AVX2 kernels can run on this CPU (false when not compiled in).
+ */
+inline bool cpuHasAvx2() {
+#ifdef PROJECT_HAS_AVX2_KERNEL
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief The kernel that actually runs for a request (never Auto).
+ */
+inline SimdKernel resolveKernel(SimdKernel requested) {
+    return requested == SimdKernel::Scalar || !cpuHasAvx2() ? SimdKernel::Scalar
+                                                            : SimdKernel::Avx2;
+}
+
+}  // namespace project
@@ -0,0 +1,91 @@
+/**
+ * @file ThreadPool.h
+ * @brief Fixed-size worker pool for running independent planning tasks in parallel.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "data_structures/LinkedList.hpp"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace project {
+
+/**
+ * @brief Pool of worker threads consuming a FIFO task queue.
+ *
+ * Tasks must not throw and must not touch shared mutable state without their own
+ * synchronization. The pool is not copyable.
+ */
+class ThreadPool {
+private:
+    std::thread* workers;
+    int threadCount;
+    LinkedList<std::function<void()>> tasks;  // pending tasks, oldest first
+    std::mutex lock;
+    std::condition_variable taskReady;
+    std::condition_variable allDone;
+    int activeTasks;  // queued + running
+    bool stopping;
+
+    /**
+     * @brief Worker loop: pops and runs tasks until the pool is destroyed.
+     */
+    void workerLoop();
+
+public:
+    /**
+     * @brief Starts the worker threads.
+     * @param threads Number of workers; 0 or less uses the hardware thread count.
+     */
+    explicit ThreadPool(int threads = 0);
+
+    /**
+     * @brief Waits for running tasks, then stops and joins all workers.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Queues a task for execution.
+     * @param task Callable to run on a worker thread.
+     */
+    void submit(const std::function<void()>& task);
+
+    /**
+     * @brief Blocks until every submitted task has finished.
+     */
+    void wait();
+
+    /**
+     * @brief Runs `body(i)` for every i in [begin, end) and waits for completion.
+     *
+     * The range is cut into a few chunks per worker so uneven iterations still balance.
+     * Must not be called from inside a task running on this pool.
+     * @param begin First index.
+     * @param end One past the last index.
+     * @param body Function called once per index.
+     */
+    void parallelFor(int begin, int end, const std::function<void(int)>& body);
+
+    /**
+     * @brief Gets the number of worker threads.
+     * @return Worker count.
+     */
+    int getThreadCount() const;
+
+    /**
+     * @brief Gets the number of hardware threads (at least 1).
+     * @return Hardware concurrency.
+     */
+    static int hardwareThreads();
+};
+
+}  // namespace project
@@ -12,20 +12,75 @@ namespace project {
 // Default constructor
 Bin::Bin()
     : id(""), location(""), capacity(0), currentFill(0), initialFill(0), fillRate(0), nodeId(-1),
-      historyIndex(0) {
-    for (int i = 0; i < 7; ++i) {
-        fillHistory[i] = 0;
-    }
+      fillHistory(inlineHistory), historyDays(0) {
+    allocateHistory(DEFAULT_HISTORY_DAYS);
 }
 
 // Constructor
 Bin::Bin(const std::string& id, const std::string& location, int capacity, int currentFill,
-         int fillRate, int nodeId)
+         int fillRate, int nodeId, int historyDays)
     : id(id), location(location), capacity(capacity), currentFill(currentFill),
-      initialFill(currentFill), fillRate(fillRate), nodeId(nodeId), historyIndex(0) {
-    for (int i = 0; i < 7; ++i) {  // Initialize fill history to 0
+      initialFill(currentFill), fillRate(fillRate), nodeId(nodeId), fillHistory(inlineHistory),
+      historyDays(0) {
+    allocateHistory(historyDays);
+}
+
+Bin::Bin(const Bin& other)
+    : id(other.id), location(other.location), capacity(other.capacity),
+      currentFill(other.currentFill), initialFill(other.initialFill), fillRate(other.fillRate),
+      nodeId(other.nodeId), fillHistory(inlineHistory), historyDays(0) {
+    copyHistory(other);
+}
+
+Bin& Bin::operator=(const Bin& other) {
+    if (this != &other) {
+        id = other.id;
+        location = other.location;
+        capacity = other.capacity;
+        currentFill = other.currentFill;
+        initialFill = other.initialFill;
+        fillRate = other.fillRate;
+        nodeId = other.nodeId;
+        copyHistory(other);
+    }
+    return *this;
+}
+
+Bin::~Bin() {
+    if (fillHistory != inlineHistory)
+        delete[] fillHistory;
+}
+
+// Boş bir pencere hazırlar; kısa pencereler nesnenin içinde kalır
+void Bin::allocateHistory(int days) {
+    if (days < 1)
+        days = 1;
+    if (days != historyDays) {
+        if (fillHistory != inlineHistory)
+            delete[] fillHistory;
+        fillHistory = days <= DEFAULT_HISTORY_DAYS ? inlineHistory : new int[days];
+        historyDays = days;
+    }
+    for (int i = 0; i < historyDays; ++i) {  // Initialize fill history to 0
         fillHistory[i] = 0;
     }
+    historyIndex = 0;
+    recordedDays = 0;
+    historySum = 0;
+    changeSum = 0;
+    changeSquares = 0;
+}
+
+void Bin::copyHistory(const Bin& other) {
+    allocateHistory(other.historyDays);
+    for (int i = 0; i < historyDays; ++i) {
+        fillHistory[i] = other.fillHistory[i];
+    }
+    historyIndex = other.historyIndex;
+    recordedDays = other.recordedDays;
+    historySum = other.historySum;
+    changeSum = other.changeSum;
+    changeSquares = other.changeSquares;
 }
 
 void Bin::updateFill() {  // Updates the fill level for one day
@@ -51,18 +106,49 @@ void Bin::collect(int amount) {  // Empties the bin by a specified amount
 }
 
 void Bin::recordFillLevel(int fillLevel) {  // Records fill level into circular history buffer
+    int oldest = fillHistory[historyIndex];  // pencereden çıkacak seviye (boşsa 0)
+    if (recordedDays == historyDays && historyDays > 1) {
+        // En eski günlük değişim pencereden çıkar
+        long long leaving = fillHistory[(historyIndex + 1) % historyDays] - oldest;
+        changeSum -= leaving;
+        changeSquares -= leaving * leaving;
+    }
+    if (recordedDays > 0 && historyDays > 1) {
+        long long change =
+            fillLevel - static_cast<long long>(
+                            fillHistory[(historyIndex + historyDays - 1) % historyDays]);
+        changeSum += change;
+        changeSquares += change * change;
+    }
+    historySum += fillLevel - static_cast<long long>(oldest);
+
     fillHistory[historyIndex] = fillLevel;
-    historyIndex = (historyIndex + 1) % 7;  // for cycle
+    historyIndex = (historyIndex + 1) % historyDays;  // for cycle
+    if (recordedDays < historyDays)
+        recordedDays++;
 }
 
 double Bin::getAverageFillRate() const {  // we calculate average fill rate
-    int sum = 0;
+    return historySum / static_cast<double>(historyDays);
+}
 
-    for (int i = 0; i < 7; ++i) {
-        sum += fillHistory[i];
-    }
+double Bin::getAverageDailyChange() const {
+    if (recordedDays < 2 || historyDays < 2)
+        return 0.0;
+    return changeSum / static_cast<double>(recordedDays - 1);
+}
 
-    return sum / 7.0;
+double Bin::getDailyChangeVariance() const {
+    if (recordedDays < 2 || historyDays < 2)
+        return 0.0;
+    double count = recordedDays - 1;
+    double mean = changeSum / count;
+    double variance = changeSquares / count - mean * mean;
+    return variance > 0.0 ? variance : 0.0;  // yuvarlama eksiye düşürmesin
+}
+
+void Bin::setHistoryDays(int days) {
+    allocateHistory(days);
 }
 
 bool Bin::isOverflowing() const {  // we check if bin is overflowing
@@ -106,6 +192,14 @@ const int* Bin::getFillHistory() const {
 int Bin::getHistoryIndex() const {
     return historyIndex;
 }
+
+int Bin::getHistoryDays() const {
+    return historyDays;
+}
+
+int Bin::getRecordedDays() const {
+    return recordedDays;
+}
 // Set
 void Bin::setCurrentFill(int fill) {
     currentFill = fill;
@@ -0,0 +1,234 @@
+/**
+ * @file BinStore.cpp
+ * @brief Implementation of BinStore class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/BinStore.h"
+
+#include <new>
+
+#ifdef PROJECT_HAS_AVX2_KERNEL
+#include <immintrin.h>
+#endif
+
+namespace project {
+
+namespace {
+
+const std::size_t ALIGNMENT = 32;  // bir AVX2 yazmacı
+
+int* allocateAligned(int count) {
+    return static_cast<int*>(
+        ::operator new[](sizeof(int) * count, std::align_val_t(ALIGNMENT)));
+}
+
+void freeAligned(int* block) {
+    if (block != nullptr)
+        ::operator delete[](block, std::align_val_t(ALIGNMENT));
+}
+
+int advanceScalar(int* fill, const int* fillRate, const int* capacity, int* historyRow,
+                  int count) {
+    int overflowing = 0;
+    for (int i = 0; i < count; i++) {
+        int next = fill[i] + fillRate[i];
+        if (next > capacity[i])
+            next = capacity[i];  // Bin::updateFill gibi kapasitede kırpılır
+        fill[i] = next;
+        historyRow[i] = next;
+        overflowing += next >= capacity[i];
+    }
+    return overflowing;
+}
+
+#ifdef PROJECT_HAS_AVX2_KERNEL
+// Sekizer bin: topla, kapasiteyle min, satıra yaz; taşanlar maskeden sayılır
+PROJECT_AVX2_TARGET int advanceAvx2(int* fill, const int* fillRate, const int* capacity,
+                                    int* historyRow, int count) {
+    int overflowing = 0;
+    for (int i = 0; i < count; i += 8) {
+        __m256i f = _mm256_load_si256(reinterpret_cast<const __m256i*>(fill + i));
+        __m256i r = _mm256_load_si256(reinterpret_cast<const __m256i*>(fillRate + i));
+        __m256i c = _mm256_load_si256(reinterpret_cast<const __m256i*>(capacity + i));
+        __m256i next = _mm256_min_epi32(_mm256_add_epi32(f, r), c);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(fill + i), next);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(historyRow + i), next);
+        // next >= c  <=>  !(c > next)
+        __m256i below = _mm256_cmpgt_epi32(c, next);
+        int belowMask = _mm256_movemask_ps(_mm256_castsi256_ps(below));
+        overflowing += 8 - __builtin_popcount(static_cast<unsigned int>(belowMask));
+    }
+    return overflowing;
+}
+#endif
+
+}  // namespace
+
+BinStore::BinStore()
+    : binCount(0),
+      paddedCount(0),
+      capacity(nullptr),
+      fill(nullptr),
+      fillRate(nullptr),
+      node(nullptr),
+      history(nullptr),
+      historyDays(Bin::DEFAULT_HISTORY_DAYS),
+      historyRow(0),
+      daysAdvanced(0),
+      unwritten(0),
+      kernel(Kernel::Auto) {}
+
+BinStore::~BinStore() {
+    release();
+}
+
+void BinStore::release() {
+    freeAligned(capacity);
+    freeAligned(fill);
+    freeAligned(fillRate);
+    freeAligned(node);
+    freeAligned(history);
+    capacity = fill = fillRate = node = history = nullptr;
+    binCount = paddedCount = 0;
+}
+
+void BinStore::load(const Facilities& facilities) {
+    release();
+    binCount = facilities.getBinCount();
+    paddedCount = (binCount + 7) / 8 * 8;
+    int slots = paddedCount > 0 ? paddedCount : 8;
+    capacity = allocateAligned(slots);
+    fill = allocateAligned(slots);
+    fillRate = allocateAligned(slots);
+    node = allocateAligned(slots);
+
+    // Halka en uzun geçmiş penceresi kadar gün tutar: geri yazarken gün kaybolmasın
+    historyDays = Bin::DEFAULT_HISTORY_DAYS;
+    for (int i = 0; i < binCount; i++) {
+        int days = facilities.getBin(i).getHistoryDays();
+        if (days > historyDays)
+            historyDays = days;
+    }
+    history = allocateAligned(slots * historyDays);
+
+    for (int i = 0; i < slots; i++) {
+        if (i < binCount) {
+            const Bin& bin = facilities.getBin(i);
+            capacity[i] = bin.getCapacity();
+            fill[i] = bin.getCurrentFill();
+            fillRate[i] = bin.getFillRate();
+            node[i] = bin.getNodeId();
+        } else {  // dolgu: hiç dolmayan boş bin, taşma sayılmaz
+            capacity[i] = 1;
+            fill[i] = 0;
+            fillRate[i] = 0;
+            node[i] = -1;
+        }
+    }
+    for (long long k = 0; k < static_cast<long long>(slots) * historyDays; k++) {
+        history[k] = 0;
+    }
+    historyRow = 0;
+    daysAdvanced = 0;
+    unwritten = 0;
+}
+
+void BinStore::clear() {
+    release();
+    historyRow = 0;
+    daysAdvanced = 0;
+    unwritten = 0;
+}
+
+int BinStore::advanceDay() {
+    if (paddedCount == 0)
+        return 0;
+    int* row = history + static_cast<long long>(historyRow) * paddedCount;
+    int overflowing = 0;
+#ifdef PROJECT_HAS_AVX2_KERNEL
+    if (getKernel() == Kernel::Avx2)
+        overflowing = advanceAvx2(fill, fillRate, capacity, row, paddedCount);
+    else
+        overflowing = advanceScalar(fill, fillRate, capacity, row, paddedCount);
+#else
+    overflowing = advanceScalar(fill, fillRate, capacity, row, paddedCount);
+#endif
+    historyRow = (historyRow + 1) % historyDays;
+    daysAdvanced++;
+    unwritten++;
+    return overflowing;
+}
+
+void BinStore::collect(int index, int amount) {
+    if (amount < 0)
+        return;
+    fill[index] -= amount;
+    if (fill[index] < 0)
+        fill[index] = 0;
+}
+
+void BinStore::writeTo(Facilities& facilities) {
+    int days = unwritten < historyDays ? unwritten : historyDays;
+    // Günlerin satırları bir kez bulunur, en eski gün önce (Bin'in sırasıyla)
+    const int** rows = new const int*[days > 0 ? days : 1];
+    for (int d = 0; d < days; d++) {
+        int row = ((historyRow - days + d) % historyDays + historyDays) % historyDays;
+        rows[d] = history + static_cast<long long>(row) * paddedCount;
+    }
+    Bin* bins = facilities.getBins();
+    for (int i = 0; i < binCount; i++) {
+        for (int d = 0; d < days; d++) {
+            bins[i].recordFillLevel(rows[d][i]);
+        }
+        bins[i].setCurrentFill(fill[i]);
+    }
+    delete[] rows;
+    unwritten = 0;
+}
+
+void BinStore::setKernel(Kernel selected) {
+    kernel = selected;
+}
+
+BinStore::Kernel BinStore::getKernel() const {
+    return resolveKernel(kernel);
+}
+
+bool BinStore::hasAvx2() {
+    return cpuHasAvx2();
+}
+
+int BinStore::getBinCount() const {
+    return binCount;
+}
+
+int BinStore::getCapacity(int index) const {
+    return capacity[index];
+}
+
+int BinStore::getFill(int index) const {
+    return fill[index];
+}
+
+int BinStore::getFillRate(int index) const {
+    return fillRate[index];
+}
+
+int BinStore::getNode(int index) const {
+    return node[index];
+}
+
+int BinStore::getHistoryDays() const {
+    return historyDays;
+}
+
+int BinStore::getHistory(int index, int daysAgo) const {
+    if (daysAgo < 0 || daysAgo >= historyDays || daysAgo >= daysAdvanced)
+        return 0;
+    int row = ((historyRow - 1 - daysAgo) % historyDays + historyDays) % historyDays;
+    return history[static_cast<long long>(row) * paddedCount + index];
+}
+
+}  // namespace project
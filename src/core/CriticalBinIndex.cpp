@@ -0,0 +1,144 @@
+/**
+ * @file CriticalBinIndex.cpp
+ * @brief Implementation of CriticalBinIndex class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/CriticalBinIndex.h"
+
+#include <climits>
+
+namespace project {
+
+CriticalBinIndex::CriticalBinIndex(int threshold)
+    : taken(nullptr),
+      takenDays(nullptr),
+      binCount(0),
+      criticalThreshold(threshold),
+      enabled(false) {}
+
+CriticalBinIndex::~CriticalBinIndex() {
+    delete[] taken;
+    delete[] takenDays;
+}
+
+void CriticalBinIndex::build(const Facilities& facilities, const OverflowPredictor& predictor,
+                             int today) {
+    int count = facilities.getBinCount();
+    if (count != binCount) {
+        queue.resize(count);
+        delete[] taken;
+        delete[] takenDays;
+        taken = count > 0 ? new int[count] : nullptr;
+        takenDays = count > 0 ? new long long[count] : nullptr;
+        binCount = count;
+    } else {
+        queue.clear();
+    }
+    for (int i = 0; i < binCount; i++) {
+        update(i, facilities.getBin(i), predictor, today);
+    }
+}
+
+bool CriticalBinIndex::update(int index, const Bin& bin, const OverflowPredictor& predictor,
+                              int today) {
+    long long day = overflowDay(bin, index, predictor, today);
+    bool queued = queue.contains(index);
+    if (day == LLONG_MAX) {
+        if (!queued)
+            return false;
+        queue.remove(index);  // hiç dolmayan bin kuyrukta durmaz
+    } else if (!queued) {
+        queue.push(index, day);
+    } else if (queue.getPriority(index) != day) {
+        queue.changeKey(index, day);
+    } else {
+        return false;  // tahmin günü değişmedi: yığın aynı kalır
+    }
+    return true;
+}
+
+void CriticalBinIndex::clear() {
+    queue.resize(0);
+    delete[] taken;
+    delete[] takenDays;
+    taken = nullptr;
+    takenDays = nullptr;
+    binCount = 0;
+}
+
+long long CriticalBinIndex::overflowDay(const Bin& bin, int index,
+                                        const OverflowPredictor& predictor, int today) {
+    // Tarama ile aynı tahmin: isCritical <=> gün <= bugün + eşik
+    int days = predictor.predictDaysToOverflow(bin, index);
+    if (days == -1)
+        return today - 1LL;  // zaten taşıyor
+    if (days == INT_MAX)
+        return LLONG_MAX;
+    return today + static_cast<long long>(days);
+}
+
+bool CriticalBinIndex::hasCritical(int today) const {
+    return !queue.isEmpty() &&
+           queue.topPriority() <= today + static_cast<long long>(criticalThreshold);
+}
+
+int CriticalBinIndex::collect(int limit, long long lastDay, int* bins) {
+    int count = 0;
+    while (count < limit && !queue.isEmpty() && queue.topPriority() <= lastDay) {
+        taken[count] = queue.top();
+        takenDays[count] = queue.topPriority();
+        bins[count] = taken[count];
+        count++;
+        queue.pop();
+    }
+    for (int k = 0; k < count; k++) {  // sorgu kuyruğu değiştirmez
+        queue.push(taken[k], takenDays[k]);
+    }
+    return count;
+}
+
+int CriticalBinIndex::getCriticalBins(int today, int* bins) {
+    return collect(binCount, today + static_cast<long long>(criticalThreshold), bins);
+}
+
+int CriticalBinIndex::getMostUrgent(int k, int* bins) {
+    return collect(k < binCount ? k : binCount, LLONG_MAX, bins);
+}
+
+bool CriticalBinIndex::contains(int index) const {
+    return queue.contains(index);
+}
+
+long long CriticalBinIndex::getOverflowDay(int index) const {
+    return queue.getPriority(index);
+}
+
+int CriticalBinIndex::size() const {
+    return queue.size();
+}
+
+int CriticalBinIndex::getBinCount() const {
+    return binCount;
+}
+
+void CriticalBinIndex::setCriticalThreshold(int threshold) {
+    criticalThreshold = threshold;
+}
+
+int CriticalBinIndex::getCriticalThreshold() const {
+    return criticalThreshold;
+}
+
+void CriticalBinIndex::setEnabled(bool value) {
+    if (!value)
+        clear();  // kapalıyken güncellenmez; açılınca yeniden kurulur
+    enabled = value;
+}
+
+bool CriticalBinIndex::isEnabled() const {
+    return enabled;
+}
+
+}  // namespace project
@@ -0,0 +1,246 @@
+/**
+ * @file DistanceMatrix.cpp
+ * @brief Implementation of DistanceMatrix class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/DistanceMatrix.h"
+
+#include "core/RoutePlanner.h"
+#include "utils/ThreadPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+
+namespace project {
+
+DistanceMatrix::DistanceMatrix()
+    : pointCount(0), pointNodes(nullptr), nodeCount(0), nodeToPoint(nullptr), cells16(nullptr),
+      cells32(nullptr), buildMillis(0.0), buildThreads(0), buildPeak(0) {}
+
+DistanceMatrix::~DistanceMatrix() {
+    release();
+}
+
+DistanceMatrix::DistanceMatrix(const DistanceMatrix& other)
+    : pointCount(0), pointNodes(nullptr), nodeCount(0), nodeToPoint(nullptr), cells16(nullptr),
+      cells32(nullptr), buildMillis(0.0), buildThreads(0), buildPeak(0) {
+    copyFrom(other);
+}
+
+DistanceMatrix& DistanceMatrix::operator=(const DistanceMatrix& other) {
+    if (this != &other) {
+        release();
+        copyFrom(other);
+    }
+    return *this;
+}
+
+void DistanceMatrix::release() {
+    delete[] pointNodes;
+    delete[] nodeToPoint;
+    delete[] cells16;
+    delete[] cells32;
+    pointNodes = nullptr;
+    nodeToPoint = nullptr;
+    cells16 = nullptr;
+    cells32 = nullptr;
+    pointCount = 0;
+    nodeCount = 0;
+}
+
+void DistanceMatrix::copyFrom(const DistanceMatrix& other) {
+    pointCount = other.pointCount;
+    nodeCount = other.nodeCount;
+    buildMillis = other.buildMillis;
+    buildThreads = other.buildThreads;
+    buildPeak = other.buildPeak;
+
+    if (other.pointNodes != nullptr) {
+        pointNodes = new int[pointCount];
+        for (int i = 0; i < pointCount; i++) {
+            pointNodes[i] = other.pointNodes[i];
+        }
+    }
+    if (other.nodeToPoint != nullptr) {
+        nodeToPoint = new int[nodeCount];
+        for (int i = 0; i < nodeCount; i++) {
+            nodeToPoint[i] = other.nodeToPoint[i];
+        }
+    }
+
+    long long cellCount = static_cast<long long>(pointCount) * pointCount;
+    if (other.cells16 != nullptr) {
+        cells16 = new unsigned short[cellCount];
+        for (long long i = 0; i < cellCount; i++) {
+            cells16[i] = other.cells16[i];
+        }
+    }
+    if (other.cells32 != nullptr) {
+        cells32 = new int[cellCount];
+        for (long long i = 0; i < cellCount; i++) {
+            cells32[i] = other.cells32[i];
+        }
+    }
+}
+
+bool DistanceMatrix::build(const RoutePlanner& planner, const int* nodes, int count,
+                           Storage storage, int threads) {
+    release();
+    buildPeak = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    // Node -> point table sized to the largest node ID
+    int maxNode = -1;
+    for (int i = 0; i < count; i++) {
+        if (nodes[i] > maxNode) {
+            maxNode = nodes[i];
+        }
+    }
+    if (maxNode < 0) {
+        return true;  // nothing to store
+    }
+
+    nodeCount = maxNode + 1;
+    nodeToPoint = new int[nodeCount];
+    for (int i = 0; i < nodeCount; i++) {
+        nodeToPoint[i] = -1;
+    }
+
+    // Deduplicate points
+    pointNodes = new int[count];
+    for (int i = 0; i < count; i++) {
+        int node = nodes[i];
+        if (node >= 0 && nodeToPoint[node] == -1) {
+            nodeToPoint[node] = pointCount;
+            pointNodes[pointCount] = node;
+            pointCount++;
+        }
+    }
+
+    if (pointCount > MAX_POINTS) {
+        release();
+        return false;
+    }
+
+    // One one-to-many search per row, rows spread over the pool
+    long long cellCount = static_cast<long long>(pointCount) * pointCount;
+    long long indexBytes = static_cast<long long>(pointCount + nodeCount) * sizeof(int);
+    {
+        ThreadPool pool(threads);
+        buildThreads = pool.getThreadCount();
+        long long rowBytes = static_cast<long long>(buildThreads) * pointCount * sizeof(int);
+
+        buildPeak = indexBytes;
+        bool compact = false;
+        if (storage == Storage::Auto) {
+            buildPeak = indexBytes + cellCount * sizeof(unsigned short) + rowBytes;
+            compact = fillCompact(planner, pool);
+        }
+        if (!compact) {
+            long long widePeak = indexBytes + cellCount * sizeof(int);
+            if (widePeak > buildPeak) {
+                buildPeak = widePeak;
+            }
+            fillWide(planner, pool);
+        }
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    buildMillis = std::chrono::duration<double, std::milli>(end - start).count();
+    return true;
+}
+
+// Satırlar doğrudan 16-bit hücrelere yazılır; sığmayan ilk mesafede vazgeçilir
+bool DistanceMatrix::fillCompact(const RoutePlanner& planner, ThreadPool& pool) {
+    cells16 = new unsigned short[static_cast<long long>(pointCount) * pointCount];
+    std::atomic<bool> fits(true);
+    unsigned short* table = cells16;
+    const int* points = pointNodes;
+    int n = pointCount;
+    pool.parallelFor(0, n, [&planner, &fits, table, points, n](int row) {
+        if (!fits.load(std::memory_order_relaxed)) {
+            return;  // tablo zaten 32-bit olarak yeniden kurulacak
+        }
+        int* distances = new int[n];
+        planner.computeDistances(points[row], points, n, distances);
+        unsigned short* cells = table + static_cast<long long>(row) * n;
+        for (int j = 0; j < n; j++) {
+            if (distances[j] == INT_MAX) {
+                cells[j] = UNREACHABLE_16;
+            } else if (distances[j] < UNREACHABLE_16) {
+                cells[j] = static_cast<unsigned short>(distances[j]);
+            } else {
+                fits.store(false, std::memory_order_relaxed);
+                break;
+            }
+        }
+        delete[] distances;
+    });
+
+    if (!fits.load()) {
+        delete[] cells16;
+        cells16 = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void DistanceMatrix::fillWide(const RoutePlanner& planner, ThreadPool& pool) {
+    cells32 = new int[static_cast<long long>(pointCount) * pointCount];
+    int* table = cells32;
+    const int* points = pointNodes;
+    int n = pointCount;
+    pool.parallelFor(0, n, [&planner, table, points, n](int row) {
+        planner.computeDistances(points[row], points, n, table + static_cast<long long>(row) * n);
+    });
+}
+
+int DistanceMatrix::lookup(int from, int to) const {
+    long long cell = static_cast<long long>(nodeToPoint[from]) * pointCount + nodeToPoint[to];
+    if (cells16 != nullptr) {
+        unsigned short value = cells16[cell];
+        return value == UNREACHABLE_16 ? INT_MAX : value;
+    }
+    return cells32[cell];
+}
+
+int DistanceMatrix::getPointCount() const {
+    return pointCount;
+}
+
+bool DistanceMatrix::isCompact() const {
+    return cells16 != nullptr;
+}
+
+long long DistanceMatrix::getMemoryUsage() const {
+    long long cellCount = static_cast<long long>(pointCount) * pointCount;
+    long long bytes = static_cast<long long>(pointCount) * sizeof(int);  // point -> node
+    bytes += static_cast<long long>(nodeCount) * sizeof(int);            // node -> point
+    if (cells16 != nullptr) {
+        bytes += cellCount * sizeof(unsigned short);
+    }
+    if (cells32 != nullptr) {
+        bytes += cellCount * sizeof(int);
+    }
+    return bytes;
+}
+
+long long DistanceMatrix::getPeakMemoryUsage() const {
+    return buildPeak;
+}
+
+double DistanceMatrix::getBuildMillis() const {
+    return buildMillis;
+}
+
+void DistanceMatrix::printReport(std::ostream& out) const {
+    out << "Distance Matrix: " << pointCount << " points, " << (isCompact() ? 16 : 32)
+        << "-bit cells, " << getMemoryUsage() / 1024.0 << " KB (peak "
+        << buildPeak / 1024.0 << " KB while building), built in " << buildMillis
+        << " ms on " << buildThreads << " thread(s)\n";
+}
+
+}  // namespace project
@@ -0,0 +1,238 @@
+/**
+ * @file EmergencyRescheduler.cpp
+ * @brief Implementation of EmergencyRescheduler class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/EmergencyRescheduler.h"
+
+#include <climits>
+
+namespace project {
+
+EmergencyRescheduler::EmergencyRescheduler(const RoutePlanner& planner)
+    : planner(planner),
+      state(nullptr),
+      stopNodes(nullptr),
+      stopTrips(nullptr),
+      legDistances(nullptr),
+      tripLoads(nullptr),
+      tripCount(0),
+      slots(0),
+      lookups(0) {}
+
+EmergencyRescheduler::~EmergencyRescheduler() {
+    delete[] stopNodes;
+    delete[] stopTrips;
+    delete[] legDistances;
+    delete[] tripLoads;
+}
+
+void EmergencyRescheduler::reserve(int count) {
+    if (count <= slots) {
+        return;
+    }
+    int newSlots = slots > 0 ? slots : 16;
+    while (newSlots < count) {
+        newSlots *= 2;
+    }
+    int length = route.getLength();
+    int* nodes = new int[newSlots];
+    int* trips = new int[newSlots];
+    int* legs = new int[newSlots + 1];
+    int* loads = new int[newSlots + 1];
+    for (int i = 0; i < length && stopNodes != nullptr; i++) {
+        nodes[i] = stopNodes[i];
+        trips[i] = stopTrips[i];
+    }
+    for (int i = 0; i <= length && legDistances != nullptr; i++) {
+        legs[i] = legDistances[i];
+    }
+    for (int t = 0; t < tripCount; t++) {
+        loads[t] = tripLoads[t];
+    }
+    delete[] stopNodes;
+    delete[] stopTrips;
+    delete[] legDistances;
+    delete[] tripLoads;
+    stopNodes = nodes;
+    stopTrips = trips;
+    legDistances = legs;
+    tripLoads = loads;
+    slots = newSlots;
+}
+
+// Depot'u olmayan şehirde eksik uç (-1) yolsuz sayılır
+int EmergencyRescheduler::distance(int from, int to) {
+    if (from < 0 || to < 0) {
+        return 0;
+    }
+    lookups++;
+    return planner.computeDistance(from, to);
+}
+
+void EmergencyRescheduler::attach(const Route& seed, const PlanningState& snapshot) {
+    state = &snapshot;
+    route.clear();
+    tripCount = 0;
+    lookups = 0;
+    reserve(seed.getLength() + 1);
+    route = seed;
+
+    int capacity = snapshot.getTruckCapacity();
+    int previous =
+        snapshot.getTruckNode() != -1 ? snapshot.getTruckNode() : snapshot.getDepotNode();
+    tripLoads[0] = snapshot.getTruckLoad();
+    int trip = 0;
+    int length = route.getLength();
+    for (int k = 0; k < length; k++) {
+        stopTrips[k] = trip;
+        if (route.isDisposalAt(k)) {
+            stopNodes[k] = route.getDisposalNodeAt(k);
+            tripLoads[++trip] = 0;  // boşaltma durağı seferi bitirir
+        } else {
+            int bin = route.getBinAt(k);
+            int fill = snapshot.getFill(bin);
+            stopNodes[k] = snapshot.getNode(bin);
+            tripLoads[trip] += fill < capacity ? fill : capacity;
+        }
+        legDistances[k] = distance(previous, stopNodes[k]);
+        previous = stopNodes[k];
+    }
+    legDistances[length] = distance(previous, snapshot.getDepotNode());
+    tripCount = trip + 1;
+}
+
+void EmergencyRescheduler::insertStop(int position, int node, int bin, int legIn, int legOut,
+                                      int trip) {
+    int length = route.getLength();
+    reserve(length + 1);
+    for (int i = length; i > position; i--) {
+        stopNodes[i] = stopNodes[i - 1];
+        stopTrips[i] = stopTrips[i - 1];
+    }
+    for (int i = length + 1; i > position + 1; i--) {
+        legDistances[i] = legDistances[i - 1];
+    }
+    stopNodes[position] = node;
+    stopTrips[position] = trip;
+    legDistances[position] = legIn;
+    legDistances[position + 1] = legOut;
+    if (bin == -1) {
+        route.insertDisposalStop(position, node);
+    } else {
+        route.insertBin(position, bin);
+    }
+}
+
+long long EmergencyRescheduler::findPosition(int bin, int& position, int& legIn, int& legOut,
+                                            int& trip) {
+    int capacity = state->getTruckCapacity();
+    int fill = state->getFill(bin) < capacity ? state->getFill(bin) : capacity;
+    int node = state->getNode(bin);
+    int start = state->getTruckNode() != -1 ? state->getTruckNode() : state->getDepotNode();
+    int depot = state->getDepotNode();
+    int length = route.getLength();
+
+    // Her konum: önceki ve sonraki durak arasına ekle; eski bacak tablodan gelir
+    long long bestDetour = LLONG_MAX;
+    position = -1;
+    for (int p = 0; p <= length; p++) {
+        int pTrip = 0;
+        if (p > 0) {
+            pTrip = route.isDisposalAt(p - 1) ? stopTrips[p - 1] + 1 : stopTrips[p - 1];
+        }
+        if (tripLoads[pTrip] + fill > capacity || legDistances[p] == INT_MAX) {
+            continue;
+        }
+        int previous = p > 0 ? stopNodes[p - 1] : start;
+        int next = p < length ? stopNodes[p] : depot;
+        int in = distance(previous, node);
+        if (in == INT_MAX)
+            continue;
+        int out = distance(node, next);
+        if (out == INT_MAX)
+            continue;
+        long long detour = (long long)in + out - legDistances[p];
+        if (detour < bestDetour) {
+            bestDetour = detour;
+            position = p;
+            legIn = in;
+            legOut = out;
+            trip = pTrip;
+        }
+    }
+    return bestDetour;
+}
+
+int EmergencyRescheduler::insertionCost(int bin) {
+    if (state == nullptr) {
+        return -1;
+    }
+    int position = -1, legIn = 0, legOut = 0, trip = 0;
+    long long detour = findPosition(bin, position, legIn, legOut, trip);
+    return position != -1 ? (int)detour : -1;
+}
+
+int EmergencyRescheduler::insert(int bin) {
+    if (state == nullptr) {
+        return -1;
+    }
+    int capacity = state->getTruckCapacity();
+    int fill = state->getFill(bin) < capacity ? state->getFill(bin) : capacity;
+    int node = state->getNode(bin);
+    int start = state->getTruckNode() != -1 ? state->getTruckNode() : state->getDepotNode();
+    int depot = state->getDepotNode();
+    int length = route.getLength();
+
+    int bestPosition = -1, bestIn = 0, bestOut = 0, bestTrip = 0;
+    long long bestDetour = findPosition(bin, bestPosition, bestIn, bestOut, bestTrip);
+    if (bestPosition != -1) {
+        insertStop(bestPosition, node, bin, bestIn, bestOut, bestTrip);
+        tripLoads[bestTrip] += fill;
+        return (int)bestDetour;
+    }
+
+    // Hiçbir seferde yer yok: en yakın tesiste boşaltıp günün sonuna yeni sefer
+    int last = length > 0 ? stopNodes[length - 1] : start;
+    int site = planner.findNearestDisposal(last, *state);
+    if (site == -1) {
+        return -1;
+    }
+    int toSite = distance(last, site);
+    int toBin = distance(site, node);
+    int back = distance(node, depot);
+    if (toSite == INT_MAX || toBin == INT_MAX || back == INT_MAX ||
+        legDistances[length] == INT_MAX) {
+        return -1;
+    }
+    int added = toSite + toBin + back - legDistances[length];
+    insertStop(length, site, -1, toSite, toBin, tripCount - 1);
+    tripLoads[tripCount++] = 0;
+    insertStop(length + 1, node, bin, toBin, back, tripCount - 1);
+    tripLoads[tripCount - 1] += fill;
+    return added;
+}
+
+const Route& EmergencyRescheduler::getRoute() const {
+    return route;
+}
+
+long long EmergencyRescheduler::getPlannedDistance() const {
+    long long total = 0;
+    if (state == nullptr) {
+        return total;
+    }
+    for (int k = 0; k <= route.getLength(); k++) {
+        if (legDistances[k] != INT_MAX)
+            total += legDistances[k];
+    }
+    return total;
+}
+
+long long EmergencyRescheduler::getLookups() const {
+    return lookups;
+}
+
+}  // namespace project
@@ -13,26 +13,35 @@ namespace project {
 Facilities::Facilities() {
     bins = nullptr;
     binCount = 0;
+    binCapacity = 0;
+    trucks = new Truck[1];  // tek kamyonlu kod için varsayılan kamyon
+    truckCount = 1;
     facilities = nullptr;
     facilityCount = 0;
 }
 
 Facilities::~Facilities() {
     delete[] bins;
+    delete[] trucks;
     delete[] facilities;
 }
 
 void Facilities::addBin(const Bin& bin) {
-    // Binler 1 büyütülecek
-    Bin* bigger = new Bin[binCount + 1];
+    // Dizi doluysa kapasite ikiye katlanır, binlerce bin yüklerken kopyalama O(n) kalır
+    if (binCount == binCapacity) {
+        int newCapacity = binCapacity == 0 ? 8 : binCapacity * 2;
+        Bin* bigger = new Bin[newCapacity];
 
-    for (int i = 0; i < binCount; i = i + 1) {
-        bigger[i] = bins[i];
+        for (int i = 0; i < binCount; i = i + 1) {
+            bigger[i] = bins[i];
+        }
+
+        delete[] bins;
+        bins = bigger;
+        binCapacity = newCapacity;
     }
 
-    bigger[binCount] = bin;
-    delete[] bins;
-    bins = bigger;
+    bins[binCount] = bin;
     binCount = binCount + 1;
 }
 
@@ -54,6 +63,10 @@ Bin* Facilities::getBins() {
     return bins;
 }
 
+const Bin* Facilities::getBins() const {
+    return bins;
+}
+
 Bin& Facilities::getBin(int index) const {
     return bins[index];
 }
@@ -70,6 +83,10 @@ int Facilities::getFacilityCount() const {
     return facilityCount;
 }
 
+const Facility& Facilities::getFacility(int index) const {
+    return facilities[index];
+}
+
 // depo idyi çevir yoksa error
 int Facilities::getDepotNode() const {
     for (int i = 0; i < facilityCount; i = i + 1) {
@@ -109,11 +126,32 @@ int* Facilities::getDisposalNodes(int& count) const {
 }
 
 void Facilities::setTruck(const Truck& truck) {
-    this->truck = truck;
+    trucks[0] = truck;
 }
 
 Truck& Facilities::getTruck() {
-    return truck;
+    return trucks[0];
+}
+
+void Facilities::addTruck(const Truck& truck) {
+    Truck* bigger = new Truck[truckCount + 1];
+
+    for (int i = 0; i < truckCount; i = i + 1) {
+        bigger[i] = trucks[i];
+    }
+
+    bigger[truckCount] = truck;
+    delete[] trucks;
+    trucks = bigger;
+    truckCount = truckCount + 1;
+}
+
+Truck& Facilities::getTruck(int index) const {
+    return trucks[index];
+}
+
+int Facilities::getTruckCount() const {
+    return truckCount;
 }
 
 }  // namespace project
@@ -0,0 +1,113 @@
+/**
+ * @file FillForecaster.cpp
+ * @brief Implementation of FillForecaster class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/FillForecaster.h"
+
+#include <climits>
+
+namespace project {
+
+FillForecaster::FillForecaster(double alpha, double beta, double gamma)
+    : states(nullptr),
+      binCount(0),
+      day(0),
+      alpha(alpha),
+      beta(beta),
+      gamma(gamma),
+      enabled(false) {}
+
+FillForecaster::~FillForecaster() {
+    delete[] states;
+}
+
+void FillForecaster::load(const Facilities& facilities) {
+    reset(facilities.getBinCount());
+    for (int i = 0; i < binCount; i++) {
+        setLevel(i, facilities.getBin(i).getFillRate());
+    }
+}
+
+void FillForecaster::reset(int count) {
+    if (count != binCount) {
+        delete[] states;
+        states = count > 0 ? new State[count] : nullptr;
+        binCount = count;
+    }
+    for (int i = 0; i < binCount; i++) {
+        states[i].level = 0.0f;
+        states[i].trend = 0.0f;
+        for (int d = 0; d < SEASON_DAYS; d++) {
+            states[i].season[d] = 0.0f;
+        }
+    }
+    day = 0;
+}
+
+void FillForecaster::setLevel(int index, double level) {
+    states[index].level = static_cast<float>(level);
+}
+
+void FillForecaster::observe(int index, double inflow) {
+    State& s = states[index];
+    int slot = day % SEASON_DAYS;
+    double previous = s.level;
+    double level = alpha * (inflow - s.season[slot]) + (1.0 - alpha) * (previous + s.trend);
+    s.trend = static_cast<float>(beta * (level - previous) + (1.0 - beta) * s.trend);
+    s.season[slot] = static_cast<float>(gamma * (inflow - level) + (1.0 - gamma) * s.season[slot]);
+    s.level = static_cast<float>(level);
+}
+
+void FillForecaster::advanceDay() {
+    day++;
+}
+
+double FillForecaster::forecast(int index, int ahead) const {
+    const State& s = states[index];
+    double value = s.level + ahead * static_cast<double>(s.trend) +
+                   s.season[(day + ahead - 1) % SEASON_DAYS];
+    return value > 0.0 ? value : 0.0;
+}
+
+int FillForecaster::predictDaysToOverflow(int index, int remaining) const {
+    // Gün gün tahmini topla; boş yeri aşan ilk günden bir önceki gün tam kalan gündür
+    double total = 0.0;
+    for (int n = 1; n <= MAX_FORECAST_DAYS; n++) {
+        double next = total + forecast(index, n);
+        if (next > remaining)
+            return n > 1 ? n - 1 : 1;
+        total = next;
+    }
+    if (total <= 0.0)
+        return INT_MAX;  // hiç dolmuyor
+
+    // Uzun ufuk: toplanan günlerin ortalamasıyla devam et
+    double extra = (remaining - total) / (total / MAX_FORECAST_DAYS);
+    double days = MAX_FORECAST_DAYS + extra;
+    return days < INT_MAX - 1 ? static_cast<int>(days) : INT_MAX - 1;
+}
+
+void FillForecaster::setEnabled(bool value) {
+    enabled = value;
+}
+
+bool FillForecaster::isEnabled() const {
+    return enabled;
+}
+
+int FillForecaster::getBinCount() const {
+    return binCount;
+}
+
+int FillForecaster::getDay() const {
+    return day;
+}
+
+const FillForecaster::State& FillForecaster::getState(int index) const {
+    return states[index];
+}
+
+}  // namespace project
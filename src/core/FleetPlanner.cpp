@@ -0,0 +1,235 @@
+/**
+ * @file FleetPlanner.cpp
+ * @brief Implementation of FleetPlanner class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/FleetPlanner.h"
+
+#include "core/SavingsPlanner.h"
+#include "data_structures/PriorityQueue.hpp"
+
+#include <chrono>
+#include <climits>
+
+namespace project {
+
+FleetPlanner::FleetPlanner(RoutePlanner& planner, const Facilities& facilities, int threads)
+    : planner(planner),
+      truckCount(facilities.getTruckCount()),
+      binCount(facilities.getBinCount()),
+      territoryOf(nullptr),
+      territoryStart(nullptr),
+      territoryBins(nullptr),
+      states(nullptr),
+      improvers(nullptr),
+      routes(nullptr),
+      plannedBefore(0),
+      plannedAfter(0),
+      lastMillis(0.0),
+      pool(threads) {
+    territoryOf = new int[binCount > 0 ? binCount : 1];
+    territoryStart = new int[truckCount + 1];
+    territoryBins = new int[binCount > 0 ? binCount : 1];
+    states = new PlanningState[truckCount];
+    routes = new Route[truckCount];
+    improvers = new RouteImprover*[truckCount];
+    for (int t = 0; t < truckCount; t++) {
+        improvers[t] = new RouteImprover(planner);
+    }
+    assignBins(facilities);
+}
+
+FleetPlanner::~FleetPlanner() {
+    for (int t = 0; t < truckCount; t++) {
+        delete improvers[t];
+    }
+    delete[] improvers;
+    delete[] territoryOf;
+    delete[] territoryStart;
+    delete[] territoryBins;
+    delete[] states;
+    delete[] routes;
+}
+
+// Farthest-first seeds, then each bin to the nearest seed that still has room
+void FleetPlanner::assignBins(const Facilities& facilities) {
+    int n = binCount;
+    int seedCount = truckCount < n ? truckCount : n;
+    int* binNodes = new int[n > 0 ? n : 1];
+    for (int b = 0; b < n; b++) {
+        binNodes[b] = facilities.getBin(b).getNodeId();
+        territoryOf[b] = -1;
+    }
+
+    // seedDist[s * n + b] = d(seed s, bin b); nearest = min over seeds so far
+    int* seedDist = new int[static_cast<long long>(seedCount > 0 ? seedCount : 1) * n + 1];
+    int* nearest = new int[n > 0 ? n : 1];
+    bool* isSeed = new bool[n > 0 ? n : 1];
+    planner.computeDistances(facilities.getDepotNode(), binNodes, n, nearest);  // ilk tohum
+    for (int b = 0; b < n; b++) {
+        isSeed[b] = false;
+    }
+
+    for (int s = 0; s < seedCount; s++) {
+        int seed = -1, farthest = -2;
+        for (int b = 0; b < n; b++) {
+            int key = nearest[b] == INT_MAX ? -1 : nearest[b];  // ulaşılamayan en son seçilir
+            if (!isSeed[b] && key > farthest) {
+                seed = b;
+                farthest = key;
+            }
+        }
+        isSeed[seed] = true;
+
+        int* row = seedDist + static_cast<long long>(s) * n;
+        planner.computeDistances(binNodes[seed], binNodes, n, row);
+        for (int b = 0; b < n; b++) {
+            if (s == 0 || row[b] < nearest[b])
+                nearest[b] = row[b];  // depo mesafesi yalnızca ilk tohumu seçmek içindi
+        }
+    }
+
+    // Dengeli atama: (bin, tohum) çiftleri mesafe sırasıyla, kotası dolan tohum atlanır
+    int quota = truckCount > 0 ? (n + truckCount - 1) / truckCount : 0;
+    int* size = new int[truckCount];
+    for (int t = 0; t < truckCount; t++) {
+        size[t] = 0;
+    }
+    PriorityQueue<long long> pairs;
+    for (int s = 0; s < seedCount; s++) {
+        const int* row = seedDist + static_cast<long long>(s) * n;
+        for (int b = 0; b < n; b++) {
+            if (row[b] != INT_MAX)
+                pairs.push(static_cast<long long>(b) * seedCount + s, row[b]);
+        }
+    }
+    while (!pairs.isEmpty()) {
+        long long pair = pairs.top();
+        pairs.pop();
+        int b = static_cast<int>(pair / seedCount);
+        int s = static_cast<int>(pair % seedCount);
+        if (territoryOf[b] != -1 || size[s] >= quota)
+            continue;
+        territoryOf[b] = s;
+        size[s]++;
+    }
+    for (int b = 0; b < n; b++) {
+        if (territoryOf[b] != -1)
+            continue;
+        int smallest = 0;  // hiçbir tohumdan ulaşılamıyor
+        for (int t = 1; t < truckCount; t++) {
+            if (size[t] < size[smallest])
+                smallest = t;
+        }
+        territoryOf[b] = smallest;
+        size[smallest]++;
+    }
+
+    // Bölgeye göre grupla (counting sort, bin sırası korunur)
+    territoryStart[0] = 0;
+    for (int t = 0; t < truckCount; t++) {
+        territoryStart[t + 1] = territoryStart[t] + size[t];
+        size[t] = territoryStart[t];
+    }
+    for (int b = 0; b < n; b++) {
+        territoryBins[size[territoryOf[b]]++] = b;
+    }
+
+    delete[] binNodes;
+    delete[] seedDist;
+    delete[] nearest;
+    delete[] isSeed;
+    delete[] size;
+}
+
+void FleetPlanner::plan(const Facilities& facilities, double improveBudgetMs) {
+    auto start = std::chrono::steady_clock::now();
+    long long* before = new long long[truckCount];
+    long long* after = new long long[truckCount];
+
+    pool.parallelFor(0, truckCount, [&](int t) {
+        PlanningState& state = states[t];
+        int first = territoryStart[t];
+        state.capture(facilities, t, territoryBins + first, territoryStart[t + 1] - first);
+
+        // Rotalar durumun yuvalarıyla (bölge sırası) planlanır, sonra global index'e çevrilir
+        Route local = planner.getPlanningEngine() == RoutePlanner::PlanningEngine::Savings
+                          ? SavingsPlanner(planner, 20, 1).plan(state)
+                          : planner.planRoute(state);
+
+        improvers[t]->setTimeBudget(improveBudgetMs);
+        Route improved = improvers[t]->improve(local, state);
+        before[t] = improvers[t]->getInitialDistance();
+        after[t] = improvers[t]->getFinalDistance();
+
+        Route global;
+        for (int i = 0; i < improved.getLength(); i++) {
+            if (improved.isDisposalAt(i))
+                global.addDisposalStop(improved.getDisposalNodeAt(i));
+            else
+                global.addBin(state.getBinIndex(improved.getBinAt(i)));
+        }
+        global.setTotalDistance(improved.getTotalDistance());
+        routes[t] = global;
+    });
+
+    plannedBefore = plannedAfter = 0;
+    for (int t = 0; t < truckCount; t++) {
+        plannedBefore += before[t];
+        plannedAfter += after[t];
+    }
+    delete[] before;
+    delete[] after;
+
+    lastMillis =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+            .count();
+}
+
+const Route& FleetPlanner::getRoute(int truck) const {
+    return routes[truck];
+}
+
+int FleetPlanner::getTerritoryOf(int bin) const {
+    if (bin < 0 || bin >= binCount) {
+        return -1;
+    }
+    return territoryOf[bin];
+}
+
+int FleetPlanner::getTerritorySize(int truck) const {
+    if (truck < 0 || truck >= truckCount) {
+        return 0;
+    }
+    return territoryStart[truck + 1] - territoryStart[truck];
+}
+
+int FleetPlanner::getTruckCount() const {
+    return truckCount;
+}
+
+long long FleetPlanner::getPlannedBefore() const {
+    return plannedBefore;
+}
+
+long long FleetPlanner::getPlannedAfter() const {
+    return plannedAfter;
+}
+
+double FleetPlanner::getLastMillis() const {
+    return lastMillis;
+}
+
+int FleetPlanner::getThreadCount() const {
+    return pool.getThreadCount();
+}
+
+void FleetPlanner::setForecaster(const ForecastModel* model) {
+    for (int t = 0; t < truckCount; t++) {
+        states[t].setForecaster(model);
+    }
+}
+
+}  // namespace project
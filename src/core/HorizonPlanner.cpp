@@ -0,0 +1,152 @@
+/**
+ * @file HorizonPlanner.cpp
+ * @brief Implementation of HorizonPlanner class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/HorizonPlanner.h"
+
+#include "data_structures/PriorityQueue.hpp"
+
+namespace project {
+
+HorizonPlanner::HorizonPlanner(RoutePlanner& planner, int horizonDays, double detourFactor)
+    : planner(planner),
+      inserter(planner),
+      selected(nullptr),
+      days(nullptr),
+      critical(nullptr),
+      selectedSlots(0),
+      enabled(false),
+      horizonDays(horizonDays),
+      detourFactor(detourFactor),
+      mustCount(0),
+      optionalCount(0),
+      deferredCount(0) {}
+
+HorizonPlanner::~HorizonPlanner() {
+    delete[] selected;
+    delete[] days;
+    delete[] critical;
+}
+
+int HorizonPlanner::select(const Facilities& facilities, PlanningState& today, int truck) {
+    int binCount = facilities.getBinCount();
+    if (binCount > selectedSlots) {
+        delete[] selected;
+        delete[] days;
+        delete[] critical;
+        selected = new int[binCount];
+        days = new int[binCount];
+        critical = new bool[binCount];
+        selectedSlots = binCount;
+    }
+    predictor.predictBatch(facilities.getBins(), binCount, days, nullptr, critical);
+
+    // 1. Bekleyemeyecek bin'ler: kritik ya da bugünkü hızla yarına taşacak olanlar
+    int count = 0;
+    int nonEmpty = 0;
+    for (int i = 0; i < binCount; i++) {
+        const Bin& bin = facilities.getBin(i);
+        if (bin.getCurrentFill() == 0)
+            continue;
+        nonEmpty++;
+        if (critical[i] || bin.getCurrentFill() + bin.getFillRate() >= bin.getCapacity())
+            selected[count++] = i;
+    }
+    mustCount = count;
+    optionalCount = 0;
+
+    // 2. Zorunlu rota bir kez planlanır; isteğe bağlı bin'ler ona ekleme maliyetiyle fiyatlanır
+    if (mustCount > 0 && detourFactor > 0) {
+        mustState.capture(facilities, truck, selected, mustCount);
+        Route local = planner.planRoute(mustState);
+        Route route;
+        for (int k = 0; k < local.getLength(); k++) {
+            if (local.isDisposalAt(k))
+                route.addDisposalStop(local.getDisposalNodeAt(k));
+            else
+                route.addBin(mustState.getBinIndex(local.getBinAt(k)));
+        }
+        allBins.capture(facilities, truck);
+        inserter.attach(route, allBins);
+        double perStop = static_cast<double>(inserter.getPlannedDistance()) / mustCount;
+
+        // En acil olan önce denenir: ekleme sonraki adayların sapmasını değiştirir
+        PriorityQueue<int> due;
+        int first = 0;
+        for (int i = 0; i < binCount; i++) {
+            const Bin& bin = facilities.getBin(i);
+            if (first < mustCount && selected[first] == i) {
+                first++;
+                continue;
+            }
+            if (bin.getCurrentFill() == 0)
+                continue;
+            if (days[i] <= horizonDays)
+                due.push(i, days[i]);
+        }
+        while (!due.isEmpty()) {
+            int i = due.top();
+            due.pop();
+            const Bin& bin = facilities.getBin(i);
+            double allowance = detourFactor * perStop * bin.getCurrentFill() /
+                               (bin.getCapacity() > 0 ? bin.getCapacity() : 1);
+            int detour = inserter.insertionCost(i);
+            if (detour != -1 && detour <= allowance) {
+                inserter.insert(i);
+                selected[count++] = i;
+                optionalCount++;
+            }
+        }
+    }
+
+    deferredCount = nonEmpty - count;
+    today.capture(facilities, truck, selected, count);
+    return count;
+}
+
+void HorizonPlanner::setEnabled(bool value) {
+    enabled = value;
+}
+
+bool HorizonPlanner::isEnabled() const {
+    return enabled;
+}
+
+void HorizonPlanner::setForecaster(const ForecastModel* model) {
+    predictor.setForecaster(model);
+    mustState.setForecaster(model);
+    allBins.setForecaster(model);
+}
+
+void HorizonPlanner::setHorizonDays(int days) {
+    horizonDays = days;
+}
+
+int HorizonPlanner::getHorizonDays() const {
+    return horizonDays;
+}
+
+void HorizonPlanner::setDetourFactor(double factor) {
+    detourFactor = factor > 0 ? factor : 0.0;
+}
+
+double HorizonPlanner::getDetourFactor() const {
+    return detourFactor;
+}
+
+int HorizonPlanner::getMustCount() const {
+    return mustCount;
+}
+
+int HorizonPlanner::getOptionalCount() const {
+    return optionalCount;
+}
+
+int HorizonPlanner::getDeferredCount() const {
+    return deferredCount;
+}
+
+}  // namespace project
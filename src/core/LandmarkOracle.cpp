@@ -0,0 +1,240 @@
+/**
+ * @file LandmarkOracle.cpp
+ * @brief Implementation of LandmarkOracle class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/LandmarkOracle.h"
+
+#include "data_structures/IndexedPriorityQueue.hpp"
+
+#include <chrono>
+#include <climits>
+
+namespace project {
+
+namespace {
+
+// Full Dijkstra from `source`; `dist` receives every distance (INT_MAX if unreachable)
+void fullSearch(const CsrGraph& graph, int source, int* dist, IndexedPriorityQueue<int>& queue) {
+    int nodeCount = graph.getNodeCount();
+    for (int v = 0; v < nodeCount; v++) {
+        dist[v] = INT_MAX;
+    }
+    queue.clear();
+    dist[source] = 0;
+    queue.push(source, 0);
+
+    while (!queue.isEmpty()) {
+        int u = queue.top();
+        queue.pop();
+        const Edge* end = graph.edgesEnd(u);
+        for (const Edge* e = graph.edgesBegin(u); e != end; ++e) {
+            int candidate = dist[u] + e->weight;
+            if (candidate < dist[e->toNode]) {
+                dist[e->toNode] = candidate;
+                queue.pushOrDecrease(e->toNode, candidate);
+            }
+        }
+    }
+}
+
+// Round-trip distance used to judge how well a node is covered; unreachable counts as far
+long long roundTrip(int there, int back) {
+    if (there == INT_MAX || back == INT_MAX) {
+        return LLONG_MAX;
+    }
+    return static_cast<long long>(there) + back;
+}
+
+}  // namespace
+
+LandmarkOracle::LandmarkOracle(const CsrGraph& graph)
+    : network(graph),
+      nodeCount(graph.getNodeCount()),
+      landmarkCount(0),
+      landmarks(nullptr),
+      fromLandmark(nullptr),
+      toLandmark(nullptr),
+      buildMillis(0.0) {}
+
+LandmarkOracle::~LandmarkOracle() {
+    release();
+}
+
+void LandmarkOracle::release() {
+    delete[] landmarks;
+    delete[] fromLandmark;
+    delete[] toLandmark;
+    landmarks = nullptr;
+    fromLandmark = nullptr;
+    toLandmark = nullptr;
+    landmarkCount = 0;
+}
+
+// Farthest-landmark selection: start from node 0, then repeatedly take the node whose
+// round trip to the nearest chosen landmark is longest
+void LandmarkOracle::build(int count) {
+    release();
+    auto start = std::chrono::steady_clock::now();
+
+    if (count > nodeCount) {
+        count = nodeCount;
+    }
+    if (count <= 0) {
+        buildMillis = 0.0;
+        return;
+    }
+
+    CsrGraph reverse = network.transposed();
+    IndexedPriorityQueue<int> queue(nodeCount);
+    int* there = new int[nodeCount];
+    int* back = new int[nodeCount];
+    long long* coverage = new long long[nodeCount];
+
+    landmarks = new int[count];
+    fromLandmark = new int[static_cast<long long>(nodeCount) * count];
+    toLandmark = new int[static_cast<long long>(nodeCount) * count];
+    landmarkCount = count;
+
+    fullSearch(network, 0, there, queue);
+    fullSearch(reverse, 0, back, queue);
+    for (int v = 0; v < nodeCount; v++) {
+        coverage[v] = roundTrip(there[v], back[v]);
+    }
+
+    for (int i = 0; i < count; i++) {
+        int chosen = -1;
+        for (int v = 0; v < nodeCount; v++) {
+            if (network.getDegree(v) == 0 && reverse.getDegree(v) == 0)
+                continue;  // isolated nodes bound nothing
+            if (chosen == -1 || coverage[v] > coverage[chosen])
+                chosen = v;
+        }
+        if (chosen == -1) {
+            chosen = i;  // edgeless graph; any node will do
+        }
+        landmarks[i] = chosen;
+
+        fullSearch(network, chosen, there, queue);
+        fullSearch(reverse, chosen, back, queue);
+        for (int v = 0; v < nodeCount; v++) {
+            fromLandmark[static_cast<long long>(v) * count + i] = there[v];
+            toLandmark[static_cast<long long>(v) * count + i] = back[v];
+
+            long long trip = roundTrip(there[v], back[v]);
+            if (i == 0 || trip < coverage[v])
+                coverage[v] = trip;  // the start node was only a seed, forget it
+        }
+        coverage[chosen] = -1;  // never pick the same node twice
+    }
+
+    delete[] there;
+    delete[] back;
+    delete[] coverage;
+
+    auto end = std::chrono::steady_clock::now();
+    buildMillis = std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int LandmarkOracle::lowerBound(int from, int to) const {
+    if (landmarkCount == 0 || from == to || from < 0 || from >= nodeCount || to < 0 ||
+        to >= nodeCount)
+        return 0;
+
+    const int* fromU = fromLandmark + static_cast<long long>(from) * landmarkCount;
+    const int* fromV = fromLandmark + static_cast<long long>(to) * landmarkCount;
+    const int* toU = toLandmark + static_cast<long long>(from) * landmarkCount;
+    const int* toV = toLandmark + static_cast<long long>(to) * landmarkCount;
+
+    int best = 0;
+    for (int i = 0; i < landmarkCount; i++) {
+        // d(u, v) >= d(L, v) - d(L, u); if L reaches u but not v, u cannot reach v either
+        if (fromU[i] != INT_MAX) {
+            if (fromV[i] == INT_MAX)
+                return INT_MAX;
+            if (fromV[i] - fromU[i] > best)
+                best = fromV[i] - fromU[i];
+        }
+        // d(u, v) >= d(u, L) - d(v, L); if v reaches L but u does not, u cannot reach v
+        if (toV[i] != INT_MAX) {
+            if (toU[i] == INT_MAX)
+                return INT_MAX;
+            if (toU[i] - toV[i] > best)
+                best = toU[i] - toV[i];
+        }
+    }
+    return best;
+}
+
+// A* with landmark potentials; they are consistent, so settled nodes stay settled
+int LandmarkOracle::distance(int from, int to, int* settledCount) const {
+    if (settledCount != nullptr)
+        *settledCount = 0;
+    if (from < 0 || from >= nodeCount || to < 0 || to >= nodeCount)
+        return INT_MAX;
+
+    int* dist = new int[nodeCount];
+    bool* visited = new bool[nodeCount];
+    for (int v = 0; v < nodeCount; v++) {
+        dist[v] = INT_MAX;
+        visited[v] = false;
+    }
+
+    IndexedPriorityQueue<long long> open(nodeCount);
+    int startBound = lowerBound(from, to);
+    if (startBound != INT_MAX) {
+        dist[from] = 0;
+        open.push(from, startBound);
+    }
+
+    int settled = 0;
+    while (!open.isEmpty()) {
+        int current = open.top();
+        open.pop();
+        visited[current] = true;
+        settled++;
+        if (current == to)
+            break;
+
+        const Edge* end = network.edgesEnd(current);
+        for (const Edge* e = network.edgesBegin(current); e != end; ++e) {
+            int next = e->toNode;
+            if (visited[next] || dist[current] + e->weight >= dist[next])
+                continue;
+            int bound = lowerBound(next, to);
+            if (bound == INT_MAX)
+                continue;  // landmarks prove the target unreachable from here
+            dist[next] = dist[current] + e->weight;
+            open.pushOrDecrease(next, static_cast<long long>(dist[next]) + bound);
+        }
+    }
+
+    int result = dist[to];
+    if (settledCount != nullptr)
+        *settledCount = settled;
+    delete[] dist;
+    delete[] visited;
+    return result;
+}
+
+int LandmarkOracle::getLandmark(int index) const {
+    if (index < 0 || index >= landmarkCount) {
+        return -1;
+    }
+    return landmarks[index];
+}
+
+long long LandmarkOracle::getMemoryUsage() const {
+    long long bytes = static_cast<long long>(landmarkCount) * sizeof(int);
+    bytes += 2LL * nodeCount * landmarkCount * sizeof(int);  // to/from tables
+    return bytes;
+}
+
+void LandmarkOracle::printReport(std::ostream& out) const {
+    out << "Landmarks: " << landmarkCount << " landmarks, " << getMemoryUsage() / 1024.0
+        << " KB, built in " << buildMillis << " ms\n";
+}
+
+}  // namespace project
@@ -0,0 +1,121 @@
+/**
+ * @file LegCache.cpp
+ * @brief Implementation of LegCache class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/LegCache.h"
+
+namespace project {
+
+LegEntry::LegEntry(int f, int t) : from(f), to(t), path(), next(nullptr) {}
+
+LegCache::LegCache(const RoutePlanner& planner, int initialCap)
+    : planner(planner), capacity(initialCap > 0 ? initialCap : 1), size(0), hits(0), misses(0) {
+    buckets = new LegEntry*[capacity];
+    for (int i = 0; i < capacity; i++) {
+        buckets[i] = nullptr;
+    }
+}
+
+LegCache::~LegCache() {
+    clear();
+    delete[] buckets;
+}
+
+// (from, to) çiftini tek bir 64-bit anahtara katlayıp karıştır
+int LegCache::hashFunction(int from, int to) const {
+    unsigned long long key =
+        (static_cast<unsigned long long>(static_cast<unsigned int>(from)) << 32) |
+        static_cast<unsigned int>(to);
+    key *= 0x9E3779B97F4A7C15ULL;  // Fibonacci hashing
+    return static_cast<int>((key >> 32) % static_cast<unsigned long long>(capacity));
+}
+
+// Entry'ler yeniden oluşturulmaz, sadece yeni bucket'lara bağlanır (Path kopyası yok)
+void LegCache::resize() {
+    int oldCapacity = capacity;
+    LegEntry** oldBuckets = buckets;
+
+    capacity = capacity * 2 + 1;
+    buckets = new LegEntry*[capacity];
+    for (int i = 0; i < capacity; i++) {
+        buckets[i] = nullptr;
+    }
+
+    for (int i = 0; i < oldCapacity; i++) {
+        LegEntry* current = oldBuckets[i];
+        while (current != nullptr) {
+            LegEntry* next = current->next;
+            int index = hashFunction(current->from, current->to);
+            current->next = buckets[index];
+            buckets[index] = current;
+            current = next;
+        }
+    }
+
+    delete[] oldBuckets;
+}
+
+const Path& LegCache::getLeg(int from, int to) {
+    int index = hashFunction(from, to);
+    for (LegEntry* current = buckets[index]; current != nullptr; current = current->next) {
+        if (current->from == from && current->to == to) {
+            hits++;
+            return current->path;
+        }
+    }
+
+    misses++;
+    if (size >= capacity * 0.7) {
+        resize();
+        index = hashFunction(from, to);
+    }
+
+    LegEntry* entry = new LegEntry(from, to);
+    planner.computePath(from, to, entry->path);
+    entry->next = buckets[index];
+    buckets[index] = entry;
+    size++;
+    return entry->path;
+}
+
+bool LegCache::contains(int from, int to) const {
+    int index = hashFunction(from, to);
+    for (LegEntry* current = buckets[index]; current != nullptr; current = current->next) {
+        if (current->from == from && current->to == to) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void LegCache::clear() {
+    for (int i = 0; i < capacity; i++) {
+        LegEntry* current = buckets[i];
+        while (current != nullptr) {
+            LegEntry* temp = current;
+            current = current->next;
+            delete temp;
+        }
+        buckets[i] = nullptr;
+    }
+    size = 0;
+    hits = 0;
+    misses = 0;
+}
+
+int LegCache::getSize() const {
+    return size;
+}
+
+long long LegCache::getHits() const {
+    return hits;
+}
+
+long long LegCache::getMisses() const {
+    return misses;
+}
+
+}  // namespace project
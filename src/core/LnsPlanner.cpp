@@ -0,0 +1,686 @@
+/**
+ * @file LnsPlanner.cpp
+ * @brief Implementation of LnsPlanner class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/LnsPlanner.h"
+
+#include "data_structures/PriorityQueue.hpp"
+#include "utils/Random.h"
+
+#include <chrono>
+#include <climits>
+
+namespace project {
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+const int MAX_POINTS = 5000;          // local table is points^2 ints, as in RouteImprover
+const int MAX_REMOVED = 40;           // bins removed per iteration, at most
+const double START_THRESHOLD = 0.02;  // accept up to 2% above the best at the start
+const int WORST_BIAS = 3;             // worst removal picks rank floor(u^3 * n)
+
+/**
+ * Working state of one improve() call. Points index the local distance table:
+ * 0 = truck start, 1 = depot (end), then the route's bins, then the disposal sites.
+ * A tour starts with 0, ends with 1, and a disposal site inside it closes a trip;
+ * every bin appears exactly once between repairs.
+ */
+class DestroyRepair {
+public:
+    DestroyRepair(const int* table, int pointCount, int binCount, const int* load,
+                  const bool* isSite, const int* sites, int siteCount, int capacity,
+                  int initialLoad)
+        : table(table),
+          pointCount(pointCount),
+          binCount(binCount),
+          load(load),
+          isSite(isSite),
+          sites(sites),
+          siteCount(siteCount),
+          capacity(capacity),
+          initialLoad(initialLoad),
+          length(0),
+          currentLength(0),
+          bestLength(0),
+          removedCount(0),
+          neighborCount(0),
+          neighbors(nullptr) {
+        int maxStops = 2 * binCount + 3;
+        seq = new int[maxStops];
+        current = new int[maxStops];
+        best = new int[maxStops];
+        trip = new int[maxStops];
+        tripLoad = new long long[maxStops];
+        removed = new int[binCount];
+        isRemoved = new bool[pointCount];
+        shuffled = new int[binCount];
+        ranked = new int[binCount];
+        for (int p = 0; p < pointCount; p++) {
+            isRemoved[p] = false;
+        }
+        for (int b = 0; b < binCount; b++) {
+            shuffled[b] = 2 + b;
+        }
+    }
+
+    ~DestroyRepair() {
+        delete[] seq;
+        delete[] current;
+        delete[] best;
+        delete[] trip;
+        delete[] tripLoad;
+        delete[] removed;
+        delete[] isRemoved;
+        delete[] shuffled;
+        delete[] ranked;
+        delete[] neighbors;
+    }
+
+    DestroyRepair(const DestroyRepair&) = delete;
+    DestroyRepair& operator=(const DestroyRepair&) = delete;
+
+    long long arc(int a, int b) const {
+        return table[static_cast<long long>(a) * pointCount + b];
+    }
+
+    void append(int point) { seq[length++] = point; }
+
+    // Cheapest disposal site between two points
+    int bestSite(int from, int to) const {
+        int site = sites[0];
+        for (int k = 1; k < siteCount; k++) {
+            if (arc(from, sites[k]) + arc(sites[k], to) < arc(from, site) + arc(site, to))
+                site = sites[k];
+        }
+        return site;
+    }
+
+    // Seed tour, split exactly like RouteImprover: unload before a bin that would not fit,
+    // and where the order has a break (-1) left by the planner's own disposal stops
+    void split(const int* order, int orderLength) {
+        length = 0;
+        append(0);
+        long long carried = initialLoad;
+        for (int k = 0; k < orderLength; k++) {
+            if (order[k] == -1) {
+                int next = 1;
+                for (int t = k + 1; t < orderLength && next == 1; t++) {
+                    if (order[t] != -1)
+                        next = order[t];
+                }
+                if (siteCount > 0 && carried > 0) {
+                    append(bestSite(seq[length - 1], next));
+                    carried = 0;
+                }
+                continue;
+            }
+            int bin = order[k];
+            if (siteCount > 0 && carried > 0 && carried + load[bin] > capacity) {
+                append(bestSite(seq[length - 1], bin));
+                carried = 0;
+            }
+            append(bin);
+            carried += load[bin];
+        }
+        append(1);
+        tidy();
+        keepCurrent();
+        keepBest();
+    }
+
+    // Trip index of each position and load of each trip (trip 0 includes the initial load)
+    void refresh() {
+        int t = 0;
+        tripLoad[0] = initialLoad;
+        for (int k = 0; k < length; k++) {
+            trip[k] = t;
+            if (isSite[seq[k]])
+                tripLoad[++t] = 0;
+            else if (seq[k] >= 2)
+                tripLoad[t] += load[seq[k]];
+        }
+    }
+
+    // Cost with unreachable legs counted as INT_MAX, so the search avoids them
+    long long cost() const {
+        long long total = 0;
+        for (int k = 1; k < length; k++) {
+            total += arc(seq[k - 1], seq[k]);
+        }
+        return total;
+    }
+
+    // Distance actually driven: unreachable legs are skipped, as in the simulation
+    long long drivenDistance(const int* tour, int tourLength) const {
+        long long total = 0;
+        for (int k = 1; k < tourLength; k++) {
+            if (arc(tour[k - 1], tour[k]) != INT_MAX)
+                total += arc(tour[k - 1], tour[k]);
+        }
+        return total;
+    }
+
+    // Drops stops that close an empty trip, merges trips that fit together and moves
+    // every remaining stop to its cheapest site (shortest paths: never longer)
+    void tidy() {
+        int w = 1;
+        for (int k = 1; k < length; k++) {
+            int p = seq[k];
+            if (isSite[p]) {
+                int prev = seq[w - 1];
+                bool emptyTrip = isSite[prev] || (prev == 0 && initialLoad == 0);
+                if (emptyTrip || seq[k + 1] == 1)
+                    continue;  // boş sefer ya da depodan hemen önce boşaltma
+            }
+            seq[w++] = p;
+        }
+        length = w;
+
+        refresh();
+        for (int k = 1; k < length - 1; k++) {
+            if (!isSite[seq[k]])
+                continue;
+            if (tripLoad[trip[k]] + tripLoad[trip[k] + 1] <= capacity) {
+                for (int t = k; t < length - 1; t++) {
+                    seq[t] = seq[t + 1];
+                }
+                length--;
+                refresh();
+                k--;
+                continue;
+            }
+            seq[k] = bestSite(seq[k - 1], seq[k + 1]);
+        }
+    }
+
+    // K nearest bins of every bin, for related removal
+    void buildNeighbors(int count) {
+        neighborCount = count < binCount - 1 ? count : binCount - 1;
+        if (neighborCount <= 0)
+            return;
+        neighbors = new int[static_cast<long long>(binCount) * neighborCount];
+
+        long long* nearest = new long long[neighborCount];
+        for (int a = 0; a < binCount; a++) {
+            int* list = neighbors + static_cast<long long>(a) * neighborCount;
+            int filled = 0;
+            for (int b = 0; b < binCount; b++) {
+                if (b == a)
+                    continue;
+                long long d = arc(2 + a, 2 + b);
+                if (filled == neighborCount && d >= nearest[filled - 1])
+                    continue;
+                int k = filled < neighborCount ? filled++ : filled - 1;
+                while (k > 0 && nearest[k - 1] > d) {  // sıralı ekleme
+                    nearest[k] = nearest[k - 1];
+                    list[k] = list[k - 1];
+                    k--;
+                }
+                nearest[k] = d;
+                list[k] = 2 + b;
+            }
+        }
+        delete[] nearest;
+    }
+
+    void markRemoved(int point) {
+        isRemoved[point] = true;
+        removed[removedCount++] = point;
+    }
+
+    void removeRandom(Random& rng, int count) {
+        for (int k = 0; k < count; k++) {
+            int pick = k + rng.below(binCount - k);  // kısmi Fisher-Yates
+            int swap = shuffled[k];
+            shuffled[k] = shuffled[pick];
+            shuffled[pick] = swap;
+            markRemoved(shuffled[k]);
+        }
+    }
+
+    // Ranks bins by detour cost (most expensive first), then draws ranks biased to the top
+    void removeWorst(Random& rng, int count) {
+        PriorityQueue<int> byDetour;
+        for (int k = 1; k < length - 1; k++) {
+            if (isSite[seq[k]])
+                continue;
+            long long detour =
+                arc(seq[k - 1], seq[k]) + arc(seq[k], seq[k + 1]) - arc(seq[k - 1], seq[k + 1]);
+            if (detour > INT_MAX / 2)
+                detour = INT_MAX / 2;  // ulaşılamayan bacaklar: en pahalı
+            byDetour.push(seq[k], -static_cast<int>(detour));
+        }
+        int rankedCount = 0;
+        while (!byDetour.isEmpty()) {
+            ranked[rankedCount++] = byDetour.top();
+            byDetour.pop();
+        }
+        for (int k = 0; k < count; k++) {
+            double u = rng.unit();
+            double biased = u;
+            for (int e = 1; e < WORST_BIAS; e++) {
+                biased *= u;
+            }
+            int rank = static_cast<int>(biased * rankedCount);
+            markRemoved(ranked[rank]);
+            rankedCount--;
+            for (int r = rank; r < rankedCount; r++) {
+                ranked[r] = ranked[r + 1];  // sıra korunur
+            }
+        }
+    }
+
+    void removeRelated(Random& rng, int count) {
+        int seed = 2 + rng.below(binCount);
+        markRemoved(seed);
+        const int* list = neighbors + static_cast<long long>(seed - 2) * neighborCount;
+        for (int n = 0; n < neighborCount && removedCount < count; n++) {
+            markRemoved(list[n]);
+        }
+    }
+
+    // Cuts the removed bins out of the tour
+    void cut() {
+        int w = 0;
+        for (int k = 0; k < length; k++) {
+            if (!isRemoved[seq[k]])
+                seq[w++] = seq[k];
+        }
+        length = w;
+        tidy();
+    }
+
+    // Cheapest feasible insertion of one bin; a new trip at the end of the day if needed
+    void insert(int bin) {
+        long long bestDelta = LLONG_MAX, anyDelta = LLONG_MAX;
+        int bestGap = -1, anyGap = 0;
+        for (int g = 0; g < length - 1; g++) {
+            int a = seq[g], c = seq[g + 1];
+            long long delta = arc(a, bin) + arc(bin, c) - arc(a, c);
+            int target = trip[g] + (isSite[a] ? 1 : 0);
+            if (delta < anyDelta) {
+                anyDelta = delta;
+                anyGap = g;
+            }
+            if (delta < bestDelta && tripLoad[target] + load[bin] <= capacity) {
+                bestDelta = delta;
+                bestGap = g;
+            }
+        }
+
+        int last = seq[length - 2];
+        bool lastTripEmpty = isSite[last] || (last == 0 && initialLoad == 0);
+        if (siteCount > 0 && !lastTripEmpty) {
+            int site = bestSite(last, bin);
+            long long delta = arc(last, site) + arc(site, bin) + arc(bin, 1) - arc(last, 1);
+            if (delta < bestDelta) {
+                seq[length + 1] = 1;
+                seq[length] = bin;
+                seq[length - 1] = site;
+                length += 2;
+                refresh();
+                return;
+            }
+        }
+
+        int gap = bestGap >= 0 ? bestGap : anyGap;  // tesis yok: kapasite aşılsa da ekle
+        for (int k = length; k > gap + 1; k--) {
+            seq[k] = seq[k - 1];
+        }
+        seq[gap + 1] = bin;
+        length++;
+        refresh();
+    }
+
+    void repair(Random& rng) {
+        for (int k = removedCount - 1; k > 0; k--) {
+            int pick = rng.below(k + 1);
+            int swap = removed[k];
+            removed[k] = removed[pick];
+            removed[pick] = swap;
+        }
+        refresh();
+        for (int k = 0; k < removedCount; k++) {
+            isRemoved[removed[k]] = false;
+            insert(removed[k]);
+        }
+        removedCount = 0;
+        tidy();
+    }
+
+    void startFromCurrent() {
+        for (int k = 0; k < currentLength; k++) {
+            seq[k] = current[k];
+        }
+        length = currentLength;
+        refresh();
+    }
+
+    void keepCurrent() {
+        for (int k = 0; k < length; k++) {
+            current[k] = seq[k];
+        }
+        currentLength = length;
+    }
+
+    void keepBest() {
+        for (int k = 0; k < length; k++) {
+            best[k] = seq[k];
+        }
+        bestLength = length;
+    }
+
+    const int* table;
+    int pointCount;
+    int binCount;
+    const int* load;
+    const bool* isSite;
+    const int* sites;
+    int siteCount;
+    int capacity;
+    int initialLoad;
+
+    int* seq;              // tour being destroyed and repaired
+    int length;
+    int* current;          // accepted tour
+    int currentLength;
+    int* best;             // best tour so far
+    int bestLength;
+    int* trip;             // trip index of each position of `seq`
+    long long* tripLoad;   // load of each trip of `seq`
+    int* removed;          // bins taken out in this iteration
+    int removedCount;
+    bool* isRemoved;
+    int* shuffled;         // bin points, partially shuffled by random removal
+    int* ranked;           // bins by detour cost, for worst removal
+    int neighborCount;
+    int* neighbors;        // bin -> its nearest bins (points)
+};
+
+}  // namespace
+
+LnsPlanner::LnsPlanner(const RoutePlanner& planner, double timeBudgetMs, int maxIterations)
+    : planner(planner),
+      timeBudgetMs(timeBudgetMs > 0 ? timeBudgetMs : 0.0),
+      maxIterations(maxIterations > 0 ? maxIterations : 0),
+      seed(1),
+      initialDistance(0),
+      finalDistance(0),
+      iterations(0),
+      accepted(0),
+      improvements(0),
+      lastMillis(0.0),
+      traceMillis(nullptr),
+      traceDistance(nullptr),
+      traceLength(0),
+      traceCapacity(0) {
+    for (int r = 0; r < 3; r++) {
+        removalCalls[r] = 0;
+        removalImprovements[r] = 0;
+    }
+}
+
+LnsPlanner::~LnsPlanner() {
+    delete[] traceMillis;
+    delete[] traceDistance;
+}
+
+void LnsPlanner::recordBest(double millis, long long distance) {
+    if (traceLength == traceCapacity) {
+        int newCapacity = traceCapacity > 0 ? traceCapacity * 2 : 16;
+        double* newMillis = new double[newCapacity];
+        long long* newDistance = new long long[newCapacity];
+        for (int i = 0; i < traceLength; i++) {
+            newMillis[i] = traceMillis[i];
+            newDistance[i] = traceDistance[i];
+        }
+        delete[] traceMillis;
+        delete[] traceDistance;
+        traceMillis = newMillis;
+        traceDistance = newDistance;
+        traceCapacity = newCapacity;
+    }
+    traceMillis[traceLength] = millis;
+    traceDistance[traceLength] = distance;
+    traceLength++;
+}
+
+Route LnsPlanner::improve(const Route& route, Facilities& facilities) {
+    PlanningState state(facilities);
+    return improve(route, state);
+}
+
+Route LnsPlanner::improve(const Route& route, const PlanningState& state) {
+    auto start = Clock::now();
+    auto elapsedMs = [&start]() {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    };
+    initialDistance = finalDistance = 0;
+    iterations = accepted = 0;
+    improvements = 0;
+    for (int r = 0; r < 3; r++) {
+        removalCalls[r] = 0;
+        removalImprovements[r] = 0;
+    }
+    traceLength = 0;
+    lastMillis = 0.0;
+
+    int binCount = 0, breakCount = 0;
+    for (int i = 0; i < route.getLength(); i++) {
+        if (route.isDisposalAt(i))
+            breakCount++;
+        else
+            binCount++;
+    }
+    int siteCount = state.getDisposalCount();
+    const int* siteNodes = state.getDisposalNodes();
+    int pointCount = 2 + binCount + siteCount;
+    if (binCount == 0 || pointCount > MAX_POINTS) {
+        return route;
+    }
+
+    // Noktalar: 0 = başlangıç, 1 = depo, sonra bin'ler, sonra boşaltma tesisleri
+    int* nodes = new int[pointCount];
+    int* load = new int[pointCount];
+    bool* isSite = new bool[pointCount];
+    int* binOfPoint = new int[pointCount];
+    int* order = new int[binCount + breakCount];
+    int* sites = new int[siteCount > 0 ? siteCount : 1];
+
+    nodes[0] = state.getTruckNode();
+    nodes[1] = state.getDepotNode();
+    int point = 2;
+    for (int i = 0; i < route.getLength(); i++) {
+        if (route.isDisposalAt(i)) {
+            order[i] = -1;
+            continue;
+        }
+        int bin = route.getBinAt(i);
+        nodes[point] = state.getNode(bin);
+        binOfPoint[point] = bin;
+        order[i] = point;
+        point++;
+    }
+    for (int k = 0; k < siteCount; k++) {
+        nodes[point] = siteNodes[k];
+        sites[k] = point++;
+    }
+    for (int p = 0; p < pointCount; p++) {
+        bool bin = p >= 2 && p < 2 + binCount;
+        load[p] = bin ? state.getFill(binOfPoint[p]) : 0;
+        isSite[p] = p >= 2 + binCount;
+    }
+
+    int* table = new int[static_cast<long long>(pointCount) * pointCount];
+    for (int p = 0; p < pointCount; p++) {
+        planner.computeDistances(nodes[p], nodes, pointCount,
+                                 table + static_cast<long long>(p) * pointCount);
+    }
+
+    DestroyRepair search(table, pointCount, binCount, load, isSite, sites, siteCount,
+                         state.getTruckCapacity(), state.getTruckLoad());
+    search.split(order, binCount + breakCount);
+    long long currentCost = search.cost();
+    long long bestCost = currentCost;
+    initialDistance = search.drivenDistance(search.best, search.bestLength);
+    recordBest(0.0, initialDistance);
+
+    bool limited = timeBudgetMs > 0 || maxIterations > 0;
+    if (limited && binCount > 1) {
+        int maxRemoved = binCount / 4;
+        if (maxRemoved < 2)
+            maxRemoved = 2;
+        if (maxRemoved > MAX_REMOVED)
+            maxRemoved = MAX_REMOVED;
+        if (maxRemoved > binCount)
+            maxRemoved = binCount;
+        search.buildNeighbors(maxRemoved);
+        Random rng(seed);
+
+        while (true) {
+            double millis = elapsedMs();
+            double progress = 0.0;
+            if (timeBudgetMs > 0) {
+                if (millis >= timeBudgetMs)
+                    break;
+                progress = millis / timeBudgetMs;
+            }
+            if (maxIterations > 0) {
+                if (iterations >= maxIterations)
+                    break;
+                double done = static_cast<double>(iterations) / maxIterations;
+                progress = done > progress ? done : progress;
+            }
+            iterations++;
+
+            // Destroy
+            search.startFromCurrent();
+            int count = 1 + rng.below(maxRemoved);
+            int removal = rng.below(3);
+            if (removal == static_cast<int>(Removal::Random))
+                search.removeRandom(rng, count);
+            else if (removal == static_cast<int>(Removal::Worst))
+                search.removeWorst(rng, count);
+            else
+                search.removeRelated(rng, count);
+            removalCalls[removal]++;
+            search.cut();
+
+            // Repair
+            search.repair(rng);
+            long long cost = search.cost();
+
+            // Rekor-rekor kabul: eşik son tarihe doğru sıfıra iner
+            double threshold = START_THRESHOLD * (1.0 - progress);
+            if (cost <= currentCost || cost < bestCost + threshold * bestCost) {
+                search.keepCurrent();
+                currentCost = cost;
+                accepted++;
+            }
+            if (cost < bestCost) {
+                search.keepBest();
+                bestCost = cost;
+                improvements++;
+                removalImprovements[removal]++;
+                recordBest(elapsedMs(), search.drivenDistance(search.best, search.bestLength));
+            }
+        }
+    }
+    finalDistance = search.drivenDistance(search.best, search.bestLength);
+
+    Route improved;
+    for (int k = 1; k < search.bestLength - 1; k++) {
+        int p = search.best[k];
+        if (isSite[p])
+            improved.addDisposalStop(nodes[p]);
+        else
+            improved.addBin(binOfPoint[p]);
+    }
+    improved.setTotalDistance(finalDistance < INT_MAX ? static_cast<int>(finalDistance) : INT_MAX);
+
+    delete[] table;
+    delete[] nodes;
+    delete[] load;
+    delete[] isSite;
+    delete[] binOfPoint;
+    delete[] order;
+    delete[] sites;
+
+    lastMillis = elapsedMs();
+    return improved;
+}
+
+void LnsPlanner::setTimeBudget(double ms) {
+    timeBudgetMs = ms > 0 ? ms : 0.0;
+}
+
+double LnsPlanner::getTimeBudget() const {
+    return timeBudgetMs;
+}
+
+void LnsPlanner::setMaxIterations(int count) {
+    maxIterations = count > 0 ? count : 0;
+}
+
+int LnsPlanner::getMaxIterations() const {
+    return maxIterations;
+}
+
+void LnsPlanner::setSeed(unsigned int value) {
+    seed = value;
+}
+
+long long LnsPlanner::getInitialDistance() const {
+    return initialDistance;
+}
+
+long long LnsPlanner::getFinalDistance() const {
+    return finalDistance;
+}
+
+long long LnsPlanner::getIterations() const {
+    return iterations;
+}
+
+double LnsPlanner::getIterationsPerSecond() const {
+    return lastMillis > 0 ? iterations * 1000.0 / lastMillis : 0.0;
+}
+
+long long LnsPlanner::getAcceptedCount() const {
+    return accepted;
+}
+
+int LnsPlanner::getImprovementCount() const {
+    return improvements;
+}
+
+long long LnsPlanner::getRemovalCalls(Removal removal) const {
+    return removalCalls[static_cast<int>(removal)];
+}
+
+int LnsPlanner::getRemovalImprovements(Removal removal) const {
+    return removalImprovements[static_cast<int>(removal)];
+}
+
+int LnsPlanner::getTraceLength() const {
+    return traceLength;
+}
+
+double LnsPlanner::getTraceMillis(int index) const {
+    return traceMillis[index];
+}
+
+long long LnsPlanner::getTraceDistance(int index) const {
+    return traceDistance[index];
+}
+
+double LnsPlanner::getLastMillis() const {
+    return lastMillis;
+}
+
+}  // namespace project
@@ -0,0 +1,220 @@
+/**
+ * @file MultiStartPlanner.cpp
+ * @brief Implementation of MultiStartPlanner class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/MultiStartPlanner.h"
+
+#include <chrono>
+#include <climits>
+
+namespace project {
+
+namespace {
+
+// Start'ın tohumu: planlayıcı tohumu ve start'tan karıştırılır (murmur3 finalizer)
+unsigned int startSeed(unsigned int seed, int start) {
+    unsigned int x = seed * 0x9E3779B9u + static_cast<unsigned int>(start);
+    x ^= x >> 16;
+    x *= 0x85EBCA6Bu;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35u;
+    x ^= x >> 16;
+    return x;
+}
+
+// Rotadaki bin'leri işaretler, sayısını döndürür
+int markBins(const Route& route, bool* onRoute, int slots) {
+    for (int i = 0; i < slots; i++) {
+        onRoute[i] = false;
+    }
+    int count = 0;
+    for (int i = 0; i < route.getLength(); i++) {
+        if (!route.isDisposalAt(i)) {
+            onRoute[route.getBinAt(i)] = true;
+            count++;
+        }
+    }
+    return count;
+}
+
+// Simülasyonun süreceği gibi: sığmayan bin'den önce ve vardiya sonunda en yakın tesise
+long long drivenDistance(const RoutePlanner& planner, const PlanningState& state,
+                         const Route& route) {
+    long long total = 0;
+    int at = state.getDepotNode();
+    int load = state.getTruckLoad();
+    int capacity = state.getTruckCapacity();
+    auto drive = [&](int to) {
+        int d = planner.computeDistance(at, to);
+        if (d != INT_MAX)  // ulaşılamayan bacak sayılmaz (simülasyon da atlar)
+            total += d;
+        at = to;
+    };
+    auto unload = [&]() {
+        int site = planner.findNearestDisposal(at, state);
+        if (site != -1) {
+            drive(site);
+            load = 0;
+        }
+    };
+
+    for (int i = 0; i < route.getLength(); i++) {
+        if (route.isDisposalAt(i)) {
+            drive(route.getDisposalNodeAt(i));
+            load = 0;
+            continue;
+        }
+        int bin = route.getBinAt(i);
+        if (load > 0 && load + state.getFill(bin) > capacity)
+            unload();
+        drive(state.getNode(bin));
+        load += state.getFill(bin);
+    }
+    if (load > 0)
+        unload();
+    drive(state.getDepotNode());
+    return total;
+}
+
+}  // namespace
+
+MultiStartPlanner::MultiStartPlanner(RoutePlanner& planner, int starts, int threads)
+    : planner(planner),
+      pool(nullptr),
+      threadCount(threads),
+      starts(starts > 1 ? starts : 1),
+      seed(1),
+      candidateListSize(1),
+      noise(0.2),
+      startDistances(nullptr),
+      startCapacity(0),
+      bestStart(0),
+      lastMillis(0.0) {}
+
+MultiStartPlanner::~MultiStartPlanner() {
+    delete pool;
+    delete[] startDistances;
+}
+
+Route MultiStartPlanner::plan(Facilities& facilities) {
+    PlanningState state(facilities);
+    Route route = plan(state);
+    planner.applyRoute(route, facilities);
+    return route;
+}
+
+Route MultiStartPlanner::plan(const PlanningState& state) {
+    auto begin = std::chrono::steady_clock::now();
+    if (startCapacity < starts) {
+        delete[] startDistances;
+        startDistances = new long long[starts];
+        startCapacity = starts;
+    }
+
+    // Her start kendi rotasını yazar; paylaşılan görüntü yalnızca okunur
+    Route* routes = new Route[starts];
+    auto runStart = [&](int s) {
+        if (s == 0) {
+            routes[s] = planner.planRandomizedGreedy(state, 0, 1, 0.0);  // düz greedy
+        } else {
+            routes[s] = planner.planRandomizedGreedy(state, startSeed(seed, s),
+                                                     candidateListSize, noise);
+        }
+        startDistances[s] = drivenDistance(planner, state, routes[s]);
+    };
+
+    if (starts > 1 && getThreadCount() > 1) {
+        if (pool == nullptr)
+            pool = new ThreadPool(threadCount);
+        pool->parallelFor(0, starts, runStart);
+    } else {
+        for (int s = 0; s < starts; s++) {
+            runStart(s);
+        }
+    }
+
+    // Aday: greedy'nin topladığı her bin'i toplayan start; sonra çok bin, sonra kısa yol.
+    // Eşitlikte küçük start kazanır, sonuç iş parçacığı sayısından bağımsız
+    int slots = state.getBinCount() > 0 ? state.getBinCount() : 1;
+    bool* greedyBins = new bool[slots];
+    bool* onRoute = new bool[slots];
+    int bestBins = markBins(routes[0], greedyBins, state.getBinCount());
+    bestStart = 0;
+    for (int s = 1; s < starts; s++) {
+        int bins = markBins(routes[s], onRoute, state.getBinCount());
+        bool coversGreedy = true;
+        for (int i = 0; i < state.getBinCount() && coversGreedy; i++) {
+            coversGreedy = !greedyBins[i] || onRoute[i];
+        }
+        if (!coversGreedy)
+            continue;
+        if (bins > bestBins ||
+            (bins == bestBins && startDistances[s] < startDistances[bestStart])) {
+            bestStart = s;
+            bestBins = bins;
+        }
+    }
+    delete[] greedyBins;
+    delete[] onRoute;
+    Route best = routes[bestStart];
+    delete[] routes;
+
+    lastMillis =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin)
+            .count();
+    return best;
+}
+
+void MultiStartPlanner::setStarts(int count) {
+    starts = count > 1 ? count : 1;
+}
+
+int MultiStartPlanner::getStarts() const {
+    return starts;
+}
+
+void MultiStartPlanner::setThreads(int threads) {
+    threadCount = threads;
+    delete pool;
+    pool = nullptr;
+}
+
+int MultiStartPlanner::getThreadCount() const {
+    if (pool != nullptr)
+        return pool->getThreadCount();
+    return threadCount > 0 ? threadCount : ThreadPool::hardwareThreads();
+}
+
+void MultiStartPlanner::setSeed(unsigned int value) {
+    seed = value;
+}
+
+void MultiStartPlanner::setRandomization(int listSize, double relativeNoise) {
+    candidateListSize = listSize > 1 ? listSize : 1;
+    noise = relativeNoise > 0.0 ? relativeNoise : 0.0;
+}
+
+int MultiStartPlanner::getBestStart() const {
+    return bestStart;
+}
+
+long long MultiStartPlanner::getStartDistance(int start) const {
+    return startDistances[start];
+}
+
+long long MultiStartPlanner::getGreedyDistance() const {
+    return startCapacity > 0 ? startDistances[0] : 0;
+}
+
+long long MultiStartPlanner::getBestDistance() const {
+    return startCapacity > 0 ? startDistances[bestStart] : 0;
+}
+
+double MultiStartPlanner::getLastMillis() const {
+    return lastMillis;
+}
+
+}  // namespace project
@@ -0,0 +1,166 @@
+/**
+ * @file NearestDisposalField.cpp
+ * @brief Implementation of NearestDisposalField class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/NearestDisposalField.h"
+
+#include "data_structures/IndexedPriorityQueue.hpp"
+
+#include <climits>
+
+namespace project {
+
+NearestDisposalField::NearestDisposalField(const CsrGraph& network)
+    : forward(network), reverse(network.transposed()), nodeCount(network.getNodeCount()),
+      nearest(nullptr), distance(nullptr), sourceRank(nullptr), sourceCount(0), nextRank(0) {
+    nearest = new int[nodeCount];
+    distance = new int[nodeCount];
+    sourceRank = new int[nodeCount];
+    for (int i = 0; i < nodeCount; i++) {
+        nearest[i] = -1;
+        distance[i] = INT_MAX;
+        sourceRank[i] = -1;
+    }
+}
+
+NearestDisposalField::~NearestDisposalField() {
+    delete[] nearest;
+    delete[] distance;
+    delete[] sourceRank;
+}
+
+long long NearestDisposalField::keyOf(int dist, int site) const {
+    if (site == -1 || dist == INT_MAX) {
+        return LLONG_MAX;
+    }
+    return (static_cast<long long>(dist) << 24) + sourceRank[site];  // distance, then age
+}
+
+template <typename Queue>
+void NearestDisposalField::propagate(Queue& queue) {
+    while (!queue.isEmpty()) {
+        int u = queue.top();
+        queue.pop();
+
+        // Reverse edge u -> v is the road v -> u, so v can reach u's site through u
+        const Edge* end = reverse.edgesEnd(u);
+        for (const Edge* e = reverse.edgesBegin(u); e != end; ++e) {
+            int v = e->toNode;
+            long long candidate = keyOf(distance[u] + e->weight, nearest[u]);
+            if (candidate < keyOf(distance[v], nearest[v])) {
+                distance[v] = distance[u] + e->weight;
+                nearest[v] = nearest[u];
+                queue.pushOrDecrease(v, candidate);
+            }
+        }
+    }
+}
+
+void NearestDisposalField::build(const int* disposalNodes, int count) {
+    for (int i = 0; i < nodeCount; i++) {
+        nearest[i] = -1;
+        distance[i] = INT_MAX;
+        sourceRank[i] = -1;
+    }
+    sourceCount = 0;
+    nextRank = 0;
+
+    IndexedPriorityQueue<long long> queue(nodeCount);
+    for (int i = 0; i < count; i++) {
+        int node = disposalNodes[i];
+        if (node < 0 || node >= nodeCount || sourceRank[node] != -1) {
+            continue;  // geçersiz veya tekrar eden tesis
+        }
+        sourceRank[node] = nextRank++;
+        sourceCount++;
+        nearest[node] = node;
+        distance[node] = 0;
+        queue.push(node, keyOf(0, node));
+    }
+
+    propagate(queue);
+}
+
+void NearestDisposalField::addDisposal(int node) {
+    if (node < 0 || node >= nodeCount || sourceRank[node] != -1) {
+        return;
+    }
+
+    sourceRank[node] = nextRank++;
+    sourceCount++;
+
+    // The new site only wins where it is strictly closer (it is the youngest on ties)
+    if (keyOf(0, node) < keyOf(distance[node], nearest[node])) {
+        nearest[node] = node;
+        distance[node] = 0;
+        IndexedPriorityQueue<long long> queue(nodeCount);
+        queue.push(node, keyOf(0, node));
+        propagate(queue);
+    }
+}
+
+void NearestDisposalField::removeDisposal(int node) {
+    if (node < 0 || node >= nodeCount || sourceRank[node] == -1) {
+        return;
+    }
+
+    // Clear every label that pointed at the closed site
+    bool* affected = new bool[nodeCount];
+    for (int v = 0; v < nodeCount; v++) {
+        affected[v] = nearest[v] == node;
+        if (affected[v]) {
+            nearest[v] = -1;
+            distance[v] = INT_MAX;
+        }
+    }
+    sourceRank[node] = -1;
+    sourceCount--;
+
+    // Seed the affected region from open sites inside it (zero-length ties) and from
+    // its unaffected road neighbours
+    IndexedPriorityQueue<long long> queue(nodeCount);
+    for (int v = 0; v < nodeCount; v++) {
+        if (!affected[v]) {
+            continue;
+        }
+        if (sourceRank[v] != -1) {
+            nearest[v] = v;
+            distance[v] = 0;
+            queue.pushOrDecrease(v, keyOf(0, v));
+            continue;
+        }
+        const Edge* end = forward.edgesEnd(v);
+        for (const Edge* e = forward.edgesBegin(v); e != end; ++e) {
+            int u = e->toNode;
+            if (affected[u] || nearest[u] == -1) {
+                continue;
+            }
+            long long candidate = keyOf(distance[u] + e->weight, nearest[u]);
+            if (candidate < keyOf(distance[v], nearest[v])) {
+                distance[v] = distance[u] + e->weight;
+                nearest[v] = nearest[u];
+                queue.pushOrDecrease(v, candidate);
+            }
+        }
+    }
+
+    propagate(queue);
+    delete[] affected;
+}
+
+int NearestDisposalField::getDistance(int node) const {
+    return node >= 0 && node < nodeCount ? distance[node] : INT_MAX;
+}
+
+int NearestDisposalField::getDisposalCount() const {
+    return sourceCount;
+}
+
+long long NearestDisposalField::getMemoryUsage() const {
+    return static_cast<long long>(nodeCount) * 3 * sizeof(int) + reverse.getMemoryUsage();
+}
+
+}  // namespace project
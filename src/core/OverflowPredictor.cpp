@@ -7,17 +7,114 @@
 #include "core/OverflowPredictor.h"
 
 #include <climits>
+#include <cmath>
+
+#ifdef PROJECT_HAS_AVX2_KERNEL
+#include <immintrin.h>
+#endif
 
 namespace project {
 
+namespace {
+
+const double LONGEST_PREDICTION = INT_MAX - 1.0;  // int'e çevrilebilen en uzun tahmin
+const int BATCH_BLOCK = 256;                       // Bin'lerden sütunlara okunan blok
+
+void predictScalar(const int* capacities, const int* fills, const double* averageRates,
+                   const int* fillRates, int count, int threshold, int* days, double* risks,
+                   bool* critical) {
+    for (int i = 0; i < count; i++) {
+        bool overflowing = fills[i] >= capacities[i];
+        double rate = averageRates[i] > 0 ? averageRates[i] : fillRates[i];
+        int predicted = INT_MAX;
+        if (rate > 0) {
+            double quotient = (capacities[i] - fills[i]) / rate;
+            predicted = static_cast<int>(quotient < LONGEST_PREDICTION ? quotient
+                                                                       : LONGEST_PREDICTION);
+            if (predicted < 1)
+                predicted = 1;
+        }
+        if (overflowing)
+            predicted = -1;
+        days[i] = predicted;
+        risks[i] = overflowing ? 0.0 : predicted;
+        critical[i] = overflowing || predicted <= threshold;
+    }
+}
+
+#ifdef PROJECT_HAS_AVX2_KERNEL
+// Dört double maskeyi (64 bit) dört int maskesine (32 bit) indirger
+PROJECT_AVX2_TARGET __m128i narrowMask(__m256d mask) {
+    __m256i lowHalves = _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0);
+    return _mm256_castsi256_si128(
+        _mm256_permutevar8x32_epi32(_mm256_castpd_si256(mask), lowHalves));
+}
+
+PROJECT_AVX2_TARGET void predictAvx2(const int* capacities, const int* fills,
+                                     const double* averageRates, const int* fillRates,
+                                     int count, int threshold, int* days, double* risks,
+                                     bool* critical) {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d longest = _mm256_set1_pd(LONGEST_PREDICTION);
+    const __m128i unknown = _mm_set1_epi32(INT_MAX);
+    const __m128i full = _mm_set1_epi32(-1);
+    const __m128i limit = _mm_set1_epi32(threshold);
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i capacity = _mm_loadu_si128(reinterpret_cast<const __m128i*>(capacities + i));
+        __m128i fill = _mm_loadu_si128(reinterpret_cast<const __m128i*>(fills + i));
+        __m128i configured = _mm_loadu_si128(reinterpret_cast<const __m128i*>(fillRates + i));
+        __m256d average = _mm256_loadu_pd(averageRates + i);
+
+        // Ortalama pozitif değilse yapılandırılmış hız; o da değilse tahmin yok
+        __m256d rate = _mm256_blendv_pd(average, _mm256_cvtepi32_pd(configured),
+                                        _mm256_cmp_pd(average, zero, _CMP_LE_OQ));
+        __m128i known = narrowMask(_mm256_cmp_pd(rate, zero, _CMP_GT_OQ));
+
+        // max(trunc(q), 1) == trunc(max(q, 1)) for q >= 0; bölme hatası maskelenir
+        __m256d quotient = _mm256_div_pd(_mm256_cvtepi32_pd(_mm_sub_epi32(capacity, fill)),
+                                         rate);
+        quotient = _mm256_max_pd(_mm256_min_pd(quotient, longest), one);
+        __m128i predicted = _mm256_cvttpd_epi32(quotient);
+
+        __m128i notFull = _mm_cmpgt_epi32(capacity, fill);
+        predicted = _mm_blendv_epi8(unknown, predicted, known);
+        predicted = _mm_blendv_epi8(full, predicted, notFull);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(days + i), predicted);
+
+        // Taşan bin'in riski 0: gün sayısı 64 bit maskeyle sıfırlanır
+        __m256d risk = _mm256_and_pd(_mm256_cvtepi32_pd(predicted),
+                                     _mm256_castsi256_pd(_mm256_cvtepi32_epi64(notFull)));
+        _mm256_storeu_pd(risks + i, risk);
+
+        // Kritik değil <=> taşmıyor ve eşikten uzun
+        __m128i relaxed = _mm_and_si128(notFull, _mm_cmpgt_epi32(predicted, limit));
+        int relaxedBits = _mm_movemask_ps(_mm_castsi128_ps(relaxed));
+        for (int k = 0; k < 4; k++) {
+            critical[i + k] = ((relaxedBits >> k) & 1) == 0;
+        }
+    }
+    predictScalar(capacities + i, fills + i, averageRates + i, fillRates + i, count - i,
+                  threshold, days + i, risks + i, critical + i);
+}
+#endif
+
+}  // namespace
+
 // Constructor
-OverflowPredictor::OverflowPredictor(int threshold) : criticalThreshold(threshold) {
+OverflowPredictor::OverflowPredictor(int threshold)
+    : criticalThreshold(threshold),
+      kernel(SimdKernel::Auto),
+      forecaster(nullptr),
+      safetyMargin(0.0) {
     // Threshold represents the number of days under which
     // a bin is considered critical.
 }
 
 // Predict days until overflow
-int OverflowPredictor::predictDaysToOverflow(const Bin& bin) const {
+int OverflowPredictor::predictDaysToOverflow(const Bin& bin, int index) const {
     int capacity = bin.getCapacity();        // Bin’in maksimum kapasitesi
     int currentFill = bin.getCurrentFill();  // Şu anki doluluk miktarı
 
@@ -25,15 +122,13 @@ int OverflowPredictor::predictDaysToOverflow(const Bin& bin) const {
         return -1;
     }
 
-    // Bin’in geçmiş verilerden hesaplanan ortalama dolma hızı
-    double fillRate = bin.getAverageFillRate();
-
-    if (fillRate <= 0) {
-        // Fallback: use current fill as a rough estimation
-        // This avoids division by zero and missing data
-        fillRate = bin.getFillRate();
+    // Tahmin modeli varsa boş yerin dolacağı gün ondan gelir
+    if (forecaster != nullptr && index >= 0 && index < forecaster->getBinCount()) {
+        return forecaster->predictDaysToOverflow(index, capacity - currentFill);
     }
 
+    double fillRate = effectiveRate(bin);
+
     // Precondition safety check
     if (fillRate <= 0) {
         // Cannot predict overflow without a valid fill rate
@@ -50,9 +145,29 @@ int OverflowPredictor::predictDaysToOverflow(const Bin& bin) const {
     return days;
 }
 
+double OverflowPredictor::effectiveRate(const Bin& bin) const {
+    // Bin’in geçmiş verilerden hesaplanan ortalama dolma hızı (toplam tutulur, O(1))
+    double fillRate = bin.getAverageFillRate();
+
+    if (fillRate <= 0) {
+        // Fallback: use current fill as a rough estimation
+        // This avoids division by zero and missing data
+        fillRate = bin.getFillRate();
+    }
+
+    // Güvenlik payı: günlük değişimin ortalaması ve sapması da O(1) okunur
+    if (safetyMargin > 0 && fillRate > 0) {
+        double change = bin.getAverageDailyChange();
+        if (change > fillRate)
+            fillRate = change;
+        fillRate += safetyMargin * std::sqrt(bin.getDailyChangeVariance());
+    }
+    return fillRate;
+}
+
 // Check if bin is critical
-bool OverflowPredictor::isCritical(const Bin& bin) const {
-    int days = predictDaysToOverflow(bin);
+bool OverflowPredictor::isCritical(const Bin& bin, int index) const {
+    int days = predictDaysToOverflow(bin, index);
 
     // If already overflowing, treat as critical
     if (days == -1) {
@@ -67,8 +182,8 @@ bool OverflowPredictor::isCritical(const Bin& bin) const {
 }
 
 // Get overflow risk score
-double OverflowPredictor::getOverflowRisk(const Bin& bin) const {
-    int days = predictDaysToOverflow(bin);
+double OverflowPredictor::getOverflowRisk(const Bin& bin, int index) const {
+    int days = predictDaysToOverflow(bin, index);
 
     // Overflowing bins get highest priority (lowest score)
     if (days == -1) {
@@ -86,9 +201,94 @@ double OverflowPredictor::getOverflowRisk(const Bin& bin) const {
  * This would exaggerate urgency differences for small values.
  */
 
+void OverflowPredictor::predictBatch(const int* capacities, const int* fills,
+                                     const double* averageRates, const int* fillRates,
+                                     int count, int* days, double* risks,
+                                     bool* critical) const {
+#ifdef PROJECT_HAS_AVX2_KERNEL
+    if (getKernel() == SimdKernel::Avx2) {
+        predictAvx2(capacities, fills, averageRates, fillRates, count, criticalThreshold, days,
+                    risks, critical);
+        return;
+    }
+#endif
+    predictScalar(capacities, fills, averageRates, fillRates, count, criticalThreshold, days,
+                  risks, critical);
+}
+
+void OverflowPredictor::predictBatch(const Bin* bins, int count, int* days, double* risks,
+                                     bool* critical) const {
+    if (forecaster != nullptr) {  // tahminler bin bin; sütun çekirdeği yalnızca geçmiş için
+        for (int i = 0; i < count; i++) {
+            int predicted = predictDaysToOverflow(bins[i], i);
+            if (days != nullptr)
+                days[i] = predicted;
+            if (risks != nullptr)
+                risks[i] = predicted == -1 ? 0.0 : static_cast<double>(predicted);
+            if (critical != nullptr)
+                critical[i] = predicted == -1 || predicted <= criticalThreshold;
+        }
+        return;
+    }
+
+    // Bloklar yığında kalır: sütunlar L1'de, çekirdek doğrudan okur
+    int capacities[BATCH_BLOCK];
+    int fills[BATCH_BLOCK];
+    int fillRates[BATCH_BLOCK];
+    double averageRates[BATCH_BLOCK];
+    int scratchDays[BATCH_BLOCK];
+    double scratchRisks[BATCH_BLOCK];
+    bool scratchCritical[BATCH_BLOCK];
+
+    for (int start = 0; start < count; start += BATCH_BLOCK) {
+        int size = count - start < BATCH_BLOCK ? count - start : BATCH_BLOCK;
+        for (int k = 0; k < size; k++) {
+            const Bin& bin = bins[start + k];
+            capacities[k] = bin.getCapacity();
+            fills[k] = bin.getCurrentFill();
+            fillRates[k] = bin.getFillRate();
+            averageRates[k] = bin.getAverageFillRate();
+            if (safetyMargin > 0)  // pay eklenmiş hız; çekirdek onu pozitifse kullanır
+                averageRates[k] = effectiveRate(bin);
+        }
+        predictBatch(capacities, fills, averageRates, fillRates, size,
+                     days != nullptr ? days + start : scratchDays,
+                     risks != nullptr ? risks + start : scratchRisks,
+                     critical != nullptr ? critical + start : scratchCritical);
+    }
+}
+
+void OverflowPredictor::setKernel(SimdKernel selected) {
+    kernel = selected;
+}
+
+SimdKernel OverflowPredictor::getKernel() const {
+    return resolveKernel(kernel);
+}
+
+void OverflowPredictor::setForecaster(const ForecastModel* model) {
+    forecaster = model;
+}
+
+const ForecastModel* OverflowPredictor::getForecaster() const {
+    return forecaster;
+}
+
+void OverflowPredictor::setSafetyMargin(double margin) {
+    safetyMargin = margin > 0 ? margin : 0.0;
+}
+
+double OverflowPredictor::getSafetyMargin() const {
+    return safetyMargin;
+}
+
 // Update critical threshold
 void OverflowPredictor::setCriticalThreshold(int threshold) {
     criticalThreshold = threshold;
 }
 
+int OverflowPredictor::getCriticalThreshold() const {
+    return criticalThreshold;
+}
+
 }  // namespace project
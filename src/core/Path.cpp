@@ -0,0 +1,103 @@
+/**
+ * @file Path.cpp
+ * @brief Implementation of Path class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/Path.h"
+
+namespace project {
+
+Path::Path() : nodes(nullptr), length(0), capacity(0), distance(0) {}
+
+Path::~Path() {
+    delete[] nodes;
+}
+
+Path::Path(const Path& other) : nodes(nullptr), length(0), capacity(0), distance(0) {
+    *this = other;
+}
+
+Path& Path::operator=(const Path& other) {
+    if (this == &other) {
+        return *this;
+    }
+
+    length = 0;
+    reserve(other.length);
+    for (int i = 0; i < other.length; i++) {
+        nodes[i] = other.nodes[i];
+    }
+    length = other.length;
+    distance = other.distance;
+    return *this;
+}
+
+// Kapasiteyi ikiye katlayarak büyüt; mevcut node'lar korunur
+void Path::reserve(int needed) {
+    if (needed <= capacity) {
+        return;
+    }
+
+    int newCapacity = capacity > 0 ? capacity * 2 : 8;
+    while (newCapacity < needed) {
+        newCapacity *= 2;
+    }
+
+    int* grown = new int[newCapacity];
+    for (int i = 0; i < length; i++) {
+        grown[i] = nodes[i];
+    }
+    delete[] nodes;
+    nodes = grown;
+    capacity = newCapacity;
+}
+
+void Path::addNode(int node) {
+    reserve(length + 1);
+    nodes[length++] = node;
+}
+
+void Path::appendLeg(const Path& leg) {
+    int start = 0;
+    if (length > 0 && leg.length > 0 && leg.nodes[0] == nodes[length - 1]) {
+        start = 1;  // ortak node'u iki kez yazma
+    }
+
+    reserve(length + leg.length - start);
+    for (int i = start; i < leg.length; i++) {
+        nodes[length++] = leg.nodes[i];
+    }
+    distance += leg.distance;
+}
+
+int Path::getNodeAt(int position) const {
+    if (position < 0 || position >= length) {
+        return -1;
+    }
+    return nodes[position];
+}
+
+int Path::getLength() const {
+    return length;
+}
+
+void Path::setDistance(int value) {
+    distance = value;
+}
+
+int Path::getDistance() const {
+    return distance;
+}
+
+bool Path::isEmpty() const {
+    return length == 0;
+}
+
+void Path::clear() {
+    length = 0;
+    distance = 0;
+}
+
+}  // namespace project
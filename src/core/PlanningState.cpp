@@ -0,0 +1,218 @@
+/**
+ * @file PlanningState.cpp
+ * @brief Implementation of PlanningState class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/PlanningState.h"
+
+#include "core/OverflowPredictor.h"
+
+namespace project {
+
+PlanningState::PlanningState()
+    : binCount(0),
+      binSlots(0),
+      binIndex(nullptr),
+      fills(nullptr),
+      capacities(nullptr),
+      nodes(nullptr),
+      risks(nullptr),
+      disposalCount(0),
+      disposalSlots(0),
+      disposalNodes(nullptr),
+      depotNode(-1),
+      truckNode(-1),
+      truckLoad(0),
+      truckCapacity(0),
+      forecaster(nullptr) {}
+
+PlanningState::PlanningState(const Facilities& facilities, int truck) : PlanningState() {
+    capture(facilities, truck);
+}
+
+PlanningState::~PlanningState() {
+    delete[] binIndex;
+    delete[] fills;
+    delete[] capacities;
+    delete[] nodes;
+    delete[] risks;
+    delete[] disposalNodes;
+}
+
+PlanningState::PlanningState(const PlanningState& other) : PlanningState() {
+    *this = other;
+}
+
+PlanningState& PlanningState::operator=(const PlanningState& other) {
+    if (this == &other) {
+        return *this;
+    }
+    reserveBins(other.binCount);
+    binCount = other.binCount;
+    for (int i = 0; i < binCount; i++) {
+        binIndex[i] = other.binIndex[i];
+        fills[i] = other.fills[i];
+        capacities[i] = other.capacities[i];
+        nodes[i] = other.nodes[i];
+        risks[i] = other.risks[i];
+    }
+
+    if (other.disposalCount > disposalSlots) {
+        delete[] disposalNodes;
+        disposalNodes = new int[other.disposalCount];
+        disposalSlots = other.disposalCount;
+    }
+    disposalCount = other.disposalCount;
+    for (int k = 0; k < disposalCount; k++) {
+        disposalNodes[k] = other.disposalNodes[k];
+    }
+
+    depotNode = other.depotNode;
+    truckNode = other.truckNode;
+    truckLoad = other.truckLoad;
+    truckCapacity = other.truckCapacity;
+    forecaster = other.forecaster;
+    return *this;
+}
+
+void PlanningState::reserveBins(int count) {
+    if (count <= binSlots) {
+        return;
+    }
+    int slots = binSlots > 0 ? binSlots : 16;
+    while (slots < count) {
+        slots *= 2;
+    }
+    delete[] binIndex;
+    delete[] fills;
+    delete[] capacities;
+    delete[] nodes;
+    delete[] risks;
+    binIndex = new int[slots];
+    fills = new int[slots];
+    capacities = new int[slots];
+    nodes = new int[slots];
+    risks = new double[slots];
+    binSlots = slots;
+}
+
+void PlanningState::captureBin(int slot, int index, const Facilities& facilities,
+                               const OverflowPredictor& predictor) {
+    const Bin& bin = facilities.getBin(index);
+    binIndex[slot] = index;
+    fills[slot] = bin.getCurrentFill();
+    capacities[slot] = bin.getCapacity();
+    nodes[slot] = bin.getNodeId();
+    risks[slot] = predictor.getOverflowRisk(bin, index);
+}
+
+void PlanningState::captureSites(const Facilities& facilities, int truck) {
+    int count = 0;
+    for (int i = 0; i < facilities.getFacilityCount(); i++) {
+        if (facilities.getFacility(i).isDisposal())
+            count++;
+    }
+    if (count > disposalSlots) {
+        delete[] disposalNodes;
+        disposalNodes = new int[count];
+        disposalSlots = count;
+    }
+    disposalCount = 0;
+    for (int i = 0; i < facilities.getFacilityCount(); i++) {
+        if (facilities.getFacility(i).isDisposal())
+            disposalNodes[disposalCount++] = facilities.getFacility(i).getNodeId();
+    }
+
+    depotNode = facilities.getDepotNode();
+    const Truck& source = facilities.getTruck(truck);
+    truckNode = source.getCurrentNode();
+    truckLoad = source.getCurrentLoad();
+    truckCapacity = source.getCapacity();
+}
+
+void PlanningState::capture(const Facilities& facilities, int truck) {
+    OverflowPredictor predictor;  // risk skoru eşikten bağımsız
+    predictor.setForecaster(forecaster);
+    reserveBins(facilities.getBinCount());
+    binCount = facilities.getBinCount();
+    const Bin* bins = facilities.getBins();
+    for (int i = 0; i < binCount; i++) {
+        binIndex[i] = i;
+        fills[i] = bins[i].getCurrentFill();
+        capacities[i] = bins[i].getCapacity();
+        nodes[i] = bins[i].getNodeId();
+    }
+    predictor.predictBatch(bins, binCount, nullptr, risks, nullptr);  // tüm riskler tek geçişte
+    captureSites(facilities, truck);
+}
+
+void PlanningState::capture(const Facilities& facilities, int truck, const int* bins, int count) {
+    OverflowPredictor predictor;
+    predictor.setForecaster(forecaster);
+    reserveBins(count);
+    binCount = count;
+    for (int k = 0; k < count; k++) {
+        captureBin(k, bins[k], facilities, predictor);
+    }
+    captureSites(facilities, truck);
+}
+
+int PlanningState::getBinCount() const {
+    return binCount;
+}
+
+int PlanningState::getBinIndex(int slot) const {
+    return binIndex[slot];
+}
+
+int PlanningState::getFill(int slot) const {
+    return fills[slot];
+}
+
+int PlanningState::getCapacity(int slot) const {
+    return capacities[slot];
+}
+
+int PlanningState::getNode(int slot) const {
+    return nodes[slot];
+}
+
+double PlanningState::getRisk(int slot) const {
+    return risks[slot];
+}
+
+const int* PlanningState::getNodes() const {
+    return nodes;
+}
+
+int PlanningState::getDepotNode() const {
+    return depotNode;
+}
+
+int PlanningState::getDisposalCount() const {
+    return disposalCount;
+}
+
+const int* PlanningState::getDisposalNodes() const {
+    return disposalCount > 0 ? disposalNodes : nullptr;
+}
+
+int PlanningState::getTruckNode() const {
+    return truckNode;
+}
+
+int PlanningState::getTruckLoad() const {
+    return truckLoad;
+}
+
+int PlanningState::getTruckCapacity() const {
+    return truckCapacity;
+}
+
+void PlanningState::setForecaster(const ForecastModel* model) {
+    forecaster = model;
+}
+
+}  // namespace project
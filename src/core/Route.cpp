@@ -12,6 +12,7 @@ namespace project {
 Route::Route() {
     binIndices = nullptr;
     length = 0;
+    capacity = 0;
     totalDistance = 0;
     needsDisposal = false;
 }
@@ -21,6 +22,7 @@ Route::Route(int* bins, int count) {
     if (bins == nullptr || count <= 0) {
         binIndices = nullptr;
         length = 0;
+        capacity = 0;
         totalDistance = 0;
         needsDisposal = false;
         return;
@@ -32,6 +34,7 @@ Route::Route(int* bins, int count) {
     // Binin dışardakı pointerını bişeler yapmamak için kopyalıcaz içte
 
     length = count;
+    capacity = count;
     binIndices = new int[length];
     for (int i = 0; i < length; i = i + 1) {
         binIndices[i] = bins[i];
@@ -48,6 +51,7 @@ Route::~Route() {
 
 Route::Route(const Route& other) {
     length = other.length;
+    capacity = other.length;
     totalDistance = other.totalDistance;
     needsDisposal = other.needsDisposal;
 
@@ -76,6 +80,7 @@ Route& Route::operator=(const Route& other) {
 
     // kopyalama
     length = other.length;
+    capacity = other.length;
     totalDistance = other.totalDistance;
     needsDisposal = other.needsDisposal;
 
@@ -95,21 +100,49 @@ Route& Route::operator=(const Route& other) {
 }
 
 void Route::addBin(int binIndex) {
-    // vektör yok diye arrayden geçircez
-    int newLength = length + 1;
+    // vektör yok diye arrayden geçircez; kapasite ikiye katlanır, ekleme amortize O(1)
+    if (length == capacity) {
+        int newCapacity = capacity == 0 ? 8 : capacity * 2;
+        int* newArray = new int[newCapacity];
 
-    int* newArray = new int[newLength];
+        for (int i = 0; i < length; i = i + 1) {
+            newArray[i] = binIndices[i];
+        }
 
-    for (int i = 0; i < length; i = i + 1) {
-        newArray[i] = binIndices[i];
+        delete[] binIndices;
+
+        binIndices = newArray;
+        capacity = newCapacity;
     }
 
-    newArray[length] = binIndex;
+    binIndices[length] = binIndex;
+    length = length + 1;
+}
 
-    delete[] binIndices;
+// Boşaltma durağı negatif saklanır: -(node + 1), böylece node 0 da temsil edilir
+void Route::addDisposalStop(int node) {
+    addBin(-(node + 1));
+    needsDisposal = true;
+}
 
-    binIndices = newArray;
-    length = newLength;
+// Ekleme: önce sona yer aç (kapasite katlanır), sonra arkadakileri bir kaydır
+void Route::insertBin(int position, int binIndex) {
+    if (position < 0 || position > length) {
+        return;
+    }
+    addBin(binIndex);
+    for (int i = length - 1; i > position; i--) {
+        binIndices[i] = binIndices[i - 1];
+    }
+    binIndices[position] = binIndex;
+}
+
+void Route::insertDisposalStop(int position, int node) {
+    if (position < 0 || position > length) {
+        return;
+    }
+    insertBin(position, -(node + 1));
+    needsDisposal = true;
 }
 
 int Route::getBinAt(int position) const {
@@ -122,9 +155,27 @@ int Route::getBinAt(int position) const {
         return -1;
     }
 
+    if (binIndices[position] < 0) {
+        return -1;  // boşaltma durağı
+    }
+
     return binIndices[position];
 }
 
+bool Route::isDisposalAt(int position) const {
+    if (binIndices == nullptr || position < 0 || position >= length) {
+        return false;
+    }
+    return binIndices[position] < 0;
+}
+
+int Route::getDisposalNodeAt(int position) const {
+    if (!isDisposalAt(position)) {
+        return -1;
+    }
+    return -binIndices[position] - 1;
+}
+
 // fonklar
 int Route::getLength() const {
     return length;
@@ -154,6 +205,7 @@ void Route::clear() {
     delete[] binIndices;
     binIndices = nullptr;
     length = 0;
+    capacity = 0;
     totalDistance = 0;
     needsDisposal = false;
 }
@@ -0,0 +1,513 @@
+/**
+ * @file RouteImprover.cpp
+ * @brief Implementation of RouteImprover class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/RouteImprover.h"
+
+#include <chrono>
+#include <climits>
+
+namespace project {
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+const int MAX_POINTS = 5000;  // local table is points^2 ints; larger routes are left as they are
+
+/**
+ * Working state of one improve() call. Points index the local distance table:
+ * 0 = truck start, 1 = depot (end), then the route's bins, then the disposal sites.
+ * The tour `seq` starts with 0, ends with 1, and a disposal site inside it closes a trip.
+ */
+class LocalSearch {
+public:
+    LocalSearch(const int* table, int pointCount, const int* load, const bool* isSite,
+                const int* sites, int siteCount, int capacity, int initialLoad, int maxStops)
+        : table(table),
+          pointCount(pointCount),
+          load(load),
+          isSite(isSite),
+          sites(sites),
+          siteCount(siteCount),
+          capacity(capacity),
+          initialLoad(initialLoad),
+          length(0),
+          neighborCount(0),
+          neighbors(nullptr),
+          cursor(0),
+          expired(false),
+          twoOpt(0),
+          orOpt(0),
+          relocate(0),
+          disposal(0) {
+        seq = new int[maxStops];
+        scratch = new int[maxStops];
+        trip = new int[maxStops];
+        tripLoad = new long long[maxStops];
+        forward = new long long[maxStops];
+        backward = new long long[maxStops];
+        position = new int[pointCount];
+    }
+
+    ~LocalSearch() {
+        delete[] seq;
+        delete[] scratch;
+        delete[] trip;
+        delete[] tripLoad;
+        delete[] forward;
+        delete[] backward;
+        delete[] position;
+        delete[] neighbors;
+    }
+
+    LocalSearch(const LocalSearch&) = delete;
+    LocalSearch& operator=(const LocalSearch&) = delete;
+
+    long long arc(int a, int b) const {
+        return table[static_cast<long long>(a) * pointCount + b];
+    }
+
+    void append(int point) { seq[length++] = point; }
+
+    // Cheapest disposal site between two points
+    int bestSite(int from, int to) const {
+        int best = sites[0];
+        for (int k = 1; k < siteCount; k++) {
+            if (arc(from, sites[k]) + arc(sites[k], to) < arc(from, best) + arc(best, to))
+                best = sites[k];
+        }
+        return best;
+    }
+
+    // Splits the bin order into trips: unload before a bin that would not fit, and where
+    // the order has a break (-1) left by the planner's own disposal stops
+    void split(const int* bins, int binCount) {
+        length = 0;
+        append(0);
+        long long carried = initialLoad;
+        for (int k = 0; k < binCount; k++) {
+            if (bins[k] == -1) {
+                int next = 1;
+                for (int t = k + 1; t < binCount && next == 1; t++) {
+                    if (bins[t] != -1)
+                        next = bins[t];
+                }
+                if (siteCount > 0 && carried > 0) {
+                    append(bestSite(seq[length - 1], next));
+                    carried = 0;
+                }
+                continue;
+            }
+            int bin = bins[k];
+            if (siteCount > 0 && carried > 0 && carried + load[bin] > capacity) {
+                append(bestSite(seq[length - 1], bin));
+                carried = 0;
+            }
+            append(bin);
+            carried += load[bin];
+        }
+        append(1);
+        refresh();
+    }
+
+    // Prefix costs, trips and positions after every applied move (O(length))
+    void refresh() {
+        forward[0] = 0;
+        backward[0] = 0;
+        for (int k = 1; k < length; k++) {
+            forward[k] = forward[k - 1] + arc(seq[k - 1], seq[k]);
+            backward[k] = backward[k - 1] + arc(seq[k], seq[k - 1]);  // ters yön maliyeti
+        }
+
+        for (int p = 0; p < pointCount; p++) {
+            position[p] = -1;
+        }
+        int t = 0;
+        tripLoad[0] = initialLoad;
+        for (int k = 0; k < length; k++) {
+            trip[k] = t;
+            if (isSite[seq[k]]) {
+                tripLoad[++t] = 0;  // boşaltma durağı bir seferi kapatır
+            } else {
+                tripLoad[t] += load[seq[k]];
+                position[seq[k]] = k;
+            }
+        }
+    }
+
+    // Distance actually driven: unreachable legs (INT_MAX) are skipped, as in the simulation
+    long long drivenDistance() const {
+        long long total = 0;
+        for (int k = 1; k < length; k++) {
+            if (arc(seq[k - 1], seq[k]) != INT_MAX)
+                total += arc(seq[k - 1], seq[k]);
+        }
+        return total;
+    }
+
+    // K nearest bins from every point (outgoing distance), used as move candidates
+    void buildNeighbors(int binBegin, int binEnd, int count) {
+        neighborCount = count < binEnd - binBegin ? count : binEnd - binBegin;
+        if (neighborCount <= 0)
+            return;
+        neighbors = new int[static_cast<long long>(pointCount) * neighborCount];
+
+        long long* best = new long long[neighborCount];
+        for (int p = 0; p < pointCount; p++) {
+            int* list = neighbors + static_cast<long long>(p) * neighborCount;
+            int filled = 0;
+            for (int b = binBegin; b < binEnd; b++) {
+                if (b == p)
+                    continue;
+                long long d = arc(p, b);
+                if (filled == neighborCount && d >= best[filled - 1])
+                    continue;
+                int k = filled < neighborCount ? filled++ : filled - 1;
+                while (k > 0 && best[k - 1] > d) {  // sıralı ekleme
+                    best[k] = best[k - 1];
+                    list[k] = list[k - 1];
+                    k--;
+                }
+                best[k] = d;
+                list[k] = b;
+            }
+            for (int k = filled; k < neighborCount; k++) {
+                list[k] = -1;  // fewer bins than K
+            }
+        }
+        delete[] best;
+    }
+
+    bool timeUp() {
+        if (!expired && Clock::now() >= deadline)
+            expired = true;
+        return expired;
+    }
+
+    // Merge trips that fit together and move each stop to its cheapest site
+    bool improveDisposals() {
+        for (int k = 1; k < length - 1; k++) {
+            if (!isSite[seq[k]])
+                continue;
+            int prev = seq[k - 1], stop = seq[k], next = seq[k + 1];
+
+            if (tripLoad[trip[k]] + tripLoad[trip[k] + 1] <= capacity) {
+                for (int t = k; t < length - 1; t++) {
+                    seq[t] = seq[t + 1];
+                }
+                length--;
+                disposal++;
+                refresh();
+                return true;
+            }
+
+            int site = bestSite(prev, next);
+            if (arc(prev, site) + arc(site, next) < arc(prev, stop) + arc(stop, next)) {
+                seq[k] = site;
+                disposal++;
+                refresh();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // 2-opt inside one trip: a -> [s_i .. s_j] -> b becomes a -> [s_j .. s_i] -> b
+    bool twoOptPass() {
+        for (int step = 0; step < length - 2; step++) {
+            int i = 1 + (cursor + step) % (length - 2);  // son iyileşmenin yerinden devam
+            if (isSite[seq[i]] || timeUp())
+                continue;
+            int before = seq[i - 1];
+            const int* list = neighbors + static_cast<long long>(before) * neighborCount;
+            for (int n = 0; n < neighborCount && list[n] >= 0; n++) {
+                int j = position[list[n]];
+                if (j <= i || trip[j] != trip[i])
+                    continue;
+                int after = seq[j + 1];
+                long long delta = arc(before, seq[j]) + (backward[j] - backward[i]) +
+                                  arc(seq[i], after) - arc(before, seq[i]) -
+                                  (forward[j] - forward[i]) - arc(seq[j], after);
+                if (delta < 0) {
+                    for (int lo = i, hi = j; lo < hi; lo++, hi--) {
+                        int swap = seq[lo];
+                        seq[lo] = seq[hi];
+                        seq[hi] = swap;
+                    }
+                    twoOpt++;
+                    cursor = i - 1;
+                    refresh();
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Moves seq[first..last] into the gap after position `gap`, optionally reversed
+    void moveSegment(int first, int last, int gap, bool reversed) {
+        int k = 0;
+        for (int t = 0; t < length; t++) {
+            if (t >= first && t <= last)
+                continue;
+            scratch[k++] = seq[t];
+            if (t == gap) {
+                for (int s = 0; s <= last - first; s++) {
+                    scratch[k++] = reversed ? seq[last - s] : seq[first + s];
+                }
+            }
+        }
+        for (int t = 0; t < length; t++) {
+            seq[t] = scratch[t];
+        }
+    }
+
+    // Or-opt (2-3 bins) and relocate (1 bin): cut a segment out and insert it near a neighbour
+    bool segmentPass() {
+        for (int step = 0; step < length - 2; step++) {
+            int i = 1 + (cursor + step) % (length - 2);
+            if (isSite[seq[i]] || timeUp())
+                continue;
+            long long segmentLoad = 0;
+            for (int size = 1; size <= 3; size++) {
+                int e = i + size - 1;
+                if (e > length - 2 || isSite[seq[e]] || trip[e] != trip[i])
+                    break;
+                segmentLoad += load[seq[e]];
+
+                int first = seq[i], last = seq[e];
+                long long removeGain =
+                    arc(seq[i - 1], first) + arc(last, seq[e + 1]) - arc(seq[i - 1], seq[e + 1]);
+                long long turn = (backward[e] - backward[i]) - (forward[e] - forward[i]);
+
+                for (int end = 0; end < (size == 1 ? 1 : 2); end++) {
+                    const int* list =
+                        neighbors + static_cast<long long>(end == 0 ? first : last) * neighborCount;
+                    for (int n = 0; n < neighborCount && list[n] >= 0; n++) {
+                        int at = position[list[n]];
+                        for (int gap = at - 1; gap <= at; gap++) {
+                            if (gap < 0 || gap > length - 2 || (gap >= i - 1 && gap <= e))
+                                continue;
+                            int target = trip[gap] + (isSite[seq[gap]] ? 1 : 0);
+                            if (target != trip[i] && tripLoad[target] + segmentLoad > capacity)
+                                continue;  // kapasite aşılır
+
+                            int p = seq[gap], r = seq[gap + 1];
+                            long long base = -arc(p, r) - removeGain;
+                            long long straight = arc(p, first) + arc(last, r) + base;
+                            long long flipped =
+                                size > 1 ? arc(p, last) + arc(first, r) + turn + base : 0;
+                            if (straight < 0 || flipped < 0) {
+                                moveSegment(i, e, gap, flipped < straight);
+                                if (size == 1)
+                                    relocate++;
+                                else
+                                    orOpt++;
+                                cursor = i - 1;
+                                refresh();
+                                return true;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    void run(double budgetMs) {
+        deadline = Clock::now() +
+                   std::chrono::microseconds(static_cast<long long>(budgetMs * 1000.0));
+        while (!timeUp()) {
+            if (improveDisposals() || twoOptPass() || segmentPass())
+                continue;
+            break;  // yerel optimum
+        }
+    }
+
+    const int* table;
+    int pointCount;
+    const int* load;
+    const bool* isSite;
+    const int* sites;
+    int siteCount;
+    int capacity;
+    int initialLoad;
+
+    int* seq;
+    int* scratch;
+    int length;
+    int* trip;             // trip index of each position (a disposal stop ends its trip)
+    long long* tripLoad;   // load of each trip (trip 0 includes the truck's initial load)
+    long long* forward;    // forward[k]: cost of seq[0..k]
+    long long* backward;   // backward[k]: cost of seq[0..k] driven in reverse
+    int* position;         // point -> position in seq, -1 for sites and absent points
+    int neighborCount;
+    int* neighbors;        // point -> its nearest bins
+    int cursor;            // passes resume scanning here instead of at the start
+    Clock::time_point deadline;
+    bool expired;
+
+    int twoOpt, orOpt, relocate, disposal;
+};
+
+}  // namespace
+
+RouteImprover::RouteImprover(const RoutePlanner& planner, double timeBudgetMs, int neighborCount)
+    : planner(planner),
+      timeBudgetMs(timeBudgetMs),
+      neighborCount(neighborCount > 0 ? neighborCount : 1),
+      initialDistance(0),
+      finalDistance(0),
+      twoOptMoves(0),
+      orOptMoves(0),
+      relocateMoves(0),
+      disposalMoves(0),
+      lastMillis(0.0) {}
+
+Route RouteImprover::improve(const Route& route, Facilities& facilities) {
+    PlanningState state(facilities);
+    return improve(route, state);
+}
+
+Route RouteImprover::improve(const Route& route, const PlanningState& state) {
+    auto start = Clock::now();
+    initialDistance = finalDistance = 0;
+    twoOptMoves = orOptMoves = relocateMoves = disposalMoves = 0;
+    lastMillis = 0.0;
+
+    int binCount = 0, breakCount = 0;
+    for (int i = 0; i < route.getLength(); i++) {
+        if (route.isDisposalAt(i))
+            breakCount++;
+        else
+            binCount++;
+    }
+    int siteCount = state.getDisposalCount();
+    const int* siteNodes = state.getDisposalNodes();
+    int pointCount = 2 + binCount + siteCount;
+    if (binCount == 0 || pointCount > MAX_POINTS) {
+        return route;
+    }
+
+    // Noktalar: 0 = başlangıç, 1 = depo, sonra bin'ler, sonra boşaltma tesisleri
+    int* nodes = new int[pointCount];
+    int* load = new int[pointCount];
+    bool* isSite = new bool[pointCount];
+    int* binOfPoint = new int[pointCount];
+    int* order = new int[binCount + breakCount];
+    int* sites = new int[siteCount > 0 ? siteCount : 1];
+
+    nodes[0] = state.getTruckNode();
+    nodes[1] = state.getDepotNode();
+    int point = 2;
+    for (int i = 0; i < route.getLength(); i++) {
+        if (route.isDisposalAt(i)) {
+            order[i] = -1;  // planlanan boşaltma: sefer sınırı olarak korunur
+            continue;
+        }
+        int bin = route.getBinAt(i);
+        nodes[point] = state.getNode(bin);
+        binOfPoint[point] = bin;
+        order[i] = point;
+        point++;
+    }
+    for (int k = 0; k < siteCount; k++) {
+        nodes[point] = siteNodes[k];
+        sites[k] = point++;
+    }
+    for (int p = 0; p < pointCount; p++) {
+        bool bin = p >= 2 && p < 2 + binCount;
+        load[p] = bin ? state.getFill(binOfPoint[p]) : 0;
+        isSite[p] = p >= 2 + binCount;
+    }
+
+    // Yerel mesafe tablosu: matris bağlıysa her satır O(points)
+    int* table = new int[static_cast<long long>(pointCount) * pointCount];
+    for (int p = 0; p < pointCount; p++) {
+        planner.computeDistances(nodes[p], nodes, pointCount,
+                                 table + static_cast<long long>(p) * pointCount);
+    }
+
+    LocalSearch search(table, pointCount, load, isSite, sites, siteCount,
+                       state.getTruckCapacity(), state.getTruckLoad(), 2 * binCount + 3);
+    search.split(order, binCount + breakCount);
+    initialDistance = search.drivenDistance();
+    if (timeBudgetMs > 0) {
+        search.buildNeighbors(2, 2 + binCount, neighborCount);
+        search.run(timeBudgetMs - std::chrono::duration<double, std::milli>(Clock::now() - start)
+                                      .count());
+    }
+    finalDistance = search.drivenDistance();
+    twoOptMoves = search.twoOpt;
+    orOptMoves = search.orOpt;
+    relocateMoves = search.relocate;
+    disposalMoves = search.disposal;
+
+    Route improved;
+    for (int k = 1; k < search.length - 1; k++) {
+        int p = search.seq[k];
+        if (isSite[p])
+            improved.addDisposalStop(nodes[p]);
+        else
+            improved.addBin(binOfPoint[p]);
+    }
+    improved.setTotalDistance(finalDistance < INT_MAX ? static_cast<int>(finalDistance) : INT_MAX);
+
+    delete[] table;
+    delete[] nodes;
+    delete[] load;
+    delete[] isSite;
+    delete[] binOfPoint;
+    delete[] order;
+    delete[] sites;
+
+    lastMillis = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    return improved;
+}
+
+void RouteImprover::setTimeBudget(double ms) {
+    timeBudgetMs = ms;
+}
+
+double RouteImprover::getTimeBudget() const {
+    return timeBudgetMs;
+}
+
+void RouteImprover::setNeighborCount(int count) {
+    neighborCount = count > 0 ? count : 1;
+}
+
+long long RouteImprover::getInitialDistance() const {
+    return initialDistance;
+}
+
+long long RouteImprover::getFinalDistance() const {
+    return finalDistance;
+}
+
+int RouteImprover::getTwoOptMoves() const {
+    return twoOptMoves;
+}
+
+int RouteImprover::getOrOptMoves() const {
+    return orOptMoves;
+}
+
+int RouteImprover::getRelocateMoves() const {
+    return relocateMoves;
+}
+
+int RouteImprover::getDisposalMoves() const {
+    return disposalMoves;
+}
+
+double RouteImprover::getLastMillis() const {
+    return lastMillis;
+}
+
+}  // namespace project
@@ -6,80 +6,426 @@
  */
 #include "core/RoutePlanner.h"
 
+#include "core/SavingsPlanner.h"
+#include "core/SplitPlanner.h"
+#include "utils/Random.h"
+
 // Programda overflow kontrolü yapmak için başlangıç değerlerini çok küçük ya da çok büyük vermek
 // için include ettik
 #include <climits>  //INT_MAX
 
 namespace project {
 
+namespace {
+
+// Her thread kendi sorgu alanını tutar; hiyerarşi değişince yeniden ayrılır
+struct HierarchyWorkspace {
+    const ContractionHierarchy* index = nullptr;
+    int nodeCount = 0;
+    HierarchyQuery* query = nullptr;
+    ~HierarchyWorkspace() { delete query; }
+};
+
+HierarchyQuery& hierarchyQuery(const ContractionHierarchy& index) {
+    thread_local HierarchyWorkspace workspace;
+    if (workspace.index != &index || workspace.nodeCount != index.getNodeCount()) {
+        delete workspace.query;
+        workspace.query = new HierarchyQuery(index);
+        workspace.index = &index;
+        workspace.nodeCount = index.getNodeCount();
+    }
+    return *workspace.query;
+}
+
+}  // namespace
+
 // Constructor
-RoutePlanner::RoutePlanner(const Graph& graph) : graph(graph), predictor(2) {}
+RoutePlanner::RoutePlanner(const Graph& graph)
+    : graph(graph),
+      network(graph),
+      reverseNetwork(),
+      matrix(nullptr),
+      disposalField(nullptr),
+      landmarks(nullptr),
+      hierarchy(nullptr),
+      searchMode(SearchMode::Dijkstra),
+      planningEngine(PlanningEngine::Greedy),
+      candidatesScored(0),
+      candidatesPruned(0),
+      predictor(2) {
+    if (graph.hasReverseIndex())
+        reverseNetwork.buildReverse(graph);  // ters kenarlar zaten graph'ta tutuluyor
+}
+
+void RoutePlanner::setDistanceMatrix(const DistanceMatrix* distances) {
+    matrix = distances;
+}
+
+void RoutePlanner::setDisposalField(const NearestDisposalField* field) {
+    disposalField = field;
+}
 
-// Priority calculation
-double RoutePlanner::calculatePriority(const Bin& bin, int distance) const {
-    // Lower value = higher priority
-    // Overflow risk dominates, distance is secondary
-    double risk = predictor.getOverflowRisk(bin);
-    return risk * 1000 + distance;  // we choose coefficent as 1000 due to 1000 > max_distance
+void RoutePlanner::setLandmarkOracle(const LandmarkOracle* oracle) {
+    landmarks = oracle;
+}
+
+void RoutePlanner::setHierarchy(const ContractionHierarchy* index) {
+    hierarchy = index;
+}
+
+void RoutePlanner::setForecaster(const ForecastModel* model) {
+    predictor.setForecaster(model);
+}
+
+long long RoutePlanner::getCandidatesScored() const {
+    return candidatesScored;
+}
+
+long long RoutePlanner::getCandidatesPruned() const {
+    return candidatesPruned;
+}
+
+void RoutePlanner::setSearchMode(SearchMode mode) {
+    searchMode = mode;
+    if (mode == SearchMode::Bidirectional && reverseNetwork.getNodeCount() == 0 &&
+        network.getNodeCount() > 0)
+        reverseNetwork = network.transposed();  // geriye doğru arama için ters graph
+}
+
+RoutePlanner::SearchMode RoutePlanner::getSearchMode() const {
+    return searchMode;
+}
+
+void RoutePlanner::setPlanningEngine(PlanningEngine engine) {
+    planningEngine = engine;
+    if (engine == PlanningEngine::Savings && reverseNetwork.getNodeCount() == 0 &&
+        network.getNodeCount() > 0)
+        reverseNetwork = network.transposed();  // depoya dönüş aramaları için
+}
+
+RoutePlanner::PlanningEngine RoutePlanner::getPlanningEngine() const {
+    return planningEngine;
+}
+
+const CsrGraph& RoutePlanner::getNetwork() const {
+    return network;
+}
+
+const CsrGraph& RoutePlanner::getReverseNetwork() const {
+    return reverseNetwork;
+}
+
+const DistanceMatrix* RoutePlanner::getDistanceMatrix() const {
+    return matrix;
 }
 
 // Dijkstra shortest path
 int RoutePlanner::computeDistance(int from, int to) const {
-    int nodeCount = graph.getNodeCount();  // Graph içindeki toplam node sayısını alır
+    if (matrix != nullptr && matrix->contains(from) && matrix->contains(to))
+        return matrix->lookup(from, to);  // O(1) tablo cevabı
+
+    if ((searchMode == SearchMode::AStar && network.hasPositions()) ||
+        searchMode == SearchMode::Bidirectional ||
+        (searchMode == SearchMode::Landmarks && landmarks != nullptr) ||
+        (searchMode == SearchMode::Hierarchy && hierarchy != nullptr))
+        return searchDistance(from, to, searchMode);
+
+    int result = INT_MAX;
+    computeDistances(from, &to, 1, &result);  // tek hedefli one-to-many
+    return result;
+}
+
+// Point-to-point search; A* adds the straight-line bound to the queue key
+int RoutePlanner::searchDistance(int from, int to, SearchMode mode, int* settledCount) const {
+    int nodeCount = network.getNodeCount();
+    if (settledCount != nullptr)
+        *settledCount = 0;
 
+    if (from < 0 || from >= nodeCount || to < 0 || to >= nodeCount)
+        return INT_MAX;  // geçersiz node
+
+    if (mode == SearchMode::Bidirectional && reverseNetwork.getNodeCount() == nodeCount)
+        return bidirectionalDistance(from, to, settledCount);
+
+    if (mode == SearchMode::Landmarks && landmarks != nullptr)
+        return landmarks->distance(from, to, settledCount);  // ALT A*
+
+    if (mode == SearchMode::Hierarchy && hierarchy != nullptr && hierarchy->isBuilt() &&
+        hierarchy->getNodeCount() == nodeCount) {
+        HierarchyQuery& query = hierarchyQuery(*hierarchy);
+        int result = query.distance(from, to);
+        if (settledCount != nullptr)
+            *settledCount = query.getSettledCount();
+        return result;
+    }
+
+    bool guided = mode == SearchMode::AStar && network.hasPositions();
+    return singleSearch(from, to, guided, nullptr, settledCount);
+}
+
+// Dijkstra / A* tek yönlü arama; istenirse her node'un önceki node'unu kaydeder
+int RoutePlanner::singleSearch(int from, int to, bool guided, int* predecessors,
+                               int* settledCount) const {
+    int nodeCount = network.getNodeCount();
     int* distance = new int[nodeCount];
     bool* visited = new bool[nodeCount];
+    for (int i = 0; i < nodeCount; i++) {
+        distance[i] = INT_MAX;
+        visited[i] = false;
+    }
+    if (predecessors != nullptr) {
+        for (int i = 0; i < nodeCount; i++) {
+            predecessors[i] = -1;
+        }
+    }
+
+    // key = g + h; h tutarlı (consistent) olduğu için settle edilen node tekrar açılmaz
+    IndexedPriorityQueue<long long> open(nodeCount);
+    distance[from] = 0;
+    open.push(from, guided ? network.straightLineBound(from, to) : 0);
+
+    int settled = 0;
+    while (!open.isEmpty()) {
+        int current = open.top();
+        open.pop();
+        visited[current] = true;
+        settled++;
+
+        if (current == to)
+            break;  // hedef settle edildi, mesafe kesin
+
+        const Edge* end = network.edgesEnd(current);
+        for (const Edge* e = network.edgesBegin(current); e != end; ++e) {
+            int next = e->toNode;
+            if (!visited[next] && distance[current] + e->weight < distance[next]) {
+                distance[next] = distance[current] + e->weight;
+                if (predecessors != nullptr)
+                    predecessors[next] = current;
+                long long key = distance[next];
+                if (guided)
+                    key += network.straightLineBound(next, to);
+                open.pushOrDecrease(next, key);
+            }
+        }
+    }
+
+    int result = distance[to];
+    if (settledCount != nullptr)
+        *settledCount = settled;
+
+    delete[] distance;
+    delete[] visited;
+    return result;
+}
+
+// Shortest path with geometry: predecessor zincirini hedeften geriye yürü
+int RoutePlanner::computePath(int from, int to, Path& path) const {
+    path.clear();
+    int nodeCount = network.getNodeCount();
+    if (from < 0 || from >= nodeCount || to < 0 || to >= nodeCount)
+        return INT_MAX;  // geçersiz node
+
+    int* predecessors = new int[nodeCount];
+    bool guided = searchMode == SearchMode::AStar && network.hasPositions();
+    int result = singleSearch(from, to, guided, predecessors, nullptr);
+
+    if (result != INT_MAX) {
+        // Zincir hedeften kaynağa ters sırada; önce diziye al, sonra baştan yaz
+        int* reversed = new int[nodeCount];
+        int hops = 0;
+        for (int v = to; v != from; v = predecessors[v]) {
+            reversed[hops++] = v;
+        }
+        path.addNode(from);
+        for (int i = hops - 1; i >= 0; i--) {
+            path.addNode(reversed[i]);
+        }
+        delete[] reversed;
+    }
+
+    delete[] predecessors;
+    path.setDistance(result);
+    return result;
+}
+
+// Bidirectional Dijkstra: ileri arama `from`dan, geri arama `to`dan ters kenarlarla.
+// İki kuyruğun en küçük anahtarlarının toplamı bulunan en iyi yoldan küçük olmadığı an durur.
+int RoutePlanner::bidirectionalDistance(int from, int to, int* settledCount) const {
+    int nodeCount = network.getNodeCount();
+    if (from == to)
+        return 0;
+
+    int* distance[2] = {new int[nodeCount], new int[nodeCount]};
+    bool* visited[2] = {new bool[nodeCount], new bool[nodeCount]};
+    for (int i = 0; i < nodeCount; i++) {
+        distance[0][i] = distance[1][i] = INT_MAX;
+        visited[0][i] = visited[1][i] = false;
+    }
+
+    IndexedPriorityQueue<int> forwardQueue(nodeCount);
+    IndexedPriorityQueue<int> backwardQueue(nodeCount);
+    IndexedPriorityQueue<int>* queue[2] = {&forwardQueue, &backwardQueue};
+    const CsrGraph* side[2] = {&network, &reverseNetwork};
+
+    distance[0][from] = 0;
+    distance[1][to] = 0;
+    forwardQueue.push(from, 0);
+    backwardQueue.push(to, 0);
+
+    long long best = INT_MAX;  // en iyi buluşma (meeting) mesafesi
+    int settled = 0;
+    while (!forwardQueue.isEmpty() && !backwardQueue.isEmpty()) {
+        if (static_cast<long long>(forwardQueue.topPriority()) + backwardQueue.topPriority() >=
+            best)
+            break;  // daha kısa bir yol artık bulunamaz
+
+        int s = forwardQueue.size() <= backwardQueue.size() ? 0 : 1;  // küçük tarafı genişlet
+        int current = queue[s]->top();
+        queue[s]->pop();
+        visited[s][current] = true;
+        settled++;
+
+        const Edge* end = side[s]->edgesEnd(current);
+        for (const Edge* e = side[s]->edgesBegin(current); e != end; ++e) {
+            int next = e->toNode;
+            if (visited[s][next])
+                continue;
+            int candidate = distance[s][current] + e->weight;
+            if (candidate < distance[s][next]) {
+                distance[s][next] = candidate;
+                queue[s]->pushOrDecrease(next, candidate);
+            }
+            if (distance[1 - s][next] != INT_MAX) {
+                long long meeting = static_cast<long long>(candidate) + distance[1 - s][next];
+                if (meeting < best)
+                    best = meeting;
+            }
+        }
+    }
+
+    if (settledCount != nullptr)
+        *settledCount = settled;
+
+    for (int k = 0; k < 2; k++) {
+        delete[] distance[k];
+        delete[] visited[k];
+    }
+    return best < INT_MAX ? static_cast<int>(best) : INT_MAX;
+}
+
+// One-to-many Dijkstra: tek arama ile tüm hedeflere mesafe
+void RoutePlanner::computeDistances(int from, const int* targets, int targetCount,
+                                    int* distances) const {
+    int nodeCount = network.getNodeCount();  // Graph içindeki toplam node sayısını alır
+
+    for (int i = 0; i < targetCount; i++) {
+        distances[i] = INT_MAX;  // ulaşılamayan hedefler INT_MAX kalır
+    }
+
+    if (from < 0 || from >= nodeCount || targetCount <= 0)
+        return;  // geçersiz node
+
+    if (matrix != nullptr && matrix->contains(from)) {
+        bool allKnown = true;  // tüm hedefler tabloda mı?
+        for (int i = 0; i < targetCount && allKnown; i++) {
+            allKnown = matrix->contains(targets[i]);
+        }
+        if (allKnown) {
+            for (int i = 0; i < targetCount; i++) {
+                distances[i] = matrix->lookup(from, targets[i]);
+            }
+            return;
+        }
+    }
+
+    if (searchMode == SearchMode::Hierarchy && hierarchy != nullptr && hierarchy->isBuilt() &&
+        hierarchy->getNodeCount() == nodeCount) {
+        hierarchyQuery(*hierarchy).distances(from, targets, targetCount, distances);
+        return;
+    }
+
+    int* distance = new int[nodeCount];
+    bool* visited = new bool[nodeCount];
+    bool* isTarget = new bool[nodeCount];
 
     for (int i = 0; i < nodeCount; i++) {
         distance[i] = INT_MAX;  // tüm node'ların mesafesini sonsuz kabul ettik (INT_MAX)
         visited[i] = false;     // Hiçbir node ziyaret edilmemiş kabul edilir
+        isTarget[i] = false;
     }
 
-    PriorityQueue<int> shortestDistanceQueue;
+    int remaining = 0;  // henüz settle edilmemiş farklı hedef node sayısı
+    for (int i = 0; i < targetCount; i++) {
+        int t = targets[i];
+        if (t >= 0 && t < nodeCount && !isTarget[t]) {
+            isTarget[t] = true;
+            remaining++;
+        }
+    }
+
+    IndexedPriorityQueue<int> shortestDistanceQueue(nodeCount);  // her node en fazla bir kez
     distance[from] = 0;
     shortestDistanceQueue.push(from, 0);
 
-    while (!shortestDistanceQueue.isEmpty()) {
+    while (remaining > 0 && !shortestDistanceQueue.isEmpty()) {
         int current = shortestDistanceQueue.top();  // en yakın node'u bulur
         shortestDistanceQueue.pop();
-
-        if (visited[current])
-            continue;             // visited ise geç
         visited[current] = true;  // visited olarak işaretle
 
-        if (current == to)
-            break;  // break if the target node is reached
+        if (isTarget[current]) {
+            remaining--;
+            if (remaining == 0)
+                break;  // break once every target node is settled
+        }
 
-        const LinkedList<Edge>& edges =
-            graph.getAdjList(current);  // current node’unun tüm komşu kenarları
-        for (auto it = edges.begin(); it != edges.end();
-             ++it) {  // current node’dan çıkan her kenar tek tek incelenir
-            Edge e = *it;
-            int next = e.toNode;    // gidilecek komşu node
-            int weight = e.weight;  // next ile arasındaki mesafe
+        const Edge* end = network.edgesEnd(current);  // current node’unun tüm komşu kenarları
+        for (const Edge* e = network.edgesBegin(current); e != end;
+             ++e) {  // current node’dan çıkan her kenar tek tek incelenir
+            int next = e->toNode;    // gidilecek komşu node
+            int weight = e->weight;  // next ile arasındaki mesafe
 
             if (!visited[next] &&
                 distance[current] + weight < distance[next]) {  // Daha kısa yol var mı kontrol eder
                 distance[next] = distance[current] + weight;  // Yeni ve daha kısa mesafe kaydedilir
-                shortestDistanceQueue.push(next, distance[next]);
+                shortestDistanceQueue.pushOrDecrease(next, distance[next]);  // duplicate yok
             }
         }
     }
 
-    int result = distance[to];  // Hedef node’a olan en kısa mesafe
+    for (int i = 0; i < targetCount; i++) {
+        int t = targets[i];
+        if (t >= 0 && t < nodeCount) {
+            distances[i] = distance[t];  // Hedef node’a olan en kısa mesafe
+        }
+    }
 
     // Memory cleanup
     delete[] distance;
     delete[] visited;
-
-    return result;
+    delete[] isTarget;
 }
 
 // Find nearest disposal facility
 int RoutePlanner::findNearestDisposal(int currentNode, const Facilities& facilities) const {
+    if (disposalField != nullptr)
+        return disposalField->getNearest(currentNode);  // O(1) önceden hesaplanmış etiket
+
     int count = 0;
     int* disposalNodes =
         facilities.getDisposalNodes(count);  // facilities içinden disposal node ID’lerini alır
+    int nearest = nearestDisposal(currentNode, disposalNodes, count);
+
+    delete[] disposalNodes;  // Memory cleanup
+    return nearest;
+}
+
+int RoutePlanner::findNearestDisposal(int currentNode, const PlanningState& state) const {
+    return nearestDisposal(currentNode, state.getDisposalNodes(), state.getDisposalCount());
+}
+
+int RoutePlanner::nearestDisposal(int currentNode, const int* sites, int count) const {
+    if (disposalField != nullptr)
+        return disposalField->getNearest(currentNode);
 
     if (count == 0)
         return -1;  // Disposal tesisi yoksa -1 ile fonksiyondan çıkılır
@@ -88,91 +434,130 @@ int RoutePlanner::findNearestDisposal(int currentNode, const Facilities& facilit
     int nearest = -1;
 
     for (int i = 0; i < count; i++) {  // Her disposal node kontrol edilir
-        int dijkstra = computeDistance(currentNode, disposalNodes[i]);  // en kısa mesafeyi hesaplar
+        int dijkstra = computeDistance(currentNode, sites[i]);  // en kısa mesafeyi hesaplar
         if (dijkstra < minDistance) {
             minDistance = dijkstra;
-            nearest = disposalNodes[i];  //  disposal node ID’si saklanır
+            nearest = sites[i];  //  disposal node ID’si saklanır
         }
     }
-
-    delete[] disposalNodes;  // Memory cleanup
     return nearest;
 }
 
 // Check for critical bins
 bool RoutePlanner::hasCriticalBins(const Facilities& facilities) const {
     for (int i = 0; i < facilities.getBinCount(); i++) {
-        if (predictor.isCritical(facilities.getBin(i))) {
+        if (predictor.isCritical(facilities.getBin(i), i)) {
             return true;
         }
     }
     return false;
 }
 
-// Select next bin (greedy)
-int RoutePlanner::selectNextBin(Facilities& facilities) {
-    Truck& truck = facilities.getTruck();  // Facilities içindeki truck’a referans alır (no copy)
-    int currentNode = truck.getCurrentNode();  // Truck’ın graph üzerindeki mevcut konumu
+bool RoutePlanner::isCriticalBin(const Bin& bin, int index) const {
+    return predictor.isCritical(bin, index);
+}
 
-    double bestScore = INT_MAX;
-    int bestIndex = -1;
+const OverflowPredictor& RoutePlanner::getPredictor() const {
+    return predictor;
+}
 
-    for (int i = 0; i < facilities.getBinCount(); i++) {
-        Bin& bin = facilities.getBin(i);
+void PlannerDistances::operator()(int from, const int* targets, int count,
+                                  int* distances) const {
+    planner.computeDistances(from, targets, count, distances);
+}
 
-        if (bin.getCurrentFill() == 0)
-            continue;  // eğer bin boşsa atla
+bool RoutePlanner::matrixCovers(const PlanningState& state) const {
+    if (matrix == nullptr || !matrix->contains(state.getDepotNode()))
+        return false;
+    for (int i = 0; i < state.getBinCount(); i++) {
+        if (!matrix->contains(state.getNode(i)))
+            return false;
+    }
+    const int* sites = state.getDisposalNodes();
+    for (int s = 0; s < state.getDisposalCount(); s++) {
+        if (!matrix->contains(sites[s]))
+            return false;
+    }
+    return true;
+}
 
-        int distance = computeDistance(currentNode, bin.getNodeId());
-        double score = calculatePriority(bin, distance);  // bin'in öncelik skoru hesaplanır
+// Select next bin (greedy)
+int RoutePlanner::selectNextBin(Facilities& facilities) {
+    PlanningState state(facilities);  // Truck’ın mevcut konumu ve bin'lerin anlık durumu
+    return selectNextBin(state, nullptr, state.getTruckNode(), RiskFirstScoring(),
+                         PlannerDistances(*this));
+}
 
-        if (score < bestScore) {  // daha öncelikli var mı kontrol edilir
-            bestScore = score;
-            bestIndex = i;
-        }
+// Plan full route
+Route RoutePlanner::planRoute(const PlanningState& state) {
+    if (planningEngine == PlanningEngine::Savings) {
+        SavingsPlanner savings(*this);
+        return savings.plan(state);
+    }
+    if (planningEngine == PlanningEngine::GiantTour) {
+        SplitPlanner split(*this);
+        return split.plan(state);
     }
+    return planRoute(state, RiskFirstScoring());
+}
 
-    return bestIndex;
+Route RoutePlanner::planRandomizedGreedy(const PlanningState& state, unsigned int seed,
+                                         int candidateListSize, double noise) {
+    Random rng(seed);
+    int endNode = 0;
+    int endLoad = 0;
+    return planGreedy(state, RiskFirstScoring(), endNode, endLoad, &rng, candidateListSize,
+                      noise);
 }
 
-// Plan full route
 Route RoutePlanner::planRoute(Facilities& facilities) {
-    Route route;  // Initialize an empty route
+    if (planningEngine == PlanningEngine::Savings) {
+        SavingsPlanner savings(*this);
+        return savings.plan(facilities);
+    }
+    if (planningEngine == PlanningEngine::GiantTour) {
+        SplitPlanner split(*this);
+        return split.plan(facilities);
+    }
+
+    // Greedy: rota sonunda boşaltmaya gidildiyse truck orada kalır (rotada görünmez)
+    PlanningState state(facilities);
+    int endNode = 0;
+    int endLoad = 0;
+    Route route = planGreedy(state, RiskFirstScoring(), endNode, endLoad);
+    for (int i = 0; i < route.getLength(); i++) {
+        Bin& bin = facilities.getBin(route.getBinAt(i));
+        bin.collect(bin.getCurrentFill());
+    }
+    Truck& truck = facilities.getTruck();
+    truck.setCurrentLoad(endLoad);
+    truck.moveTo(endNode);
+    return route;
+}
+
+// Rotayı ilk truck ile gerçekleştir: planlayıcıların eskiden planlarken yaptığı yan etkiler
+void RoutePlanner::applyRoute(const Route& route, Facilities& facilities) const {
     Truck& truck = facilities.getTruck();
+    truck.moveTo(facilities.getDepotNode());
 
-    int currentNode =
-        facilities.getDepotNode();  // Truck’ın başlangıç noktası olan depot node’u alınır
-    truck.moveTo(currentNode);      // Truck’ın konumu depot olarak ayarlanır
-
-    while (true) {
-        int nextBinIndex = selectNextBin(facilities);
-        if (nextBinIndex == -1)
-            break;
-
-        Bin& bin = facilities.getBin(nextBinIndex);
-
-        // Check capacity
-        if (bin.getCurrentFill() > truck.getRemainingCapacity()) {
-            int disposalNode =  // Mevcut konuma göre en yakın boşaltma tesisi node’u
-                findNearestDisposal(truck.getCurrentNode(), facilities);
-            if (disposalNode != -1) {          // valid dispol bulunduysa
-                route.setNeedsDisposal(true);  // Bu rotada boşaltma yapılacağını belirtir
-                currentNode = disposalNode;
-                truck.moveTo(currentNode);
+    for (int i = 0; i < route.getLength(); i++) {
+        if (route.isDisposalAt(i)) {
+            truck.moveTo(route.getDisposalNodeAt(i));
+            truck.unload();
+            continue;
+        }
+        Bin& bin = facilities.getBin(route.getBinAt(i));
+        if (truck.getCurrentLoad() > 0 && bin.getCurrentFill() > truck.getRemainingCapacity()) {
+            int disposalNode = findNearestDisposal(truck.getCurrentNode(), facilities);
+            if (disposalNode != -1) {
+                truck.moveTo(disposalNode);
                 truck.unload();
             }
-            continue;
         }
-
-        // Visit bin
-        route.addBin(nextBinIndex);           // Bin rota listesine eklenir
-        truck.collect(bin.getCurrentFill());  // Bin’deki mevcut atık truck’a yüklenir
-        currentNode = bin.getNodeId();
-        truck.moveTo(currentNode);          // Truck bin’in bulunduğu node’a gider
-        bin.collect(bin.getCurrentFill());  // Bin’in içi boşaltılır (fill = 0)
+        truck.collect(bin.getCurrentFill());
+        truck.moveTo(bin.getNodeId());
+        bin.collect(bin.getCurrentFill());
     }
-
-    return route;
 }
 
 }  // namespace project
@@ -0,0 +1,434 @@
+/**
+ * @file SavingsPlanner.cpp
+ * @brief Implementation of SavingsPlanner class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/SavingsPlanner.h"
+
+#include "core/RoutePlanner.h"
+#include "data_structures/IndexedPriorityQueue.hpp"
+#include "data_structures/PriorityQueue.hpp"
+#include "utils/ThreadPool.h"
+
+#include <chrono>
+#include <climits>
+
+namespace project {
+
+namespace {
+
+/**
+ * Scratch space of one neighbour-search worker. Distances are reset sparsely through
+ * the `touched` list, so a bounded search costs only the nodes it reached.
+ */
+class NeighborSearch {
+public:
+    NeighborSearch(const CsrGraph& network, const int* firstBinAt, const int* nextBinAt)
+        : network(network),
+          firstBinAt(firstBinAt),
+          nextBinAt(nextBinAt),
+          queue(network.getNodeCount()),
+          touchedCount(0) {
+        int nodeCount = network.getNodeCount();
+        dist = new int[nodeCount];
+        touched = new int[nodeCount];
+        for (int v = 0; v < nodeCount; v++) {
+            dist[v] = INT_MAX;
+        }
+    }
+
+    ~NeighborSearch() {
+        delete[] dist;
+        delete[] touched;
+    }
+
+    NeighborSearch(const NeighborSearch&) = delete;
+    NeighborSearch& operator=(const NeighborSearch&) = delete;
+
+    // Dijkstra from `source` that stops once `limit` bins other than `self` are settled
+    int nearest(int source, int self, int limit, int* bins, int* distances) {
+        int found = 0;
+        reach(source, 0);
+        queue.push(source, 0);
+
+        while (!queue.isEmpty() && found < limit) {
+            int u = queue.top();
+            queue.pop();
+            for (int b = firstBinAt[u]; b != -1 && found < limit; b = nextBinAt[b]) {
+                if (b == self)
+                    continue;
+                bins[found] = b;
+                distances[found++] = dist[u];
+            }
+
+            const Edge* end = network.edgesEnd(u);
+            for (const Edge* e = network.edgesBegin(u); e != end; ++e) {
+                int candidate = dist[u] + e->weight;
+                if (candidate < dist[e->toNode]) {
+                    reach(e->toNode, candidate);
+                    queue.pushOrDecrease(e->toNode, candidate);
+                }
+            }
+        }
+
+        queue.clear();
+        for (int k = 0; k < touchedCount; k++) {
+            dist[touched[k]] = INT_MAX;
+        }
+        touchedCount = 0;
+        return found;
+    }
+
+private:
+    void reach(int node, int distance) {
+        if (dist[node] == INT_MAX)
+            touched[touchedCount++] = node;
+        dist[node] = distance;
+    }
+
+    const CsrGraph& network;
+    const int* firstBinAt;  // node -> first candidate bin there, -1 if none
+    const int* nextBinAt;   // candidate bin -> next candidate bin on the same node
+    IndexedPriorityQueue<int> queue;
+    int* dist;
+    int* touched;
+    int touchedCount;
+};
+
+// K nearest bins of `self` read from its matrix row; ties keep the lower bin index first
+int nearestInRow(const DistanceMatrix& matrix, const int* nodes, int n, int self, int limit,
+                 int* bins, int* distances) {
+    int found = 0;
+    for (int j = 0; j < n; j++) {
+        if (j == self)
+            continue;
+        int d = matrix.lookup(nodes[self], nodes[j]);
+        if (d == INT_MAX || (found == limit && d >= distances[found - 1]))
+            continue;
+        int pos = found < limit ? found++ : found - 1;  // dolu ise en uzağın yerine
+        while (pos > 0 && distances[pos - 1] > d) {
+            bins[pos] = bins[pos - 1];
+            distances[pos] = distances[pos - 1];
+            pos--;
+        }
+        bins[pos] = j;
+        distances[pos] = d;
+    }
+    return found;
+}
+
+}  // namespace
+
+SavingsPlanner::SavingsPlanner(const RoutePlanner& planner, int neighborCount, int threads)
+    : planner(planner),
+      neighborCount(neighborCount > 0 ? neighborCount : 1),
+      threadCount(threads),
+      savingsCount(0),
+      mergeCount(0),
+      tripCount(0),
+      lastMillis(0.0) {}
+
+Route SavingsPlanner::plan(Facilities& facilities) {
+    PlanningState state(facilities);
+    Route route = plan(state);
+    planner.applyRoute(route, facilities);
+    return route;
+}
+
+Route SavingsPlanner::plan(const PlanningState& state) {
+    auto start = std::chrono::steady_clock::now();
+    savingsCount = mergeCount = tripCount = 0;
+
+    Route route;
+    int depot = state.getDepotNode();  // greedy planner ile aynı başlangıç
+    int load = state.getTruckLoad();
+    int capacity = state.getTruckCapacity();
+
+    const CsrGraph& network = planner.getNetwork();
+    int nodeCount = network.getNodeCount();
+    int binCount = state.getBinCount();
+
+    // Adaylar: depodan ulaşılabilen boş olmayan bin'ler (greedy de ulaşılamayanı seçmez)
+    int* bins = new int[binCount > 0 ? binCount : 1];
+    int* nodes = new int[binCount > 0 ? binCount : 1];
+    int* fromDepot = new int[binCount > 0 ? binCount : 1];
+    int n = 0;
+    for (int i = 0; i < binCount; i++) {
+        if (state.getFill(i) == 0)
+            continue;
+        bins[n] = i;
+        nodes[n] = state.getNode(i);
+        n++;
+    }
+    planner.computeDistances(depot, nodes, n, fromDepot);
+    int reachable = 0;
+    for (int b = 0; b < n; b++) {
+        if (fromDepot[b] == INT_MAX)
+            continue;
+        bins[reachable] = bins[b];
+        nodes[reachable] = nodes[b];
+        fromDepot[reachable] = fromDepot[b];
+        reachable++;
+    }
+    n = reachable;
+
+    if (n == 0) {
+        delete[] bins;
+        delete[] nodes;
+        delete[] fromDepot;
+        tripCount = 1;
+        lastMillis = std::chrono::duration<double, std::milli>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+        return route;
+    }
+
+    // Tablo tüm noktaları içeriyorsa mesafeler satırlardan okunur, graph araması yapılmaz
+    const DistanceMatrix* matrix =
+        planner.matrixCovers(state) ? planner.getDistanceMatrix() : nullptr;
+
+    int* fill = new int[n];
+    for (int b = 0; b < n; b++) {
+        fill[b] = state.getFill(bins[b]);
+    }
+
+    // node -> bin'ler listesi: aramalar yerleşen node'daki bin'leri O(1) bulur
+    int* firstBinAt = new int[nodeCount > 0 ? nodeCount : 1];
+    int* nextBinAt = new int[n];
+    for (int v = 0; v < nodeCount; v++) {
+        firstBinAt[v] = -1;
+    }
+    for (int b = n - 1; b >= 0; b--) {
+        nextBinAt[b] = -1;
+        if (nodes[b] >= 0 && nodes[b] < nodeCount) {
+            nextBinAt[b] = firstBinAt[nodes[b]];
+            firstBinAt[nodes[b]] = b;
+        }
+    }
+
+    // Depoya dönüş mesafeleri: tablodan ya da ters grafta tek Dijkstra
+    int* toDepot = new int[n];
+    for (int b = 0; b < n; b++) {
+        toDepot[b] = matrix != nullptr ? matrix->lookup(nodes[b], depot) : INT_MAX;
+    }
+    if (matrix == nullptr && depot >= 0 && depot < nodeCount) {
+        // Planner'ın ters grafı yoksa (Savings motoru seçilmeden çağrıldıysa) bir kez çevir
+        const CsrGraph& planned = planner.getReverseNetwork();
+        CsrGraph transposed;
+        if (planned.getNodeCount() != nodeCount)
+            transposed = network.transposed();
+        NeighborSearch back(planned.getNodeCount() == nodeCount ? planned : transposed,
+                            firstBinAt, nextBinAt);
+        int* found = new int[n];
+        int* foundDist = new int[n];
+        int count = back.nearest(depot, -1, n, found, foundDist);
+        for (int t = 0; t < count; t++) {
+            toDepot[found[t]] = foundDist[t];
+        }
+        delete[] found;
+        delete[] foundDist;
+    }
+
+    // K en yakın komşu: tablo satırı ya da her bin için sınırlı Dijkstra, iş parçacıkları
+    // arasında bölünmüş
+    int k = neighborCount < n - 1 ? neighborCount : n - 1;
+    long long slots = static_cast<long long>(n) * (k > 0 ? k : 1);
+    int* neighborBin = new int[slots];
+    int* neighborDist = new int[slots];
+    int* neighborFound = new int[n];
+    for (int b = 0; b < n; b++) {
+        neighborFound[b] = 0;
+    }
+
+    int chunks = 1;
+    auto searchChunk = [&](int c) {
+        int from = static_cast<int>(static_cast<long long>(n) * c / chunks);
+        int to = static_cast<int>(static_cast<long long>(n) * (c + 1) / chunks);
+        if (matrix != nullptr) {
+            for (int b = from; b < to; b++) {
+                long long base = static_cast<long long>(b) * k;
+                neighborFound[b] =
+                    nearestInRow(*matrix, nodes, n, b, k, neighborBin + base, neighborDist + base);
+            }
+            return;
+        }
+        NeighborSearch search(network, firstBinAt, nextBinAt);
+        for (int b = from; b < to; b++) {
+            if (nodes[b] < 0 || nodes[b] >= nodeCount)
+                continue;
+            long long base = static_cast<long long>(b) * k;
+            neighborFound[b] =
+                search.nearest(nodes[b], b, k, neighborBin + base, neighborDist + base);
+        }
+    };
+    if (k > 0 && threadCount == 1) {
+        searchChunk(0);  // tek iş parçacığı: havuz açmadan (ör. zaten bir havuzun içindeyken)
+    } else if (k > 0) {
+        ThreadPool pool(threadCount);
+        chunks = pool.getThreadCount() * 4;
+        if (chunks > n)
+            chunks = n;
+        pool.parallelFor(0, chunks, searchChunk);
+    }
+
+    // Tasarruf listesi: s(i, j) = d(i, depo) + d(depo, j) - d(i, j), büyükten küçüğe
+    PriorityQueue<long long> savings;
+    for (int i = 0; i < n; i++) {
+        if (toDepot[i] == INT_MAX)
+            continue;
+        for (int t = 0; t < neighborFound[i]; t++) {
+            long long base = static_cast<long long>(i) * k + t;
+            int j = neighborBin[base];
+            long long saving =
+                static_cast<long long>(toDepot[i]) + fromDepot[j] - neighborDist[base];
+            if (saving <= 0 || saving > INT_MAX)
+                continue;
+            savings.push(static_cast<long long>(i) * n + j, -static_cast<int>(saving));
+            savingsCount++;
+        }
+    }
+
+    // Paralel birleştirme: her bin başta kendi seferi; i bir seferin sonu, j bir başkasının başı
+    int* next = new int[n];
+    int* prev = new int[n];
+    int* headOf = new int[n];   // valid for trip tails
+    int* tailOf = new int[n];   // valid for trip heads
+    long long* tripFill = new long long[n];  // valid for trip heads
+    for (int b = 0; b < n; b++) {
+        next[b] = prev[b] = -1;
+        headOf[b] = tailOf[b] = b;
+        tripFill[b] = fill[b];
+    }
+
+    while (!savings.isEmpty()) {
+        long long pair = savings.top();
+        savings.pop();
+        int i = static_cast<int>(pair / n);
+        int j = static_cast<int>(pair % n);
+        if (next[i] != -1 || prev[j] != -1 || headOf[i] == j)
+            continue;  // i sefer sonu değil, j sefer başı değil ya da aynı sefer
+        int head = headOf[i];
+        if (tripFill[head] + tripFill[j] > capacity)
+            continue;
+
+        int tail = tailOf[j];
+        next[i] = j;
+        prev[j] = i;
+        tailOf[head] = tail;
+        headOf[tail] = head;
+        tripFill[head] += tripFill[j];
+        mergeCount++;
+    }
+
+    // Seferleri sırala: bulunulan yerden en yakın sefer başı, sığmıyorsa önce boşalt;
+    // hiçbir sefer başına yol kalmadıysa greedy gibi durulur
+    int* heads = new int[n];
+    int* headNodes = new int[n];
+    int* headDist = new int[n];
+    int headCount = 0;
+    for (int b = 0; b < n; b++) {
+        if (prev[b] == -1) {
+            heads[headCount] = b;
+            headNodes[headCount] = nodes[b];
+            headCount++;
+        }
+    }
+
+    int current = depot;
+    int disposals = 0;
+    auto nearestHead = [&]() {
+        planner.computeDistances(current, headNodes, headCount, headDist);
+        int best = 0;
+        for (int h = 1; h < headCount; h++) {
+            if (headDist[h] < headDist[best])
+                best = h;
+        }
+        return best;
+    };
+    auto dispose = [&]() {
+        int site = planner.findNearestDisposal(current, state);
+        if (site == -1)
+            return;
+        route.addDisposalStop(site);
+        current = site;
+        load = 0;
+        disposals++;
+    };
+
+    while (headCount > 0) {
+        int h = nearestHead();
+        if (load > 0 && tripFill[heads[h]] > capacity - load) {
+            dispose();
+            h = nearestHead();
+        }
+        if (headDist[h] == INT_MAX)
+            break;
+
+        for (int b = heads[h]; b != -1; b = next[b]) {
+            // Tek bin'i aşan seferler yalnızca ilk seferde yüklü kamyonla oluşur
+            if (load > 0 && fill[b] > capacity - load)
+                dispose();
+            route.addBin(bins[b]);
+            if (load + fill[b] <= capacity)
+                load += fill[b];  // Truck::collect gibi: sığmayan yük eklenmez
+            current = nodes[b];
+        }
+
+        heads[h] = heads[headCount - 1];
+        headNodes[h] = headNodes[headCount - 1];
+        headCount--;
+    }
+    tripCount = disposals + 1;
+
+    delete[] bins;
+    delete[] nodes;
+    delete[] fill;
+    delete[] fromDepot;
+    delete[] toDepot;
+    delete[] neighborBin;
+    delete[] neighborDist;
+    delete[] neighborFound;
+    delete[] firstBinAt;
+    delete[] nextBinAt;
+    delete[] next;
+    delete[] prev;
+    delete[] headOf;
+    delete[] tailOf;
+    delete[] tripFill;
+    delete[] heads;
+    delete[] headNodes;
+    delete[] headDist;
+
+    lastMillis =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+            .count();
+    return route;
+}
+
+void SavingsPlanner::setNeighborCount(int count) {
+    neighborCount = count > 0 ? count : 1;
+}
+
+void SavingsPlanner::setThreadCount(int threads) {
+    threadCount = threads;
+}
+
+int SavingsPlanner::getSavingsCount() const {
+    return savingsCount;
+}
+
+int SavingsPlanner::getMergeCount() const {
+    return mergeCount;
+}
+
+int SavingsPlanner::getTripCount() const {
+    return tripCount;
+}
+
+double SavingsPlanner::getLastMillis() const {
+    return lastMillis;
+}
+
+}  // namespace project
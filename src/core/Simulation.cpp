@@ -6,6 +6,7 @@
  */
 
 #include "core/Simulation.h"
+#include "data_structures/PriorityQueue.hpp"
 
 #include <climits>
 #include <iostream>
@@ -14,10 +15,15 @@ namespace project {
 
 // Constructor
 Simulation::Simulation(Graph& graph, Facilities& facilities, int duration)
-    : graph(graph), facilities(facilities), planner(graph), currentTime(0),
+    : graph(graph), facilities(facilities), planner(graph),
+      disposalField(planner.getNetwork()), landmarks(planner.getNetwork()), legs(planner),
+      multiStart(planner, 1), horizon(planner), lns(planner, 0.0), improver(planner),
+      rescheduler(planner), currentTime(0),
       maxTime(duration),  // Simulation.h'ten gelen private ve public değişkenler. Tüm değerleri
                           // initalize ettik.
-      overflowCount(0), totalDistance(0), collectionsCompleted(0) {
+      overflowCount(0), totalDistance(0), collectionsCompleted(0), plannedDistanceBefore(0),
+      plannedDistanceAfter(0), emergencyInsertions(0), emergencyLookups(0), deferredBinDays(0),
+      earlyCollections(0), fleet(nullptr) {
     // Store initial bin fills for reset and record as Day 0 history
     int binCount = facilities.getBinCount();
     initialBinFills = new int[binCount];
@@ -27,69 +33,243 @@ Simulation::Simulation(Graph& graph, Facilities& facilities, int duration)
         facilities.getBin(i).recordFillLevel(initialBinFills[i]);
     }
 
-    // Store initial truck state
-    initialTruckLoad = facilities.getTruck().getCurrentLoad();
-    initialTruckNode = facilities.getTruck().getCurrentNode();
+    // Store initial truck states
+    int truckCount = facilities.getTruckCount();
+    initialTruckLoads = new int[truckCount];
+    initialTruckNodes = new int[truckCount];
+    truckDistance = new int[truckCount];
+    truckCollections = new int[truckCount];
+    for (int t = 0; t < truckCount; t++) {
+        initialTruckLoads[t] = facilities.getTruck(t).getCurrentLoad();
+        initialTruckNodes[t] = facilities.getTruck(t).getCurrentNode();
+        truckDistance[t] = 0;
+        truckCollections[t] = 0;
+    }
+
+    buildDistanceMatrix();
+
+    // Tüm disposal tesislerinden tek multi-source arama
+    int disposalCount = 0;
+    int* disposalNodes = facilities.getDisposalNodes(disposalCount);
+    disposalField.build(disposalNodes, disposalCount);
+    planner.setDisposalField(&disposalField);
+    delete[] disposalNodes;
+
+    // Filo: bölgeler bir kez ayrılır, rotalar her gün paralel planlanır
+    if (truckCount > 1) {
+        fleet = new FleetPlanner(planner, facilities);
+    }
+}
+
+// Yol ağı sabit: tüm ilgi noktaları arası mesafeleri bir kez hesapla
+void Simulation::buildDistanceMatrix() {
+    int binCount = facilities.getBinCount();
+    int facilityCount = facilities.getFacilityCount();
+    int truckCount = facilities.getTruckCount();
+    int* points = new int[binCount + facilityCount + truckCount];
+    int pointCount = 0;
+
+    for (int i = 0; i < binCount; i++) {
+        points[pointCount++] = facilities.getBin(i).getNodeId();
+    }
+    for (int i = 0; i < facilityCount; i++) {
+        points[pointCount++] = facilities.getFacilities()[i].getNodeId();
+    }
+    for (int t = 0; t < truckCount; t++) {
+        points[pointCount++] = facilities.getTruck(t).getCurrentNode();  // başlangıç konumları
+    }
+
+    if (distances.build(planner, points, pointCount)) {
+        planner.setDistanceMatrix(&distances);
+    } else {
+        // Tablo çok büyük: aramalar kalıyor, landmark alt sınırlarıyla budayalım
+        landmarks.build(LANDMARK_COUNT);
+        planner.setLandmarkOracle(&landmarks);
+    }
+
+    delete[] points;
+}
+
+// Bacağı önbellekten al (ilk seferde arama), günün yoluna ekle
+int Simulation::drive(int from, int to, bool record) {
+    const Path& leg = legs.getLeg(from, to);
+    if (leg.getDistance() == INT_MAX) {
+        return INT_MAX;
+    }
+    if (record)
+        dayPath.appendLeg(leg);
+    return leg.getDistance();
 }
 
 // Destructor
 Simulation::~Simulation() {
+    delete fleet;
     delete[] initialBinFills;
+    delete[] initialTruckLoads;
+    delete[] initialTruckNodes;
+    delete[] truckDistance;
+    delete[] truckCollections;
 }
 
 // step(), günlük yapılacak işlemler
 void Simulation::step() {
     // 1. Update all bin fill levels (updateFill already records to history)
-    for (int i = 0; i < facilities.getBinCount(); i++) {
-        facilities.getBin(i).updateFill();  // This calls recordFillLevel internally
-    }
-
-    // 2.1 Overflow check (başlamadan önce)
-    checkOverflows();
-
-    // 3. Plan collection route
-    // Save bin states
-    int* savedFills = new int[facilities.getBinCount()];
-    for (int i = 0; i < facilities.getBinCount(); i++) {
-        savedFills[i] = facilities.getBin(i).getCurrentFill();
-    }
-    int savedTruckLoad = facilities.getTruck().getCurrentLoad();
-    int savedTruckNode = facilities.getTruck().getCurrentNode();
-    Route plannedroute =
-        planner.planRoute(facilities);  //.planRoute kullanarak "plannedroute" oluşturduk
-    // Restore bin states
-    for (int i = 0; i < facilities.getBinCount(); i++) {
-        int currentFill = facilities.getBin(i).getCurrentFill();
-        int toRestore = savedFills[i] - currentFill;
-        if (toRestore != 0) {
-            // Manually restore the fill level
-            facilities.getBin(i).setCurrentFill(savedFills[i]);
+    // 2.1 Overflow check (başlamadan önce) aynı geçişte: her Bin belleğe bir kez gelir
+    // 2.2 Tahmin modeli açıksa (ikisi de açıksa Holt-Winters) günün eklenen miktarını
+    //     aynı geçişte öğrenir
+    // 2.3 Kritik bin indeksi açıksa taşma günü değişen bin'ler aynı geçişte yeniden
+    //     anahtarlanır (modelle tahmin gün sonunda değişir: ayrı geçiş)
+    Bin* bins = facilities.getBins();
+    int binCount = facilities.getBinCount();
+    ForecastModel* model = nullptr;
+    if (forecaster.isEnabled()) {
+        if (forecaster.getBinCount() != binCount)
+            forecaster.load(facilities);
+        model = &forecaster;
+    } else if (smoothing.isEnabled()) {
+        if (smoothing.getBinCount() != binCount)
+            smoothing.load(facilities);
+        model = &smoothing;
+    }
+    planner.setForecaster(model);
+    state.setForecaster(model);
+    horizon.setForecaster(model);
+    if (fleet != nullptr)
+        fleet->setForecaster(model);
+
+    // İndeks taramayla aynı tahminciyi kullanır: kritik kümeler aynı kalır
+    const OverflowPredictor& predictor = planner.getPredictor();
+    criticalIndex.setCriticalThreshold(predictor.getCriticalThreshold());
+    bool indexBuilt = criticalIndex.isEnabled() && criticalIndex.getBinCount() == binCount;
+    bool rekeyInPass = indexBuilt && model == nullptr;
+    for (int i = 0; i < binCount; i++) {
+        int before = bins[i].getCurrentFill();
+        bins[i].updateFill();  // This calls recordFillLevel internally
+        if (bins[i].isOverflowing())
+            overflowCount++;
+        else if (model != nullptr)  // kapasitede kırpılan gün eksik gösterir, öğretilmez
+            model->observe(i, bins[i].getCurrentFill() - before);  // ölçülen günlük artış
+        if (rekeyInPass)
+            criticalIndex.update(i, bins[i], predictor, currentTime);
+    }
+    if (model != nullptr)
+        model->advanceDay();
+    if (criticalIndex.isEnabled() && !indexBuilt) {
+        criticalIndex.build(facilities, predictor, currentTime);  // ilk gün bir kez
+    } else if (indexBuilt && !rekeyInPass) {
+        for (int i = 0; i < binCount; i++) {
+            criticalIndex.update(i, bins[i], predictor, currentTime);
         }
     }
-    delete[] savedFills;
 
-    // Restore truck state
-    facilities.getTruck().setCurrentLoad(savedTruckLoad);
-    facilities.getTruck().moveTo(savedTruckNode);
+    // 3. Plan collection route(s): fleets plan every truck's territory in parallel
+    Route plannedroute;
+    if (fleet != nullptr) {
+        fleet->plan(facilities, improver.getTimeBudget());
+        plannedDistanceBefore += fleet->getPlannedBefore();
+        plannedDistanceAfter += fleet->getPlannedAfter();
+    } else {
+        // Anlık görüntü üzerinde planla: bin'ler ve truck değişmez, geri yükleme gerekmez.
+        // Ufuk planlayıcısı açıksa görüntü yalnızca bugün toplanacak bin'leri tutar
+        if (horizon.isEnabled()) {
+            horizon.select(facilities, state);
+            deferredBinDays += horizon.getDeferredCount();
+            earlyCollections += horizon.getOptionalCount();
+        } else {
+            state.capture(facilities);
+        }
+        bool useMultiStart = multiStart.getStarts() > 1 &&
+                             planner.getPlanningEngine() == RoutePlanner::PlanningEngine::Greedy;
+        if (useMultiStart) {
+            plannedroute = multiStart.plan(state);  // N rastgele greedy'nin en kısası
+        } else {
+            plannedroute = planner.planRoute(state);  // "plannedroute" oluşturduk
+        }
+
+        // 3.1 İstenirse süre bütçesi boyunca LNS, ardından yerel arama (aynı görüntüyle)
+        bool useLns = lns.getTimeBudget() > 0 || lns.getMaxIterations() > 0;
+        if (useLns) {
+            plannedroute = lns.improve(plannedroute, state);
+        }
+        plannedroute = improver.improve(plannedroute, state);
+        plannedDistanceBefore +=
+            useLns ? lns.getInitialDistance() : improver.getInitialDistance();
+        plannedDistanceAfter += improver.getFinalDistance();
+
+        // Alt küme yuvaları bin indekslerine çevrilir (tam görüntüde ikisi aynı)
+        if (horizon.isEnabled()) {
+            Route global;
+            for (int i = 0; i < plannedroute.getLength(); i++) {
+                if (plannedroute.isDisposalAt(i))
+                    global.addDisposalStop(plannedroute.getDisposalNodeAt(i));
+                else
+                    global.addBin(state.getBinIndex(plannedroute.getBinAt(i)));
+            }
+            global.setTotalDistance(plannedroute.getTotalDistance());
+            plannedroute = global;
+        }
+    }
 
-    // 4. Execute truck movements and collections
-    Truck& truck = facilities.getTruck();
+    // 4. Critical bins the plan missed are inserted into today's routes (no re-plan)
+    int truckCount = fleet != nullptr ? facilities.getTruckCount() : 1;
+    Route* routes = new Route[truckCount];
+    for (int t = 0; t < truckCount; t++) {
+        routes[t] = fleet != nullptr ? fleet->getRoute(t) : plannedroute;
+    }
+    bool anyCritical = criticalIndex.isEnabled() ? criticalIndex.hasCritical(currentTime)
+                                                 : planner.hasCriticalBins(facilities);
+    if (anyCritical) {
+        handleEmergencyReschedule(routes, truckCount);
+    }
+
+    // 5-6. Execute truck movements, collections and disposal trips
+    dayPath.clear();
+    dayPath.addNode(facilities.getTruck().getCurrentNode());
+    for (int t = 0; t < truckCount; t++) {
+        executeRoute(t, routes[t]);
+    }
+    delete[] routes;
+
+    currentTime++;  // günlük mesai bitişi, günü bir arttır
+}
+
+// Planlanan rotayı bir kamyonla sür; mesafe ve toplamalar kamyona da yazılır
+void Simulation::executeRoute(int truckIndex, const Route& route) {
+    Truck& truck = facilities.getTruck(truckIndex);
     int currentLocation = truck.getCurrentNode();  // currentNode demek yerine currentLocation
+    bool record = truckIndex == 0;                 // günün yolu ilk kamyonunki
+    int distanceBefore = totalDistance;
+    int collectionsBefore = collectionsCompleted;
+
+    for (int i = 0; i < route.getLength(); i++) {
+        if (route.isDisposalAt(i)) {
+            // Planlanan boşaltma durağı (yolda zaten boşaldıysa atla)
+            int disposalLocation = route.getDisposalNodeAt(i);
+            if (truck.getCurrentLoad() > 0) {
+                int distance = drive(currentLocation, disposalLocation, record);
+                if (distance != INT_MAX && distance > 0) {
+                    totalDistance += distance;
+                }
+                truck.moveTo(disposalLocation);
+                truck.unload();
+                currentLocation = disposalLocation;
+            }
+            continue;
+        }
 
-    for (int i = 0; i < plannedroute.getLength(); i++) {
-        int binNum = plannedroute.getBinAt(i);
+        int binNum = route.getBinAt(i);
         Bin& bin = facilities.getBin(binNum);
 
-        // 4.1 Bin'e git
+        // Bin'e git
         int binLocation = bin.getNodeId();  // binNode demek yerine binLocation
-        int distance = planner.computeDistance(currentLocation, binLocation);
+        int distance = drive(currentLocation, binLocation, record);
         if (distance != INT_MAX && distance > 0) {
             totalDistance += distance;
         }
         truck.moveTo(binLocation);
         currentLocation = binLocation;  // binLocation'a geldik
 
-        // 4.2 Collect
+        // Collect
         int garbageAmount = bin.getCurrentFill();
         int remainingCapacity = truck.getRemainingCapacity();
 
@@ -103,14 +283,16 @@ void Simulation::step() {
             garbageAmount <= remainingCapacity) {  // eğer atık var ve sınırı aşmıyor ise
             truck.collect(garbageAmount);          // topla
             bin.collect(garbageAmount);            // toplanan atık kadar bin'den çıkar
+            if (criticalIndex.isEnabled())  // taşma günü değişti
+                criticalIndex.update(binNum, bin, planner.getPredictor(), currentTime);
             collectionsCompleted++;                // toplama sayacını arttır
         }
 
-        // 5. Handle disposal trips when truck is full
+        // Handle disposal trips when truck is full
         if (truck.isFull()) {
             int disposalLocation = planner.findNearestDisposal(currentLocation, facilities);
             if (disposalLocation != -1) {  // RoutePlanner.h'teki line 70'e referans
-                distance = planner.computeDistance(currentLocation, disposalLocation);
+                distance = drive(currentLocation, disposalLocation, record);
                 if (distance != INT_MAX && distance > 0) {
                     totalDistance += distance;
                 }
@@ -121,22 +303,32 @@ void Simulation::step() {
         }
     }
 
+    // Vardiya sonu: yük varsa en yakın tesiste boşalt (ertesi gün boş başlanır)
+    if (truck.getCurrentLoad() > 0) {
+        int disposalLocation = planner.findNearestDisposal(currentLocation, facilities);
+        if (disposalLocation != -1) {
+            int distance = drive(currentLocation, disposalLocation, record);
+            if (distance != INT_MAX && distance > 0) {
+                totalDistance += distance;
+            }
+            truck.moveTo(disposalLocation);
+            truck.unload();
+            currentLocation = disposalLocation;
+        }
+    }
+
     // Depot'a dön
     int depotLocation = facilities.getDepotNode();
     if (currentLocation != depotLocation) {
-        int distance = planner.computeDistance(currentLocation, depotLocation);
+        int distance = drive(currentLocation, depotLocation, record);
         if (distance != INT_MAX && distance > 0) {
             totalDistance += distance;
         }
         truck.moveTo(depotLocation);
     }
 
-    // 6. Track overflow events
-    if (planner.hasCriticalBins(facilities)) {
-        handleEmergencyReschedule();
-    }
-
-    currentTime++;  // günlük mesai bitişi, günü bir arttır
+    truckDistance[truckIndex] += totalDistance - distanceBefore;
+    truckCollections[truckIndex] += collectionsCompleted - collectionsBefore;
 }
 
 // Simülasyonu başlat
@@ -166,15 +358,6 @@ Facilities& Simulation::getFacilities() {
     return facilities;
 }
 
-// Overflow check
-void Simulation::checkOverflows() {
-    for (int i = 0; i < facilities.getBinCount(); i++) {
-        if (facilities.getBin(i).isOverflowing()) {
-            overflowCount++;
-        }
-    }
-}
-
 // Emergency reschedule
 /**
  * (reference to Simulation.h) Handles dynamic rescheduling when critical bins detected.
@@ -183,52 +366,54 @@ void Simulation::checkOverflows() {
  * Adjusts current route to prioritize critical bins.
  */
 
-void Simulation::handleEmergencyReschedule() {
-    // Plan a new route
-    Route emergencyRoute = planner.planRoute(facilities);
-
-    Truck& truck = facilities.getTruck();
-    int currentLocation = truck.getCurrentNode();
-
-    for (int i = 0; i < emergencyRoute.getLength(); i++) {
-        int binIndex = emergencyRoute.getBinAt(i);
-        Bin& bin = facilities.getBin(binIndex);
-
-        // Overflowing'leri bul ve topla
-        if (bin.isOverflowing()) {
-            int overflowingbinLocation = bin.getNodeId();
-            int distance = planner.computeDistance(currentLocation, overflowingbinLocation);
-            totalDistance += distance;
-            truck.moveTo(overflowingbinLocation);
-
-            int garbageAmount = bin.getCurrentFill();
-            int remainingCapacity = truck.getRemainingCapacity();
-
-            if (garbageAmount > remainingCapacity) {
-                garbageAmount = remainingCapacity;
-            }
-
-            if (garbageAmount > 0) {
-                truck.collect(garbageAmount);
-                bin.collect(garbageAmount);
-                collectionsCompleted++;
-            }
+void Simulation::handleEmergencyReschedule(Route* routes, int truckCount) {
+    // Rotalarda zaten olan bin'ler tekrar eklenmez
+    int binCount = facilities.getBinCount();
+    bool* planned = new bool[binCount > 0 ? binCount : 1];
+    for (int i = 0; i < binCount; i++) {
+        planned[i] = false;
+    }
+    for (int t = 0; t < truckCount; t++) {
+        for (int k = 0; k < routes[t].getLength(); k++) {
+            if (!routes[t].isDisposalAt(k))
+                planned[routes[t].getBinAt(k)] = true;
+        }
+    }
 
-            currentLocation = overflowingbinLocation;
+    // Adaylar: indeks açıksa yalnızca kritik bin'ler, değilse hepsi tek tek denenir
+    int* candidates = nullptr;
+    int candidateCount = binCount;
+    if (criticalIndex.isEnabled()) {
+        candidates = new int[binCount > 0 ? binCount : 1];
+        candidateCount = criticalIndex.getCriticalBins(currentTime, candidates);
+    }
 
-            // Truck full olunca boşalt
-            if (truck.isFull()) {
-                int disposalLocation = planner.findNearestDisposal(currentLocation, facilities);
-                if (disposalLocation != -1) {
-                    distance = planner.computeDistance(currentLocation, disposalLocation);
-                    totalDistance += distance;
-                    truck.moveTo(disposalLocation);
-                    truck.unload();
-                    currentLocation = disposalLocation;
-                }
-            }
+    // Her kamyon kendi bölgesindeki kritik bin'leri alır (tek kamyonda hepsi ilkine)
+    for (int t = 0; t < truckCount; t++) {
+        state.capture(facilities, t);  // tüm bin'ler: slot == bin indeksi
+        PriorityQueue<int> urgent;     // taşmasına en az gün kalan önce
+        for (int c = 0; c < candidateCount; c++) {
+            int i = candidates != nullptr ? candidates[c] : c;
+            int owner = fleet != nullptr ? fleet->getTerritoryOf(i) : 0;
+            if (planned[i] || (owner != -1 ? owner : 0) != t ||
+                (candidates == nullptr && !planner.isCriticalBin(facilities.getBin(i), i)))
+                continue;
+            urgent.push(i, (int)state.getRisk(i));
         }
+        if (urgent.isEmpty())
+            continue;
+
+        rescheduler.attach(routes[t], state);
+        while (!urgent.isEmpty()) {
+            if (rescheduler.insert(urgent.top()) != -1)
+                emergencyInsertions++;
+            urgent.pop();
+        }
+        emergencyLookups += rescheduler.getLookups();
+        routes[t] = rescheduler.getRoute();
     }
+    delete[] planned;
+    delete[] candidates;
 }
 
 // Performance
@@ -244,6 +429,86 @@ int Simulation::getCollectionsCompleted() const {
     return collectionsCompleted;
 }
 
+int Simulation::getEmergencyInsertions() const {
+    return emergencyInsertions;
+}
+
+long long Simulation::getDeferredBinDays() const {
+    return deferredBinDays;
+}
+
+int Simulation::getEarlyCollections() const {
+    return earlyCollections;
+}
+
+const DistanceMatrix& Simulation::getDistanceMatrix() const {
+    return distances;
+}
+
+int Simulation::getTruckDistance(int truck) const {
+    if (truck < 0 || truck >= facilities.getTruckCount()) {
+        return 0;
+    }
+    return truckDistance[truck];
+}
+
+int Simulation::getTruckCollections(int truck) const {
+    if (truck < 0 || truck >= facilities.getTruckCount()) {
+        return 0;
+    }
+    return truckCollections[truck];
+}
+
+const FleetPlanner* Simulation::getFleetPlanner() const {
+    return fleet;
+}
+
+void Simulation::setPlanningEngine(RoutePlanner::PlanningEngine engine) {
+    planner.setPlanningEngine(engine);
+}
+
+void Simulation::setHierarchy(const ContractionHierarchy* index) {
+    planner.setHierarchy(index);
+    planner.setSearchMode(index != nullptr ? RoutePlanner::SearchMode::Hierarchy
+                                           : RoutePlanner::SearchMode::Dijkstra);
+}
+
+LnsPlanner& Simulation::getLnsPlanner() {
+    return lns;
+}
+
+MultiStartPlanner& Simulation::getMultiStartPlanner() {
+    return multiStart;
+}
+
+HorizonPlanner& Simulation::getHorizonPlanner() {
+    return horizon;
+}
+
+FillForecaster& Simulation::getForecaster() {
+    return forecaster;
+}
+
+SmoothingForecaster& Simulation::getSmoothingForecaster() {
+    return smoothing;
+}
+
+CriticalBinIndex& Simulation::getCriticalIndex() {
+    return criticalIndex;
+}
+
+RouteImprover& Simulation::getRouteImprover() {
+    return improver;
+}
+
+const Path& Simulation::getDayPath() const {
+    return dayPath;
+}
+
+const LegCache& Simulation::getLegCache() const {
+    return legs;
+}
+
 // Print statistics
 void Simulation::printStatistics() const {
     std::cout << "======= Simulation Statistics =======\n";
@@ -255,6 +520,60 @@ void Simulation::printStatistics() const {
               << " units\n";
     std::cout << "Average Collections per Day: "
               << (maxTime > 0 ? collectionsCompleted / maxTime : 0) << std::endl;
+    if (plannedDistanceBefore > 0) {
+        const char* engineName = "greedy";
+        if (planner.getPlanningEngine() == RoutePlanner::PlanningEngine::Savings)
+            engineName = "savings";
+        else if (planner.getPlanningEngine() == RoutePlanner::PlanningEngine::GiantTour)
+            engineName = "giant tour + split";
+        std::cout << "Planned Distance per Day: "
+                  << (maxTime > 0 ? plannedDistanceBefore / maxTime : 0) << " units "
+                  << engineName << ", "
+                  << (maxTime > 0 ? plannedDistanceAfter / maxTime : 0)
+                  << " units after local search ("
+                  << 100.0 * (plannedDistanceBefore - plannedDistanceAfter) / plannedDistanceBefore
+                  << "% shorter)\n";
+    }
+    if (fleet == nullptr && multiStart.getStarts() > 1 && multiStart.getLastMillis() > 0) {
+        std::cout << "Multi-start (last day): " << multiStart.getStarts() << " starts in "
+                  << multiStart.getLastMillis() << " ms on " << multiStart.getThreadCount()
+                  << " threads, best start #" << multiStart.getBestStart() << ", "
+                  << multiStart.getGreedyDistance() << " -> " << multiStart.getBestDistance()
+                  << " units\n";
+    }
+    if (fleet == nullptr && lns.getIterations() > 0) {
+        std::cout << "LNS (last day): " << lns.getIterations() << " iterations in "
+                  << lns.getLastMillis() << " ms (" << lns.getIterationsPerSecond()
+                  << "/s), " << lns.getImprovementCount() << " new best routes, "
+                  << lns.getInitialDistance() << " -> " << lns.getFinalDistance() << " units\n";
+    }
+    if (fleet == nullptr && horizon.isEnabled()) {
+        std::cout << "Horizon Planning: " << deferredBinDays << " bin-days deferred, "
+                  << earlyCollections << " bins collected early on the way (horizon "
+                  << horizon.getHorizonDays() << " days)\n";
+    }
+    if (emergencyInsertions > 0) {
+        std::cout << "Emergency Insertions: " << emergencyInsertions << " critical bins, "
+                  << emergencyLookups << " distance lookups\n";
+    }
+    if (fleet != nullptr) {
+        std::cout << "Fleet: " << fleet->getTruckCount() << " trucks, last day planned in "
+                  << fleet->getLastMillis() << " ms on " << fleet->getThreadCount()
+                  << " threads\n";
+        for (int t = 0; t < fleet->getTruckCount(); t++) {
+            std::cout << "  " << facilities.getTruck(t).getId() << ": "
+                      << fleet->getTerritorySize(t) << " bins, " << truckDistance[t]
+                      << " units, " << truckCollections[t] << " collections\n";
+        }
+    }
+    distances.printReport(std::cout);
+    if (landmarks.getLandmarkCount() > 0) {
+        landmarks.printReport(std::cout);
+        long long scored = planner.getCandidatesScored();
+        std::cout << "Candidate Bins Pruned: " << planner.getCandidatesPruned() << " of " << scored
+                  << " (" << (scored > 0 ? 100.0 * planner.getCandidatesPruned() / scored : 0.0)
+                  << "%)\n";
+    }
     std::cout << "=====================================\n";
 }
 
@@ -267,22 +586,37 @@ void Simulation::reset() {
     overflowCount = 0;
     totalDistance = 0;
     collectionsCompleted = 0;
+    plannedDistanceBefore = 0;
+    plannedDistanceAfter = 0;
+    emergencyInsertions = 0;
+    emergencyLookups = 0;
+    deferredBinDays = 0;
+    earlyCollections = 0;
 
     // Reset all bins to initial fill levels and clear history
     int binCount = facilities.getBinCount();
     for (int i = 0; i < binCount; i++) {
         Bin& bin = facilities.getBin(i);
         bin.setCurrentFill(initialBinFills[i]);
-        // Clear fill history by recording initial fill 7 times
-        for (int j = 0; j < 7; j++) {
+        // Clear fill history by recording initial fill once per history day
+        for (int j = 0; j < bin.getHistoryDays(); j++) {
             bin.recordFillLevel(initialBinFills[i]);
         }
     }
 
-    // Reset truck to initial state
-    Truck& truck = facilities.getTruck();
-    truck.setCurrentLoad(initialTruckLoad);
-    truck.moveTo(initialTruckNode);
+    dayPath.clear();
+    forecaster.reset(0);  // next step starts the model again from the fill rates
+    smoothing.reset(0);
+    criticalIndex.clear();
+
+    // Reset trucks to initial state
+    for (int t = 0; t < facilities.getTruckCount(); t++) {
+        Truck& truck = facilities.getTruck(t);
+        truck.setCurrentLoad(initialTruckLoads[t]);
+        truck.moveTo(initialTruckNodes[t]);
+        truckDistance[t] = 0;
+        truckCollections[t] = 0;
+    }
 }
 
 }  // namespace project
\ No newline at end of file
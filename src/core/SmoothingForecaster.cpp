@@ -0,0 +1,77 @@
+/**
+ * @file SmoothingForecaster.cpp
+ * @brief Implementation of SmoothingForecaster class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/SmoothingForecaster.h"
+
+#include <climits>
+
+namespace project {
+
+SmoothingForecaster::SmoothingForecaster(double alpha)
+    : levels(nullptr), binCount(0), alpha(alpha), enabled(false) {}
+
+SmoothingForecaster::~SmoothingForecaster() {
+    delete[] levels;
+}
+
+void SmoothingForecaster::load(const Facilities& facilities) {
+    reset(facilities.getBinCount());
+    for (int i = 0; i < binCount; i++) {
+        setLevel(i, facilities.getBin(i).getFillRate());
+    }
+}
+
+void SmoothingForecaster::reset(int count) {
+    if (count != binCount) {
+        delete[] levels;
+        levels = count > 0 ? new float[count] : nullptr;
+        binCount = count;
+    }
+    for (int i = 0; i < binCount; i++) {
+        levels[i] = 0.0f;
+    }
+}
+
+void SmoothingForecaster::setLevel(int index, double level) {
+    levels[index] = static_cast<float>(level);
+}
+
+void SmoothingForecaster::observe(int index, double inflow) {
+    levels[index] = static_cast<float>(alpha * inflow + (1.0 - alpha) * levels[index]);
+}
+
+void SmoothingForecaster::advanceDay() {}
+
+double SmoothingForecaster::forecast(int index, int /*ahead*/) const {
+    return levels[index] > 0.0f ? levels[index] : 0.0;
+}
+
+int SmoothingForecaster::predictDaysToOverflow(int index, int remaining) const {
+    double level = levels[index];
+    if (level <= 0.0)
+        return INT_MAX;  // hiç dolmuyor
+
+    // OverflowPredictor ile aynı yuvarlama: tam gün, en az 1
+    double days = remaining / level;
+    if (days < 1.0)
+        return 1;
+    return days < INT_MAX - 1 ? static_cast<int>(days) : INT_MAX - 1;
+}
+
+int SmoothingForecaster::getBinCount() const {
+    return binCount;
+}
+
+void SmoothingForecaster::setEnabled(bool value) {
+    enabled = value;
+}
+
+bool SmoothingForecaster::isEnabled() const {
+    return enabled;
+}
+
+}  // namespace project
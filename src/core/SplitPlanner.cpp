@@ -0,0 +1,341 @@
+/**
+ * @file SplitPlanner.cpp
+ * @brief Implementation of SplitPlanner class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "core/SplitPlanner.h"
+
+#include "core/RoutePlanner.h"
+#include "data_structures/IndexedPriorityQueue.hpp"
+
+#include <chrono>
+#include <climits>
+
+namespace project {
+
+namespace {
+
+/**
+ * Dijkstra that stops at the first node holding an unvisited bin. Distances are reset
+ * sparsely through the `touched` list, so a search costs only the nodes it reached.
+ */
+class NearestUnvisited {
+public:
+    NearestUnvisited(const CsrGraph& network, const int* firstBinAt, const int* nextBinAt,
+                     const bool* visited)
+        : network(network),
+          firstBinAt(firstBinAt),
+          nextBinAt(nextBinAt),
+          visited(visited),
+          queue(network.getNodeCount()),
+          touchedCount(0) {
+        int nodeCount = network.getNodeCount();
+        dist = new int[nodeCount];
+        touched = new int[nodeCount];
+        for (int v = 0; v < nodeCount; v++) {
+            dist[v] = INT_MAX;
+        }
+    }
+
+    ~NearestUnvisited() {
+        delete[] dist;
+        delete[] touched;
+    }
+
+    NearestUnvisited(const NearestUnvisited&) = delete;
+    NearestUnvisited& operator=(const NearestUnvisited&) = delete;
+
+    // Returns the nearest unvisited bin (or -1) and its distance in `distance`
+    int find(int source, int& distance) {
+        int found = -1;
+        distance = INT_MAX;
+        reach(source, 0);
+        queue.push(source, 0);
+
+        while (!queue.isEmpty() && found == -1) {
+            int u = queue.top();
+            queue.pop();
+            for (int b = firstBinAt[u]; b != -1; b = nextBinAt[b]) {
+                if (!visited[b]) {
+                    found = b;
+                    distance = dist[u];
+                    break;
+                }
+            }
+
+            const Edge* end = network.edgesEnd(u);
+            for (const Edge* e = network.edgesBegin(u); e != end && found == -1; ++e) {
+                int candidate = dist[u] + e->weight;
+                if (candidate < dist[e->toNode]) {
+                    reach(e->toNode, candidate);
+                    queue.pushOrDecrease(e->toNode, candidate);
+                }
+            }
+        }
+
+        queue.clear();
+        for (int k = 0; k < touchedCount; k++) {
+            dist[touched[k]] = INT_MAX;
+        }
+        touchedCount = 0;
+        return found;
+    }
+
+private:
+    void reach(int node, int distance) {
+        if (dist[node] == INT_MAX)
+            touched[touchedCount++] = node;
+        dist[node] = distance;
+    }
+
+    const CsrGraph& network;
+    const int* firstBinAt;  // node -> first candidate bin there, -1 if none
+    const int* nextBinAt;   // candidate bin -> next candidate bin on the same node
+    const bool* visited;    // candidate bin already in the tour
+    IndexedPriorityQueue<int> queue;
+    int* dist;
+    int* touched;
+    int touchedCount;
+};
+
+const long long UNREACHED = LLONG_MAX / 4;
+
+// İki bacak toplamı; biri ulaşılamazsa sonuç da ulaşılamaz
+long long legSum(long long a, long long b) {
+    return a >= UNREACHED || b >= UNREACHED ? UNREACHED : a + b;
+}
+
+long long leg(int distance) {
+    return distance == INT_MAX ? UNREACHED : distance;
+}
+
+}  // namespace
+
+SplitPlanner::SplitPlanner(const RoutePlanner& planner)
+    : planner(planner),
+      tourLength(0),
+      tourDistance(0),
+      splitDistance(0),
+      tripCount(0),
+      lastMillis(0.0) {}
+
+Route SplitPlanner::plan(Facilities& facilities) {
+    PlanningState state(facilities);
+    Route route = plan(state);
+    planner.applyRoute(route, facilities);
+    return route;
+}
+
+Route SplitPlanner::plan(const PlanningState& state) {
+    auto start = std::chrono::steady_clock::now();
+    tourLength = 0;
+    tourDistance = splitDistance = 0;
+    tripCount = 1;
+
+    Route route;
+    int depot = state.getDepotNode();
+    int startLoad = state.getTruckLoad();
+    int capacity = state.getTruckCapacity();
+    const CsrGraph& network = planner.getNetwork();
+    int nodeCount = network.getNodeCount();
+    int binCount = state.getBinCount();
+
+    // node -> boş olmayan bin'ler listesi: arama yerleşen node'daki bin'leri O(1) bulur
+    int* firstBinAt = new int[nodeCount > 0 ? nodeCount : 1];
+    int* nextBinAt = new int[binCount > 0 ? binCount : 1];
+    bool* visited = new bool[binCount > 0 ? binCount : 1];
+    for (int v = 0; v < nodeCount; v++) {
+        firstBinAt[v] = -1;
+    }
+    for (int b = binCount - 1; b >= 0; b--) {
+        nextBinAt[b] = -1;
+        visited[b] = state.getFill(b) == 0;
+        int node = state.getNode(b);
+        if (!visited[b] && node >= 0 && node < nodeCount) {
+            nextBinAt[b] = firstBinAt[node];
+            firstBinAt[node] = b;
+        }
+    }
+
+    // 1. Dev tur: kapasite yok sayılır, her adımda en yakın ziyaret edilmemiş bin
+    int* tour = new int[binCount > 0 ? binCount : 1];
+    long long* legs = new long long[binCount + 1];  // legs[k]: bacak tour[k]'ya
+    int n = 0;
+    if (depot >= 0 && depot < nodeCount) {
+        NearestUnvisited search(network, firstBinAt, nextBinAt, visited);
+        int current = depot;
+        while (true) {
+            int distance = INT_MAX;
+            int next = search.find(current, distance);
+            if (next == -1)
+                break;
+            visited[next] = true;
+            tour[n] = next;
+            legs[n++] = distance;
+            current = state.getNode(next);
+        }
+    }
+    tourLength = n;
+
+    if (n == 0) {
+        delete[] firstBinAt;
+        delete[] nextBinAt;
+        delete[] visited;
+        delete[] tour;
+        delete[] legs;
+        lastMillis = std::chrono::duration<double, std::milli>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+        return route;
+    }
+
+    // Bölme için bacaklar: her bin'den en yakın tesise, o tesisten sonraki bin'e, O(n) sorgu
+    int* sites = new int[n];
+    long long* toSite = new long long[n];
+    long long* fromSite = new long long[n];  // fromSite[k]: tesis(tour[k-1]) -> tour[k]
+    int* fill = new int[n];
+    for (int k = 0; k < n; k++) {
+        int node = state.getNode(tour[k]);
+        int amount = state.getFill(tour[k]);
+        fill[k] = amount < capacity ? amount : capacity;  // sığmayan kısmı kamyon almaz
+        sites[k] = planner.findNearestDisposal(node, state);
+        toSite[k] = sites[k] == -1 ? UNREACHED : leg(planner.computeDistance(node, sites[k]));
+        if (k > 0) {
+            fromSite[k] = sites[k - 1] == -1
+                              ? UNREACHED
+                              : leg(planner.computeDistance(sites[k - 1], node));
+        }
+    }
+    // Depoya dönüş yolu yoksa (tek yönlü şehir) gün son bin'de biter
+    long long back = leg(planner.computeDistance(state.getNode(tour[n - 1]), depot));
+    if (back >= UNREACHED)
+        back = 0;
+    tourDistance = back;
+    for (int k = 0; k < n; k++) {
+        tourDistance += legs[k];
+    }
+
+    // Yüklü başlayan kamyon ilk seferden önce depoya en yakın tesiste boşaltabilir
+    int firstSite = startLoad > 0 ? planner.findNearestDisposal(depot, state) : -1;
+    long long viaFirstSite = UNREACHED;
+    if (firstSite != -1) {
+        viaFirstSite = legSum(leg(planner.computeDistance(depot, firstSite)),
+                              leg(planner.computeDistance(firstSite, state.getNode(tour[0]))));
+    }
+
+    // 2. Bölme: cost[j] = ilk j bin'i toplamanın en kısa yolu; sefer i..j sığarsa denenir
+    long long* cost = new long long[n + 1];
+    int* pred = new int[n + 1];
+    bool* unloadFirst = new bool[n + 1];
+    cost[0] = 0;
+    for (int j = 1; j <= n; j++) {
+        cost[j] = UNREACHED;
+        pred[j] = -1;
+        unloadFirst[j] = false;
+    }
+    for (int i = 0; i < n; i++) {
+        if (cost[i] >= UNREACHED)
+            continue;
+        // i == 0 iki kez: mevcut yükle depodan, ya da önce boşaltıp
+        for (int variant = 0; variant < (i == 0 ? 2 : 1); variant++) {
+            long long enter = i > 0 ? fromSite[i] : (variant == 0 ? legs[0] : viaFirstSite);
+            long long load = i == 0 && variant == 0 ? startLoad : 0;
+            if (enter >= UNREACHED)
+                continue;
+            long long inside = 0;
+            for (int j = i; j < n; j++) {
+                if (j > i)
+                    inside = legSum(inside, legs[j]);
+                load += fill[j];
+                if (load > capacity || inside >= UNREACHED)
+                    break;
+                long long trip = legSum(legSum(enter, inside), j == n - 1 ? back : toSite[j]);
+                long long total = legSum(cost[i], trip);
+                if (total < cost[j + 1]) {
+                    cost[j + 1] = total;
+                    pred[j + 1] = i;
+                    unloadFirst[j + 1] = i == 0 && variant == 1;
+                }
+            }
+        }
+    }
+
+    // Tüm tur bölünemiyorsa (tesislerden devam yolu yok) en uzun ulaşılabilir ön ek kalır
+    int covered = n;
+    if (cost[n] >= UNREACHED) {
+        splitDistance = -1;
+        covered = 0;
+        for (int j = n - 1; j > 0; j--) {
+            if (cost[j] < UNREACHED && toSite[j - 1] < UNREACHED) {
+                covered = j;
+                break;
+            }
+        }
+    } else {
+        splitDistance = cost[n];
+    }
+
+    // Seferleri geri izle, sonra baştan yaz; seferler arasında en yakın tesiste boşaltılır
+    int* tripStart = new int[n + 1];
+    int trips = 0;
+    for (int j = covered; j > 0; j = pred[j]) {
+        tripStart[trips++] = pred[j];
+    }
+    for (int t = trips - 1; t >= 0; t--) {
+        int from = tripStart[t];
+        int to = t > 0 ? tripStart[t - 1] : covered;
+        if (t == trips - 1 && unloadFirst[to]) {
+            route.addDisposalStop(firstSite);
+        }
+        for (int k = from; k < to; k++) {
+            route.addBin(tour[k]);
+        }
+        if (t > 0 || covered < n) {
+            route.addDisposalStop(sites[to - 1]);
+        }
+    }
+    tripCount = trips > 0 ? trips : 1;
+
+    delete[] firstBinAt;
+    delete[] nextBinAt;
+    delete[] visited;
+    delete[] tour;
+    delete[] legs;
+    delete[] sites;
+    delete[] toSite;
+    delete[] fromSite;
+    delete[] fill;
+    delete[] cost;
+    delete[] pred;
+    delete[] unloadFirst;
+    delete[] tripStart;
+
+    lastMillis =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+            .count();
+    return route;
+}
+
+int SplitPlanner::getTourLength() const {
+    return tourLength;
+}
+
+long long SplitPlanner::getTourDistance() const {
+    return tourDistance;
+}
+
+long long SplitPlanner::getSplitDistance() const {
+    return splitDistance;
+}
+
+int SplitPlanner::getTripCount() const {
+    return tripCount;
+}
+
+double SplitPlanner::getLastMillis() const {
+    return lastMillis;
+}
+
+}  // namespace project
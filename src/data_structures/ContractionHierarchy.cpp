@@ -0,0 +1,754 @@
+/**
+ * @file ContractionHierarchy.cpp
+ * @brief Contraction-hierarchies preprocessing and queries.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "data_structures/ContractionHierarchy.h"
+
+#include <chrono>
+#include <climits>
+#include <fstream>
+
+namespace project {
+
+namespace {
+
+// Witness budget while only estimating a node's priority; a few extra shortcuts
+// counted there merely shift the order, so a small budget is enough
+const int ESTIMATE_LIMIT = 50;
+
+/**
+ * @brief Growable edge array used for the shrinking graph during contraction.
+ */
+struct EdgeBuffer {
+    Edge* items;
+    int count;
+    int capacity;
+
+    EdgeBuffer() : items(nullptr), count(0), capacity(0) {}
+    ~EdgeBuffer() { delete[] items; }
+    EdgeBuffer(const EdgeBuffer&) = delete;
+    EdgeBuffer& operator=(const EdgeBuffer&) = delete;
+
+    int find(int node) const {
+        for (int i = 0; i < count; i++) {
+            if (items[i].toNode == node)
+                return i;
+        }
+        return -1;
+    }
+
+    void add(int node, int weight) {
+        if (count == capacity) {
+            int newCapacity = capacity == 0 ? 4 : capacity * 2;
+            Edge* bigger = new Edge[newCapacity];
+            for (int i = 0; i < count; i++) {
+                bigger[i] = items[i];
+            }
+            delete[] items;
+            items = bigger;
+            capacity = newCapacity;
+        }
+        items[count++] = Edge(node, weight);
+    }
+
+    void remove(int node) {
+        int i = find(node);
+        if (i != -1) {
+            items[i] = items[--count];  // order does not matter
+        }
+    }
+
+    void release() {
+        delete[] items;
+        items = nullptr;
+        count = 0;
+        capacity = 0;
+    }
+};
+
+/**
+ * @brief The remaining (uncontracted) graph plus the scratch space of witness searches.
+ */
+class Contractor {
+private:
+    int nodeCount;
+    int witnessLimit;
+    EdgeBuffer* out;  // remaining outgoing edges
+    EdgeBuffer* in;   // remaining incoming edges, stored as (tail, weight)
+    int* witnessDist;
+    int* touched;
+    int touchedCount;
+    bool* isTarget;  // out-neighbours of the node being contracted
+    IndexedPriorityQueue<int> queue;
+
+public:
+    int* deletedNeighbours;  // contracted neighbours per node (spreads contraction evenly)
+    int* level;              // 1 + highest level among contracted neighbours (keeps hierarchy flat)
+    int shortcuts;
+
+    Contractor(const CsrGraph& graph, int limit)
+        : nodeCount(graph.getNodeCount()),
+          witnessLimit(limit > 0 ? limit : 1),
+          out(new EdgeBuffer[graph.getNodeCount()]),
+          in(new EdgeBuffer[graph.getNodeCount()]),
+          witnessDist(new int[graph.getNodeCount()]),
+          touched(new int[graph.getNodeCount()]),
+          touchedCount(0),
+          isTarget(new bool[graph.getNodeCount()]),
+          queue(graph.getNodeCount()),
+          deletedNeighbours(new int[graph.getNodeCount()]),
+          level(new int[graph.getNodeCount()]),
+          shortcuts(0) {
+        for (int v = 0; v < nodeCount; v++) {
+            witnessDist[v] = INT_MAX;
+            isTarget[v] = false;
+            deletedNeighbours[v] = 0;
+            level[v] = 0;
+        }
+        for (int u = 0; u < nodeCount; u++) {
+            const Edge* end = graph.edgesEnd(u);
+            for (const Edge* e = graph.edgesBegin(u); e != end; ++e) {
+                if (e->toNode != u) {
+                    addArc(u, e->toNode, e->weight);  // self loops never lie on a shortest path
+                }
+            }
+        }
+    }
+
+    ~Contractor() {
+        delete[] out;
+        delete[] in;
+        delete[] witnessDist;
+        delete[] touched;
+        delete[] isTarget;
+        delete[] deletedNeighbours;
+        delete[] level;
+    }
+
+    Contractor(const Contractor&) = delete;
+    Contractor& operator=(const Contractor&) = delete;
+
+    const EdgeBuffer& outgoing(int u) const { return out[u]; }
+    const EdgeBuffer& incoming(int u) const { return in[u]; }
+
+    /**
+     * @brief Adds an edge, keeping only the shorter one of parallel edges.
+     * @return `true` if a new edge was created.
+     */
+    bool addArc(int from, int to, int weight) {
+        int i = out[from].find(to);
+        if (i != -1) {
+            if (weight < out[from].items[i].weight) {
+                out[from].items[i].weight = weight;
+                in[to].items[in[to].find(from)].weight = weight;
+            }
+            return false;
+        }
+        out[from].add(to, weight);
+        in[to].add(from, weight);
+        return true;
+    }
+
+    /**
+     * @brief Bounded Dijkstra from `source` that never passes through `skip`.
+     *
+     * Stops once `targets` nodes marked in `isTarget` are settled, or after `limit`
+     * settled nodes. Leaves tentative distances in `witnessDist`; they are lengths of
+     * real paths, so they are safe upper bounds even when the search stops early.
+     */
+    void witnessSearch(int source, int skip, int maxDistance, int targets, int limit) {
+        for (int i = 0; i < touchedCount; i++) {
+            witnessDist[touched[i]] = INT_MAX;
+        }
+        touchedCount = 0;
+        queue.clear();
+
+        witnessDist[source] = 0;
+        touched[touchedCount++] = source;
+        queue.push(source, 0);
+
+        int settledCount = 0;
+        while (!queue.isEmpty()) {
+            int current = queue.top();
+            int dist = queue.topPriority();
+            queue.pop();
+            if (dist > maxDistance || ++settledCount > limit)
+                break;
+            if (isTarget[current] && --targets == 0)
+                break;  // every out-neighbour has its final distance
+
+            const EdgeBuffer& edges = out[current];
+            for (int i = 0; i < edges.count; i++) {
+                int next = edges.items[i].toNode;
+                if (next == skip)
+                    continue;
+                int candidate = dist + edges.items[i].weight;
+                if (candidate < witnessDist[next]) {
+                    if (witnessDist[next] == INT_MAX) {
+                        touched[touchedCount++] = next;
+                    }
+                    witnessDist[next] = candidate;
+                    queue.pushOrDecrease(next, candidate);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Counts (and optionally inserts) the shortcuts needed to remove `u`.
+     */
+    int processShortcuts(int u, bool apply) {
+        int maxOut = 0;
+        for (int j = 0; j < out[u].count; j++) {
+            isTarget[out[u].items[j].toNode] = true;
+            if (out[u].items[j].weight > maxOut)
+                maxOut = out[u].items[j].weight;
+        }
+
+        int limit = apply || witnessLimit < ESTIMATE_LIMIT ? witnessLimit : ESTIMATE_LIMIT;
+        int needed = 0;
+        for (int i = 0; i < in[u].count; i++) {
+            int v = in[u].items[i].toNode;
+            int toU = in[u].items[i].weight;
+            witnessSearch(v, u, toU + maxOut, out[u].count, limit);
+
+            for (int j = 0; j < out[u].count; j++) {
+                int x = out[u].items[j].toNode;
+                if (x == v)
+                    continue;
+                int viaU = toU + out[u].items[j].weight;
+                if (witnessDist[x] > viaU) {
+                    needed++;
+                    if (apply && addArc(v, x, viaU)) {
+                        shortcuts++;
+                    }
+                }
+            }
+        }
+
+        for (int j = 0; j < out[u].count; j++) {
+            isTarget[out[u].items[j].toNode] = false;
+        }
+        return needed;
+    }
+
+    /**
+     * @brief Importance of a node: edge difference, contracted neighbours and level.
+     */
+    int priority(int u) {
+        int added = processShortcuts(u, false);
+        int removed = in[u].count + out[u].count;
+        return 2 * (added - removed) + deletedNeighbours[u] + level[u];
+    }
+
+    /**
+     * @brief Removes `u` from the remaining graph and drops its edge lists.
+     */
+    void detach(int u) {
+        for (int i = 0; i < out[u].count; i++) {
+            int x = out[u].items[i].toNode;
+            in[x].remove(u);
+            deletedNeighbours[x]++;
+            if (level[x] < level[u] + 1)
+                level[x] = level[u] + 1;
+        }
+        for (int i = 0; i < in[u].count; i++) {
+            int v = in[u].items[i].toNode;
+            out[v].remove(u);
+            deletedNeighbours[v]++;
+            if (level[v] < level[u] + 1)
+                level[v] = level[u] + 1;
+        }
+        out[u].release();
+        in[u].release();
+    }
+};
+
+/**
+ * @brief Packs per-node edge buffers into CSR arrays.
+ */
+void pack(const EdgeBuffer* lists, int nodeCount, int*& offsets, Edge*& edges, int& edgeCount) {
+    offsets = new int[nodeCount + 1];
+    offsets[0] = 0;
+    for (int v = 0; v < nodeCount; v++) {
+        offsets[v + 1] = offsets[v] + lists[v].count;
+    }
+    edgeCount = offsets[nodeCount];
+    edges = new Edge[edgeCount > 0 ? edgeCount : 1];
+    for (int v = 0; v < nodeCount; v++) {
+        for (int i = 0; i < lists[v].count; i++) {
+            edges[offsets[v] + i] = lists[v].items[i];
+        }
+    }
+}
+
+const unsigned int FILE_MAGIC = 0x43484731;  // "CHG1"
+
+}  // namespace
+
+// Default constructor
+ContractionHierarchy::ContractionHierarchy()
+    : nodeCount(0),
+      rank(nullptr),
+      upOffsets(nullptr),
+      upEdges(nullptr),
+      downOffsets(nullptr),
+      downEdges(nullptr),
+      upCount(0),
+      downCount(0),
+      shortcutCount(0),
+      buildMillis(0.0) {}
+
+// Destructor
+ContractionHierarchy::~ContractionHierarchy() {
+    release();
+}
+
+// Copy constructor
+ContractionHierarchy::ContractionHierarchy(const ContractionHierarchy& other)
+    : nodeCount(0),
+      rank(nullptr),
+      upOffsets(nullptr),
+      upEdges(nullptr),
+      downOffsets(nullptr),
+      downEdges(nullptr),
+      upCount(0),
+      downCount(0),
+      shortcutCount(0),
+      buildMillis(0.0) {
+    copyFrom(other);
+}
+
+// Assignment operator
+ContractionHierarchy& ContractionHierarchy::operator=(const ContractionHierarchy& other) {
+    if (this != &other) {
+        release();
+        copyFrom(other);
+    }
+    return *this;
+}
+
+void ContractionHierarchy::release() {
+    delete[] rank;
+    delete[] upOffsets;
+    delete[] upEdges;
+    delete[] downOffsets;
+    delete[] downEdges;
+    rank = nullptr;
+    upOffsets = nullptr;
+    upEdges = nullptr;
+    downOffsets = nullptr;
+    downEdges = nullptr;
+    nodeCount = 0;
+    upCount = 0;
+    downCount = 0;
+    shortcutCount = 0;
+    buildMillis = 0.0;
+}
+
+void ContractionHierarchy::copyFrom(const ContractionHierarchy& other) {
+    shortcutCount = other.shortcutCount;
+    buildMillis = other.buildMillis;
+    if (other.rank == nullptr) {
+        return;
+    }
+
+    nodeCount = other.nodeCount;
+    upCount = other.upCount;
+    downCount = other.downCount;
+    rank = new int[nodeCount];
+    upOffsets = new int[nodeCount + 1];
+    downOffsets = new int[nodeCount + 1];
+    upEdges = new Edge[upCount > 0 ? upCount : 1];
+    downEdges = new Edge[downCount > 0 ? downCount : 1];
+
+    for (int v = 0; v < nodeCount; v++) {
+        rank[v] = other.rank[v];
+    }
+    for (int v = 0; v <= nodeCount; v++) {
+        upOffsets[v] = other.upOffsets[v];
+        downOffsets[v] = other.downOffsets[v];
+    }
+    for (int i = 0; i < upCount; i++) {
+        upEdges[i] = other.upEdges[i];
+    }
+    for (int i = 0; i < downCount; i++) {
+        downEdges[i] = other.downEdges[i];
+    }
+}
+
+// Contraction with lazy priority updates: a popped node is re-evaluated and pushed
+// back if it is no longer the least important one. Neighbours are not re-evaluated
+// eagerly; on grid cities that made preprocessing ~5x slower for the same shortcuts.
+void ContractionHierarchy::build(const CsrGraph& graph, int witnessLimit) {
+    release();
+    auto start = std::chrono::steady_clock::now();
+
+    int n = graph.getNodeCount();
+    if (n <= 0) {
+        return;
+    }
+
+    Contractor contractor(graph, witnessLimit);
+    EdgeBuffer* up = new EdgeBuffer[n];
+    EdgeBuffer* down = new EdgeBuffer[n];
+    int* order = new int[n];
+
+    IndexedPriorityQueue<int> pending(n);
+    for (int v = 0; v < n; v++) {
+        pending.push(v, contractor.priority(v));
+    }
+
+    int contracted = 0;
+    while (!pending.isEmpty()) {
+        int u = pending.top();
+        int updated = contractor.priority(u);
+        if (updated > pending.topPriority()) {
+            pending.changeKey(u, updated);
+            if (pending.top() != u)
+                continue;  // someone else is cheaper now
+        }
+        pending.pop();
+
+        contractor.processShortcuts(u, true);
+
+        // Whatever still touches u is higher in the hierarchy
+        const EdgeBuffer& outgoing = contractor.outgoing(u);
+        const EdgeBuffer& incoming = contractor.incoming(u);
+        for (int i = 0; i < outgoing.count; i++) {
+            up[u].add(outgoing.items[i].toNode, outgoing.items[i].weight);
+        }
+        for (int i = 0; i < incoming.count; i++) {
+            down[u].add(incoming.items[i].toNode, incoming.items[i].weight);
+        }
+
+        contractor.detach(u);
+        order[u] = contracted++;
+
+    }
+
+    nodeCount = n;
+    rank = order;
+    shortcutCount = contractor.shortcuts;
+    pack(up, n, upOffsets, upEdges, upCount);
+    pack(down, n, downOffsets, downEdges, downCount);
+
+    delete[] up;
+    delete[] down;
+
+    auto end = std::chrono::steady_clock::now();
+    buildMillis = std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void ContractionHierarchy::build(const Graph& graph, int witnessLimit) {
+    CsrGraph network(graph);
+    build(network, witnessLimit);
+}
+
+// Layout: magic, nodeCount, upCount, downCount, shortcutCount, then the raw arrays
+bool ContractionHierarchy::save(const char* path) const {
+    if (rank == nullptr) {
+        return false;
+    }
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    int header[] = {static_cast<int>(FILE_MAGIC), nodeCount, upCount, downCount, shortcutCount};
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(rank), sizeof(int) * nodeCount);
+    file.write(reinterpret_cast<const char*>(upOffsets), sizeof(int) * (nodeCount + 1));
+    file.write(reinterpret_cast<const char*>(upEdges), sizeof(Edge) * upCount);
+    file.write(reinterpret_cast<const char*>(downOffsets), sizeof(int) * (nodeCount + 1));
+    file.write(reinterpret_cast<const char*>(downEdges), sizeof(Edge) * downCount);
+    return static_cast<bool>(file);
+}
+
+bool ContractionHierarchy::load(const char* path) {
+    release();
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    int header[5];
+    file.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (!file || header[0] != static_cast<int>(FILE_MAGIC) || header[1] <= 0 || header[2] < 0 ||
+        header[3] < 0) {
+        return false;
+    }
+
+    nodeCount = header[1];
+    upCount = header[2];
+    downCount = header[3];
+    shortcutCount = header[4];
+    rank = new int[nodeCount];
+    upOffsets = new int[nodeCount + 1];
+    downOffsets = new int[nodeCount + 1];
+    upEdges = new Edge[upCount > 0 ? upCount : 1];
+    downEdges = new Edge[downCount > 0 ? downCount : 1];
+
+    file.read(reinterpret_cast<char*>(rank), sizeof(int) * nodeCount);
+    file.read(reinterpret_cast<char*>(upOffsets), sizeof(int) * (nodeCount + 1));
+    file.read(reinterpret_cast<char*>(upEdges), sizeof(Edge) * upCount);
+    file.read(reinterpret_cast<char*>(downOffsets), sizeof(int) * (nodeCount + 1));
+    file.read(reinterpret_cast<char*>(downEdges), sizeof(Edge) * downCount);
+
+    bool valid = static_cast<bool>(file) && upOffsets[0] == 0 && downOffsets[0] == 0 &&
+                 upOffsets[nodeCount] == upCount && downOffsets[nodeCount] == downCount;
+    for (int i = 0; valid && i < upCount; i++) {
+        valid = upEdges[i].toNode >= 0 && upEdges[i].toNode < nodeCount;
+    }
+    for (int i = 0; valid && i < downCount; i++) {
+        valid = downEdges[i].toNode >= 0 && downEdges[i].toNode < nodeCount;
+    }
+    if (!valid) {
+        release();  // truncated or corrupt file
+    }
+    return valid;
+}
+
+int ContractionHierarchy::distance(int from, int to) const {
+    HierarchyQuery query(*this);
+    return query.distance(from, to);
+}
+
+int ContractionHierarchy::getRank(int node) const {
+    if (node < 0 || node >= nodeCount) {
+        return -1;
+    }
+    return rank[node];
+}
+
+long long ContractionHierarchy::getMemoryUsage() const {
+    if (rank == nullptr) {
+        return 0;
+    }
+    long long bytes = static_cast<long long>(nodeCount) * sizeof(int);  // ranks
+    bytes += 2LL * (nodeCount + 1) * sizeof(int);                        // offsets
+    bytes += static_cast<long long>(upCount + downCount) * sizeof(Edge);
+    return bytes;
+}
+
+// ---------------------------------------------------------------------------
+// HierarchyQuery
+// ---------------------------------------------------------------------------
+
+HierarchyQuery::HierarchyQuery(const ContractionHierarchy& index)
+    : hierarchy(index),
+      nodeCount(index.getNodeCount()),
+      forwardDist(nullptr),
+      backwardDist(nullptr),
+      forwardTouched(nullptr),
+      backwardTouched(nullptr),
+      forwardTouchedCount(0),
+      backwardTouchedCount(0),
+      forwardQueue(index.getNodeCount()),
+      backwardQueue(index.getNodeCount()),
+      settled(0) {
+    if (nodeCount > 0) {
+        forwardDist = new int[nodeCount];
+        backwardDist = new int[nodeCount];
+        forwardTouched = new int[nodeCount];
+        backwardTouched = new int[nodeCount];
+        for (int v = 0; v < nodeCount; v++) {
+            forwardDist[v] = INT_MAX;
+            backwardDist[v] = INT_MAX;
+        }
+    }
+}
+
+HierarchyQuery::~HierarchyQuery() {
+    delete[] forwardDist;
+    delete[] backwardDist;
+    delete[] forwardTouched;
+    delete[] backwardTouched;
+}
+
+// Stall-on-demand: if a higher node already reaches `node` more cheaply through a
+// downward edge, the upward search from `node` cannot lie on a shortest path.
+bool HierarchyQuery::stalledForward(int node) const {
+    const Edge* end = hierarchy.downEnd(node);
+    for (const Edge* e = hierarchy.downBegin(node); e != end; ++e) {
+        int higher = forwardDist[e->toNode];
+        if (higher != INT_MAX && higher + e->weight < forwardDist[node])
+            return true;
+    }
+    return false;
+}
+
+bool HierarchyQuery::stalledBackward(int node) const {
+    const Edge* end = hierarchy.upEnd(node);
+    for (const Edge* e = hierarchy.upBegin(node); e != end; ++e) {
+        int higher = backwardDist[e->toNode];
+        if (higher != INT_MAX && higher + e->weight < backwardDist[node])
+            return true;
+    }
+    return false;
+}
+
+void HierarchyQuery::resetForward() {
+    for (int i = 0; i < forwardTouchedCount; i++) {
+        forwardDist[forwardTouched[i]] = INT_MAX;
+    }
+    forwardTouchedCount = 0;
+    forwardQueue.clear();
+}
+
+void HierarchyQuery::resetBackward() {
+    for (int i = 0; i < backwardTouchedCount; i++) {
+        backwardDist[backwardTouched[i]] = INT_MAX;
+    }
+    backwardTouchedCount = 0;
+    backwardQueue.clear();
+}
+
+// Both searches only climb, so the meeting node with the smallest sum is the answer
+int HierarchyQuery::distance(int from, int to) {
+    resetForward();
+    resetBackward();
+    settled = 0;
+
+    if (from < 0 || from >= nodeCount || to < 0 || to >= nodeCount)
+        return INT_MAX;
+    if (from == to)
+        return 0;
+
+    forwardDist[from] = 0;
+    forwardTouched[forwardTouchedCount++] = from;
+    forwardQueue.push(from, 0);
+    backwardDist[to] = 0;
+    backwardTouched[backwardTouchedCount++] = to;
+    backwardQueue.push(to, 0);
+
+    long long best = INT_MAX;
+    while (!forwardQueue.isEmpty() || !backwardQueue.isEmpty()) {
+        int forwardMin = forwardQueue.isEmpty() ? INT_MAX : forwardQueue.topPriority();
+        int backwardMin = backwardQueue.isEmpty() ? INT_MAX : backwardQueue.topPriority();
+        if ((forwardMin < backwardMin ? forwardMin : backwardMin) >= best)
+            break;  // neither side can still improve the meeting
+
+        bool forward = forwardMin <= backwardMin;
+        IndexedPriorityQueue<int>& queue = forward ? forwardQueue : backwardQueue;
+        int* dist = forward ? forwardDist : backwardDist;
+        int* other = forward ? backwardDist : forwardDist;
+        int* touched = forward ? forwardTouched : backwardTouched;
+        int& touchedCount = forward ? forwardTouchedCount : backwardTouchedCount;
+
+        int current = queue.top();
+        queue.pop();
+        settled++;
+
+        if (other[current] != INT_MAX) {
+            long long meeting = static_cast<long long>(dist[current]) + other[current];
+            if (meeting < best)
+                best = meeting;
+        }
+
+        if (forward ? stalledForward(current) : stalledBackward(current))
+            continue;
+
+        const Edge* begin = forward ? hierarchy.upBegin(current) : hierarchy.downBegin(current);
+        const Edge* end = forward ? hierarchy.upEnd(current) : hierarchy.downEnd(current);
+        for (const Edge* e = begin; e != end; ++e) {
+            int next = e->toNode;
+            int candidate = dist[current] + e->weight;
+            if (candidate < dist[next]) {
+                if (dist[next] == INT_MAX) {
+                    touched[touchedCount++] = next;
+                }
+                dist[next] = candidate;
+                queue.pushOrDecrease(next, candidate);
+            }
+        }
+    }
+
+    return best < INT_MAX ? static_cast<int>(best) : INT_MAX;
+}
+
+void HierarchyQuery::searchUpFrom(int from) {
+    resetForward();
+    forwardDist[from] = 0;
+    forwardTouched[forwardTouchedCount++] = from;
+    forwardQueue.push(from, 0);
+
+    while (!forwardQueue.isEmpty()) {
+        int current = forwardQueue.top();
+        forwardQueue.pop();
+        settled++;
+        if (stalledForward(current))
+            continue;
+
+        const Edge* end = hierarchy.upEnd(current);
+        for (const Edge* e = hierarchy.upBegin(current); e != end; ++e) {
+            int next = e->toNode;
+            int candidate = forwardDist[current] + e->weight;
+            if (candidate < forwardDist[next]) {
+                if (forwardDist[next] == INT_MAX) {
+                    forwardTouched[forwardTouchedCount++] = next;
+                }
+                forwardDist[next] = candidate;
+                forwardQueue.pushOrDecrease(next, candidate);
+            }
+        }
+    }
+}
+
+int HierarchyQuery::searchDownTo(int to) {
+    resetBackward();
+    backwardDist[to] = 0;
+    backwardTouched[backwardTouchedCount++] = to;
+    backwardQueue.push(to, 0);
+
+    long long best = INT_MAX;
+    while (!backwardQueue.isEmpty() && backwardQueue.topPriority() < best) {
+        int current = backwardQueue.top();
+        backwardQueue.pop();
+        settled++;
+
+        if (forwardDist[current] != INT_MAX) {
+            long long meeting = static_cast<long long>(forwardDist[current]) + backwardDist[current];
+            if (meeting < best)
+                best = meeting;
+        }
+        if (stalledBackward(current))
+            continue;
+
+        const Edge* end = hierarchy.downEnd(current);
+        for (const Edge* e = hierarchy.downBegin(current); e != end; ++e) {
+            int next = e->toNode;
+            int candidate = backwardDist[current] + e->weight;
+            if (candidate < backwardDist[next]) {
+                if (backwardDist[next] == INT_MAX) {
+                    backwardTouched[backwardTouchedCount++] = next;
+                }
+                backwardDist[next] = candidate;
+                backwardQueue.pushOrDecrease(next, candidate);
+            }
+        }
+    }
+    return best < INT_MAX ? static_cast<int>(best) : INT_MAX;
+}
+
+void HierarchyQuery::distances(int from, const int* targets, int targetCount, int* distances) {
+    settled = 0;
+    for (int i = 0; i < targetCount; i++) {
+        distances[i] = INT_MAX;
+    }
+    if (from < 0 || from >= nodeCount || targetCount <= 0)
+        return;
+
+    searchUpFrom(from);
+    for (int i = 0; i < targetCount; i++) {
+        int t = targets[i];
+        if (t >= 0 && t < nodeCount) {
+            distances[i] = searchDownTo(t);
+        }
+    }
+}
+
+}  // namespace project
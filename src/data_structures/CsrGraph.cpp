@@ -0,0 +1,269 @@
+/**
+ * @file CsrGraph.cpp
+ * @brief Compressed-sparse-row graph implementation.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "data_structures/CsrGraph.h"
+
+namespace project {
+
+// Default constructor
+CsrGraph::CsrGraph()
+    : nodeCount(0),
+      edgeCount(0),
+      offsets(nullptr),
+      edges(nullptr),
+      xs(nullptr),
+      ys(nullptr),
+      distanceScale(0.0) {}
+
+// Build from adjacency-list graph
+CsrGraph::CsrGraph(const Graph& graph)
+    : nodeCount(0),
+      edgeCount(0),
+      offsets(nullptr),
+      edges(nullptr),
+      xs(nullptr),
+      ys(nullptr),
+      distanceScale(0.0) {
+    build(graph);
+}
+
+// Destructor
+CsrGraph::~CsrGraph() {
+    release();
+}
+
+// Copy constructor
+CsrGraph::CsrGraph(const CsrGraph& other)
+    : nodeCount(0),
+      edgeCount(0),
+      offsets(nullptr),
+      edges(nullptr),
+      xs(nullptr),
+      ys(nullptr),
+      distanceScale(0.0) {
+    copyFrom(other);
+}
+
+// Assignment operator
+CsrGraph& CsrGraph::operator=(const CsrGraph& other) {
+    if (this != &other) {
+        release();
+        copyFrom(other);
+    }
+    return *this;
+}
+
+void CsrGraph::release() {
+    delete[] offsets;
+    delete[] edges;
+    delete[] xs;
+    delete[] ys;
+    offsets = nullptr;
+    edges = nullptr;
+    xs = nullptr;
+    ys = nullptr;
+    distanceScale = 0.0;
+    nodeCount = 0;
+    edgeCount = 0;
+}
+
+void CsrGraph::copyFrom(const CsrGraph& other) {
+    nodeCount = other.nodeCount;
+    edgeCount = other.edgeCount;
+    distanceScale = other.distanceScale;
+
+    if (other.xs != nullptr) {
+        xs = new int[nodeCount];
+        ys = new int[nodeCount];
+        for (int i = 0; i < nodeCount; i++) {
+            xs[i] = other.xs[i];
+            ys[i] = other.ys[i];
+        }
+    }
+
+    if (other.offsets == nullptr) {
+        return;
+    }
+
+    offsets = new int[nodeCount + 1];
+    for (int i = 0; i <= nodeCount; i++) {
+        offsets[i] = other.offsets[i];
+    }
+
+    edges = new Edge[edgeCount];
+    for (int i = 0; i < edgeCount; i++) {
+        edges[i] = other.edges[i];
+    }
+}
+
+// Two passes over the adjacency lists: count degrees, then pack edges.
+// Edges pointing outside the node range are dropped so searches never index past the arrays.
+void CsrGraph::build(const Graph& graph) {
+    pack(graph, &Graph::getAdjList);
+}
+
+// Packs the graph's incoming-edge lists; falls back to transposing when they are not kept
+void CsrGraph::buildReverse(const Graph& graph) {
+    if (!graph.hasReverseIndex()) {
+        build(graph);
+        *this = transposed();
+        return;
+    }
+    pack(graph, &Graph::getReverseAdjList);
+}
+
+void CsrGraph::pack(const Graph& graph, AdjacencyGetter lists) {
+    release();
+
+    nodeCount = graph.getNodeCount();
+    if (nodeCount <= 0) {
+        nodeCount = 0;
+        return;
+    }
+
+    offsets = new int[nodeCount + 1];
+    offsets[0] = 0;
+    for (int v = 0; v < nodeCount; v++) {
+        int degree = 0;
+        const LinkedList<Edge>& adj = (graph.*lists)(v);
+        for (auto it = adj.begin(); it != adj.end(); ++it) {
+            if ((*it).toNode >= 0 && (*it).toNode < nodeCount) {
+                degree++;
+            }
+        }
+        offsets[v + 1] = offsets[v] + degree;  // prefix sum of degrees
+    }
+
+    edgeCount = offsets[nodeCount];
+    edges = new Edge[edgeCount];
+
+    for (int v = 0; v < nodeCount; v++) {
+        int k = offsets[v];
+        const LinkedList<Edge>& adj = (graph.*lists)(v);
+        for (auto it = adj.begin(); it != adj.end(); ++it) {
+            if ((*it).toNode >= 0 && (*it).toNode < nodeCount) {
+                edges[k++] = *it;
+            }
+        }
+    }
+
+    buildPositions(graph);
+}
+
+// The scale is the minimum weight / length ratio over all edges, which makes the scaled
+// straight-line distance a consistent heuristic even when roads are not straight.
+void CsrGraph::buildPositions(const Graph& graph) {
+    for (int v = 0; v < nodeCount; v++) {
+        if (!graph.hasNodePosition(v)) {
+            return;  // partial coordinates would make the bound inconsistent
+        }
+    }
+
+    xs = new int[nodeCount];
+    ys = new int[nodeCount];
+    for (int v = 0; v < nodeCount; v++) {
+        xs[v] = graph.getNodeX(v);
+        ys[v] = graph.getNodeY(v);
+    }
+
+    double scale = -1.0;
+    for (int u = 0; u < nodeCount; u++) {
+        for (int i = offsets[u]; i < offsets[u + 1]; i++) {
+            double dx = static_cast<double>(xs[u]) - xs[edges[i].toNode];
+            double dy = static_cast<double>(ys[u]) - ys[edges[i].toNode];
+            double length = std::sqrt(dx * dx + dy * dy);
+            if (length <= 0.0) {
+                continue;  // co-located nodes put no constraint on the scale
+            }
+            double ratio = edges[i].weight / length;
+            if (scale < 0.0 || ratio < scale) {
+                scale = ratio;
+            }
+        }
+    }
+    // Shave off a little so floating-point rounding can never push a bound above an edge weight
+    distanceScale = scale > 0.0 ? scale * (1.0 - 1e-9) : 0.0;
+}
+
+// Counting sort of the edges by their head node
+CsrGraph CsrGraph::transposed() const {
+    CsrGraph reverse;
+    reverse.nodeCount = nodeCount;
+    reverse.edgeCount = edgeCount;
+    reverse.distanceScale = distanceScale;
+    if (xs != nullptr) {
+        reverse.xs = new int[nodeCount];
+        reverse.ys = new int[nodeCount];
+        for (int v = 0; v < nodeCount; v++) {
+            reverse.xs[v] = xs[v];
+            reverse.ys[v] = ys[v];
+        }
+    }
+    if (offsets == nullptr) {
+        return reverse;
+    }
+
+    reverse.offsets = new int[nodeCount + 1];
+    for (int v = 0; v <= nodeCount; v++) {
+        reverse.offsets[v] = 0;
+    }
+    for (int i = 0; i < edgeCount; i++) {
+        reverse.offsets[edges[i].toNode + 1]++;  // in-degree
+    }
+    for (int v = 0; v < nodeCount; v++) {
+        reverse.offsets[v + 1] += reverse.offsets[v];
+    }
+
+    int* fill = new int[nodeCount];
+    for (int v = 0; v < nodeCount; v++) {
+        fill[v] = reverse.offsets[v];
+    }
+
+    reverse.edges = new Edge[edgeCount];
+    for (int u = 0; u < nodeCount; u++) {
+        for (int i = offsets[u]; i < offsets[u + 1]; i++) {
+            int v = edges[i].toNode;
+            reverse.edges[fill[v]++] = Edge(u, edges[i].weight);
+        }
+    }
+
+    delete[] fill;
+    return reverse;
+}
+
+double CsrGraph::getDistanceScale() const {
+    return distanceScale;
+}
+
+int CsrGraph::getDegree(int node) const {
+    if (node < 0 || node >= nodeCount) {
+        return 0;
+    }
+    return offsets[node + 1] - offsets[node];
+}
+
+int CsrGraph::getNodeCount() const {
+    return nodeCount;
+}
+
+int CsrGraph::getEdgeCount() const {
+    return edgeCount;
+}
+
+long long CsrGraph::getMemoryUsage() const {
+    long long bytes = 0;
+    if (offsets != nullptr) {
+        bytes += static_cast<long long>(nodeCount + 1) * sizeof(int);
+    }
+    bytes += static_cast<long long>(edgeCount) * sizeof(Edge);
+    if (xs != nullptr) {
+        bytes += 2LL * nodeCount * sizeof(int);
+    }
+    return bytes;
+}
+
+}  // namespace project
@@ -10,15 +10,17 @@
 namespace project {
 
 // Default constructor
-Graph::Graph() : head(nullptr), nodeCount(0) {}
+Graph::Graph() : head(nullptr), nodeIndex(nullptr), nodeCount(0), reverseIndexed(false) {}
 
 // Constructor with node count
-Graph::Graph(int count) : head(nullptr), nodeCount(count) {
+Graph::Graph(int count)
+    : head(nullptr), nodeIndex(nullptr), nodeCount(count), reverseIndexed(false) {
     for (int i = count - 1; i >= 0; i--) {  // create nodes in reverse order
         GraphNode* newNode = new GraphNode(i);
         newNode->next = head;  // insert at front
         head = newNode;
     }
+    buildIndex();
 }
 
 // Destructor
@@ -29,10 +31,15 @@ Graph::~Graph() {
         current = current->next;
         delete temp;  // free each node
     }
+    delete[] nodeIndex;
 }
 
 // Copy constructor
-Graph::Graph(const Graph& other) : head(nullptr), nodeCount(other.nodeCount) {
+Graph::Graph(const Graph& other)
+    : head(nullptr),
+      nodeIndex(nullptr),
+      nodeCount(other.nodeCount),
+      reverseIndexed(other.reverseIndexed) {
     if (other.head == nullptr) {
         return;
     }
@@ -43,6 +50,10 @@ Graph::Graph(const Graph& other) : head(nullptr), nodeCount(other.nodeCount) {
     while (otherCurrent != nullptr) {
         GraphNode* newNode = new GraphNode(otherCurrent->nodeId);
         newNode->edges = otherCurrent->edges;  // copy adjacency list
+        newNode->reverseEdges = otherCurrent->reverseEdges;
+        newNode->x = otherCurrent->x;
+        newNode->y = otherCurrent->y;
+        newNode->hasPosition = otherCurrent->hasPosition;
 
         if (prevNode == nullptr) {
             head = newNode;  // first node
@@ -53,6 +64,8 @@ Graph::Graph(const Graph& other) : head(nullptr), nodeCount(other.nodeCount) {
         prevNode = newNode;
         otherCurrent = otherCurrent->next;
     }
+
+    buildIndex();
 }
 
 // Assignment operator
@@ -68,8 +81,11 @@ Graph& Graph::operator=(const Graph& other) {
         delete temp;
     }
 
+    delete[] nodeIndex;
     head = nullptr;
+    nodeIndex = nullptr;
     nodeCount = other.nodeCount;
+    reverseIndexed = other.reverseIndexed;
 
     if (other.head == nullptr) {
         return *this;
@@ -81,6 +97,10 @@ Graph& Graph::operator=(const Graph& other) {
     while (otherCurrent != nullptr) {
         GraphNode* newNode = new GraphNode(otherCurrent->nodeId);
         newNode->edges = otherCurrent->edges;  // copy adjacency list
+        newNode->reverseEdges = otherCurrent->reverseEdges;
+        newNode->x = otherCurrent->x;
+        newNode->y = otherCurrent->y;
+        newNode->hasPosition = otherCurrent->hasPosition;
 
         if (prevNode == nullptr) {
             head = newNode;  // first node
@@ -92,19 +112,39 @@ Graph& Graph::operator=(const Graph& other) {
         otherCurrent = otherCurrent->next;
     }
 
+    buildIndex();
     return *this;
 }
 
-// Finds a node by its ID
-GraphNode* Graph::findNode(int nodeId) const {
+// Rebuilds the direct lookup table from the node list
+void Graph::buildIndex() {
+    delete[] nodeIndex;
+    nodeIndex = nullptr;
+
+    if (nodeCount <= 0) {
+        return;
+    }
+
+    nodeIndex = new GraphNode*[nodeCount];
+    for (int i = 0; i < nodeCount; i++) {
+        nodeIndex[i] = nullptr;
+    }
+
     GraphNode* current = head;
     while (current != nullptr) {
-        if (current->nodeId == nodeId) {
-            return current;  // node found
+        if (current->nodeId >= 0 && current->nodeId < nodeCount) {
+            nodeIndex[current->nodeId] = current;
         }
         current = current->next;
     }
-    return nullptr;  // not found
+}
+
+// Finds a node by its ID
+GraphNode* Graph::findNode(int nodeId) const {
+    if (nodeIndex == nullptr || nodeId < 0 || nodeId >= nodeCount) {
+        return nullptr;  // not found
+    }
+    return nodeIndex[nodeId];
 }
 
 // Adds a weighted edge between two nodes
@@ -113,6 +153,11 @@ void Graph::addEdge(int from, int to, int weight) {
     if (fromNode != nullptr) {
         Edge edge(to, weight);
         fromNode->edges.pushBack(edge);  // add edge to adjacency list
+
+        GraphNode* toNode = reverseIndexed ? findNode(to) : nullptr;
+        if (toNode != nullptr) {
+            toNode->reverseEdges.pushBack(Edge(from, weight));  // incoming side
+        }
     }
 }
 
@@ -144,6 +189,65 @@ const LinkedList<Edge>& Graph::getAdjList(int node) const {
     return emptyList;
 }
 
+// Builds the incoming-edge lists from the current adjacency lists
+void Graph::enableReverseIndex() {
+    if (reverseIndexed) {
+        return;
+    }
+
+    GraphNode* current = head;
+    while (current != nullptr) {
+        for (auto it = current->edges.begin(); it != current->edges.end(); ++it) {
+            GraphNode* target = findNode((*it).toNode);
+            if (target != nullptr) {
+                target->reverseEdges.pushBack(Edge(current->nodeId, (*it).weight));
+            }
+        }
+        current = current->next;
+    }
+    reverseIndexed = true;
+}
+
+bool Graph::hasReverseIndex() const {
+    return reverseIndexed;
+}
+
+// Returns the incoming edges of a node
+const LinkedList<Edge>& Graph::getReverseAdjList(int node) const {
+    GraphNode* graphNode = findNode(node);
+    if (graphNode != nullptr) {
+        return graphNode->reverseEdges;
+    }
+
+    static const LinkedList<Edge> emptyList;  // fallback
+    return emptyList;
+}
+
+// Sets the coordinates of a node
+void Graph::setNodePosition(int node, int x, int y) {
+    GraphNode* graphNode = findNode(node);
+    if (graphNode != nullptr) {
+        graphNode->x = x;
+        graphNode->y = y;
+        graphNode->hasPosition = true;
+    }
+}
+
+bool Graph::hasNodePosition(int node) const {
+    GraphNode* graphNode = findNode(node);
+    return graphNode != nullptr && graphNode->hasPosition;
+}
+
+int Graph::getNodeX(int node) const {
+    GraphNode* graphNode = findNode(node);
+    return graphNode != nullptr ? graphNode->x : 0;
+}
+
+int Graph::getNodeY(int node) const {
+    GraphNode* graphNode = findNode(node);
+    return graphNode != nullptr ? graphNode->y : 0;
+}
+
 // Returns the total number of nodes
 int Graph::getNodeCount() const {
     return nodeCount;
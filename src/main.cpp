@@ -8,6 +8,7 @@
 #include "UIManager.h"
 #include "core/Facilities.h"
 #include "core/Simulation.h"
+#include "data_structures/ContractionHierarchy.h"
 #include "utils/JsonParser.h"
 
 #include <iostream>
@@ -24,23 +25,60 @@ void printUsage(const char* programName) {
     std::cout << "\nOptions:\n";
     std::cout << "  --no-ui          Run without interactive UI (text output only)\n";
     std::cout << "  --days N         Set simulation duration (default: 7)\n";
+    std::cout << "  --planner NAME   Route planner: greedy (default), savings or split\n";
+    std::cout << "  --lns MS         Improve each day's route with LNS for MS milliseconds\n";
+    std::cout << "  --starts N       Keep the best of N randomized greedy routes (parallel)\n";
+    std::cout << "  --horizon DAYS   Defer bins that can wait; take those due within DAYS\n";
+    std::cout << "                   early when they are on the way\n";
+    std::cout << "  --forecast NAME  Overflow forecast: history (default), smoothing or\n";
+    std::cout << "                   holt-winters\n";
+    std::cout << "  --critical-index Find critical bins in a heap of predicted overflow days\n";
+    std::cout << "                   instead of predicting every bin each day\n";
+    std::cout << "  --hierarchy FILE Answer graph searches with a contraction hierarchy loaded\n";
+    std::cout << "                   from FILE (built and saved there if missing)\n";
     std::cout << "  --help           Show this help message\n";
     std::cout << "\nExamples:\n";
     std::cout << "  " << programName << " data/data.json\n";
     std::cout << "  " << programName << " data/test_overflow.json --no-ui\n";
     std::cout << "  " << programName << " data/test_minimal.json --days 3\n";
+    std::cout << "  " << programName << " data/data.json --no-ui --planner savings\n";
+    std::cout << "  " << programName << " data/test_capacity.json --no-ui --planner split\n";
+    std::cout << "  " << programName << " data/data.json --no-ui --lns 200\n";
+    std::cout << "  " << programName << " data/data.json --no-ui --starts 32\n";
+    std::cout << "  " << programName << " data/data.json --no-ui --days 30 --horizon 7\n";
+    std::cout << "  " << programName
+              << " data/data.json --no-ui --days 28 --forecast holt-winters\n";
+    std::cout << "  " << programName << " data/data.json --no-ui --hierarchy data/data.ch\n";
     std::cout << "\nAvailable data files:\n";
     std::cout << "  data/data.json              - Main dataset\n";
     std::cout << "  data/test_minimal.json      - Minimal test case\n";
     std::cout << "  data/test_overflow.json     - Overflow scenario\n";
     std::cout << "  data/test_capacity.json     - Capacity stress test\n";
     std::cout << "  data/test_empty.json        - Empty bins edge case\n";
+    std::cout << "  data/test_fleet.json        - Fleet of three trucks\n";
+}
+
+/**
+ * @brief Loads the offline contraction hierarchy, or builds and saves it on first use
+ * @return true if the index matches the graph
+ */
+bool prepareHierarchy(ContractionHierarchy& hierarchy, const Graph& graph,
+                      const std::string& path) {
+    if (hierarchy.load(path.c_str()) && hierarchy.getNodeCount() == graph.getNodeCount())
+        return true;
+
+    hierarchy.build(graph);
+    if (!hierarchy.save(path.c_str()))
+        std::cerr << "Warning: Could not save hierarchy to " << path << "\n";
+    return hierarchy.isBuilt();
 }
 
 /**
  * @brief Runs simulation without UI (text output only)
  */
-void runTextMode(const char* dataFile, int days) {
+void runTextMode(const char* dataFile, int days, RoutePlanner::PlanningEngine engine,
+                 double lnsMs, int starts, int horizonDays, const std::string& forecast,
+                 bool indexed, const std::string& hierarchyFile) {
     std::cout << "=== Garbage Collection Optimization System ===\n";
     std::cout << "Loading data from: " << dataFile << "\n\n";
 
@@ -50,7 +88,8 @@ void runTextMode(const char* dataFile, int days) {
     int binCount = 0, facilityCount = 0;
     Bin* bins = parser.loadBins(binCount);
     Facility* facilities = parser.loadFacilities(facilityCount);
-    Truck truck = parser.loadTruck();
+    int truckCount = 0;
+    Truck* trucks = parser.loadTrucks(truckCount);
     Graph graph = parser.loadGraph();
 
     if (binCount == 0 && facilityCount == 0) {
@@ -67,18 +106,68 @@ void runTextMode(const char* dataFile, int days) {
     for (int i = 0; i < facilityCount; i++) {
         facilityMgr.addFacility(facilities[i]);
     }
-    facilityMgr.setTruck(truck);
+    for (int i = 0; i < truckCount; i++) {
+        if (i == 0)
+            facilityMgr.setTruck(trucks[i]);
+        else
+            facilityMgr.addTruck(trucks[i]);
+    }
 
     std::cout << "System Configuration:\n";
     std::cout << "  Bins:       " << binCount << "\n";
     std::cout << "  Facilities: " << facilityCount << "\n";
-    std::cout << "  Truck:      " << truck.getId() << " (capacity: " << truck.getCapacity()
-              << ")\n";
+    Truck& truck = facilityMgr.getTruck();
+    if (facilityMgr.getTruckCount() > 1) {
+        std::cout << "  Trucks:     " << facilityMgr.getTruckCount() << " (first: " << truck.getId()
+                  << ", capacity: " << truck.getCapacity() << ")\n";
+    } else {
+        std::cout << "  Truck:      " << truck.getId() << " (capacity: " << truck.getCapacity()
+                  << ")\n";
+    }
     std::cout << "  Duration:   " << days << " days\n";
+    std::cout << "  Planner:    "
+              << (engine == RoutePlanner::PlanningEngine::Savings     ? "savings"
+                  : engine == RoutePlanner::PlanningEngine::GiantTour ? "giant tour + split"
+                                                                       : "greedy");
+    if (starts > 1 && engine == RoutePlanner::PlanningEngine::Greedy) {
+        std::cout << " (best of " << starts << " starts)";
+    }
+    if (lnsMs > 0) {
+        std::cout << " + LNS " << lnsMs << " ms/day";
+    }
+    if (horizonDays >= 0) {
+        std::cout << ", deferring bins (horizon " << horizonDays << " days)";
+    }
+    if (forecast == "holt-winters") {
+        std::cout << ", Holt-Winters overflow forecast";
+    } else if (forecast == "smoothing") {
+        std::cout << ", smoothed overflow forecast";
+    }
+    if (indexed) {
+        std::cout << ", critical-bin index";
+    }
+    if (!hierarchyFile.empty()) {
+        std::cout << ", hierarchy " << hierarchyFile;
+    }
+    std::cout << "\n";
     std::cout << "\nRunning simulation...\n\n";
 
+    ContractionHierarchy hierarchy;  // sim'den uzun yaşamalı
     // Run simulation
     Simulation sim(graph, facilityMgr, days);
+    sim.setPlanningEngine(engine);
+    sim.getLnsPlanner().setTimeBudget(lnsMs);
+    sim.getMultiStartPlanner().setStarts(starts);
+    if (horizonDays >= 0) {
+        sim.getHorizonPlanner().setEnabled(true);
+        sim.getHorizonPlanner().setHorizonDays(horizonDays);
+    }
+    sim.getForecaster().setEnabled(forecast == "holt-winters");
+    sim.getSmoothingForecaster().setEnabled(forecast == "smoothing");
+    sim.getCriticalIndex().setEnabled(indexed);
+    if (!hierarchyFile.empty() && prepareHierarchy(hierarchy, graph, hierarchyFile)) {
+        sim.setHierarchy(&hierarchy);
+    }
     sim.run();
 
     // Print results
@@ -88,19 +177,23 @@ void runTextMode(const char* dataFile, int days) {
     // Cleanup
     delete[] bins;
     delete[] facilities;
+    delete[] trucks;
 }
 
 /**
  * @brief Runs simulation with interactive TUI
  */
-void runUIMode(const char* dataFile, int days) {
+void runUIMode(const char* dataFile, int days, RoutePlanner::PlanningEngine engine,
+               double lnsMs, int starts, int horizonDays, const std::string& forecast,
+               bool indexed, const std::string& hierarchyFile) {
     // Parse JSON data
     JsonParser parser(dataFile);
 
     int binCount = 0, facilityCount = 0;
     Bin* bins = parser.loadBins(binCount);
     Facility* facilities = parser.loadFacilities(facilityCount);
-    Truck truck = parser.loadTruck();
+    int truckCount = 0;
+    Truck* trucks = parser.loadTrucks(truckCount);
     Graph graph = parser.loadGraph();
 
     if (binCount == 0 && facilityCount == 0) {
@@ -117,10 +210,29 @@ void runUIMode(const char* dataFile, int days) {
     for (int i = 0; i < facilityCount; i++) {
         facilityMgr.addFacility(facilities[i]);
     }
-    facilityMgr.setTruck(truck);
+    for (int i = 0; i < truckCount; i++) {
+        if (i == 0)
+            facilityMgr.setTruck(trucks[i]);
+        else
+            facilityMgr.addTruck(trucks[i]);
+    }
 
+    ContractionHierarchy hierarchy;  // sim'den uzun yaşamalı
     // Create simulation
     Simulation sim(graph, facilityMgr, days);
+    sim.setPlanningEngine(engine);
+    sim.getLnsPlanner().setTimeBudget(lnsMs);
+    sim.getMultiStartPlanner().setStarts(starts);
+    if (horizonDays >= 0) {
+        sim.getHorizonPlanner().setEnabled(true);
+        sim.getHorizonPlanner().setHorizonDays(horizonDays);
+    }
+    sim.getForecaster().setEnabled(forecast == "holt-winters");
+    sim.getSmoothingForecaster().setEnabled(forecast == "smoothing");
+    sim.getCriticalIndex().setEnabled(indexed);
+    if (!hierarchyFile.empty() && prepareHierarchy(hierarchy, graph, hierarchyFile)) {
+        sim.setHierarchy(&hierarchy);
+    }
 
     // Run with UI
     UIManager ui(sim);
@@ -135,6 +247,7 @@ void runUIMode(const char* dataFile, int days) {
     // Cleanup
     delete[] bins;
     delete[] facilities;
+    delete[] trucks;
 }
 
 /**
@@ -150,6 +263,13 @@ int main(int argc, char* argv[]) {
     const char* dataFile = argv[1];
     bool useUI = true;
     int days = 7;  // Default simulation duration
+    RoutePlanner::PlanningEngine engine = RoutePlanner::PlanningEngine::Greedy;
+    double lnsMs = 0.0;     // LNS off by default
+    int starts = 1;         // single greedy construction by default
+    int horizonDays = -1;   // every non-empty bin is planned by default
+    std::string forecast = "history";  // overflow predicted from the fill history by default
+    bool indexed = false;              // critical bins found by a daily scan by default
+    std::string hierarchyFile;         // graph searches run Dijkstra by default
 
     // Process options
     for (int i = 2; i < argc; i++) {
@@ -171,6 +291,79 @@ int main(int argc, char* argv[]) {
                 std::cerr << "Error: --days requires an argument\n";
                 return 1;
             }
+        } else if (arg == "--planner") {
+            if (i + 1 < argc) {
+                std::string name = argv[++i];
+                if (name == "greedy") {
+                    engine = RoutePlanner::PlanningEngine::Greedy;
+                } else if (name == "savings") {
+                    engine = RoutePlanner::PlanningEngine::Savings;
+                } else if (name == "split") {
+                    engine = RoutePlanner::PlanningEngine::GiantTour;
+                } else {
+                    std::cerr << "Error: Unknown planner '" << name
+                              << "' (expected greedy, savings or split)\n";
+                    return 1;
+                }
+            } else {
+                std::cerr << "Error: --planner requires an argument\n";
+                return 1;
+            }
+        } else if (arg == "--lns") {
+            if (i + 1 < argc) {
+                lnsMs = std::stod(argv[++i]);
+                if (lnsMs < 0) {
+                    std::cerr << "Error: LNS time budget must not be negative\n";
+                    return 1;
+                }
+            } else {
+                std::cerr << "Error: --lns requires an argument\n";
+                return 1;
+            }
+        } else if (arg == "--starts") {
+            if (i + 1 < argc) {
+                starts = std::stoi(argv[++i]);
+                if (starts <= 0) {
+                    std::cerr << "Error: Starts must be positive\n";
+                    return 1;
+                }
+            } else {
+                std::cerr << "Error: --starts requires an argument\n";
+                return 1;
+            }
+        } else if (arg == "--horizon") {
+            if (i + 1 < argc) {
+                horizonDays = std::stoi(argv[++i]);
+                if (horizonDays < 0) {
+                    std::cerr << "Error: Horizon must not be negative\n";
+                    return 1;
+                }
+            } else {
+                std::cerr << "Error: --horizon requires an argument\n";
+                return 1;
+            }
+        } else if (arg == "--critical-index") {
+            indexed = true;
+        } else if (arg == "--hierarchy") {
+            if (i + 1 < argc) {
+                hierarchyFile = argv[++i];
+            } else {
+                std::cerr << "Error: --hierarchy requires an argument\n";
+                return 1;
+            }
+        } else if (arg == "--forecast") {
+            if (i + 1 < argc) {
+                forecast = argv[++i];
+                if (forecast != "history" && forecast != "smoothing" &&
+                    forecast != "holt-winters") {
+                    std::cerr << "Error: Unknown forecast '" << forecast
+                              << "' (expected history, smoothing or holt-winters)\n";
+                    return 1;
+                }
+            } else {
+                std::cerr << "Error: --forecast requires an argument\n";
+                return 1;
+            }
         } else {
             std::cerr << "Warning: Unknown option '" << arg << "'\n";
         }
@@ -179,9 +372,11 @@ int main(int argc, char* argv[]) {
     // Run simulation
     try {
         if (useUI) {
-            runUIMode(dataFile, days);
+            runUIMode(dataFile, days, engine, lnsMs, starts, horizonDays, forecast, indexed,
+                      hierarchyFile);
         } else {
-            runTextMode(dataFile, days);
+            runTextMode(dataFile, days, engine, lnsMs, starts, horizonDays, forecast, indexed,
+                        hierarchyFile);
         }
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << "\n";
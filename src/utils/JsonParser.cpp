@@ -105,11 +105,21 @@ Bin* JsonParser::loadBins(int& count) {
 
 // Load truck
 Truck JsonParser::loadTruck() {
+    int count = 0;
+    Truck* trucks = loadTrucks(count);
+    Truck first = count > 0 ? trucks[0] : Truck();  // Load first truck
+    delete[] trucks;
+    return first;
+}
+
+// Load every truck of the fleet
+Truck* JsonParser::loadTrucks(int& count) {
     try {
         std::ifstream file(dataPath);
         if (!file.is_open()) {
             std::cerr << "Error: Could not open file " << dataPath << std::endl;
-            return Truck();
+            count = 0;
+            return nullptr;
         }
 
         json data = json::parse(file);
@@ -117,28 +127,37 @@ Truck JsonParser::loadTruck() {
 
         if (trucks_json.empty()) {
             std::cerr << "Error: No trucks found in JSON" << std::endl;
-            return Truck();
+            count = 0;
+            return nullptr;
         }
 
-        auto& t = trucks_json[0];  // Load first truck
+        count = static_cast<int>(trucks_json.size());
+        Truck* trucks = new Truck[count];
 
-        std::string id = t["id"];
-        int capacity = t["capacity"];
-        int currentLoad = t["current_load"];
-        std::string position = t["position"];
+        for (int i = 0; i < count; i++) {
+            auto& t = trucks_json[i];
+
+            std::string id = t["id"];
+            int capacity = t["capacity"];
+            int currentLoad = t["current_load"];
+            std::string position = t["position"];
+
+            int startNode = mapper.getNode(position);
+            if (startNode == -1) {
+                std::cerr << "Warning: Truck position '" << position
+                          << "' not found. Defaulting to node 0." << std::endl;
+                startNode = 0;
+            }
 
-        int startNode = mapper.getNode(position);
-        if (startNode == -1) {
-            std::cerr << "Warning: Truck position '" << position
-                      << "' not found. Defaulting to node 0." << std::endl;
-            startNode = 0;
+            trucks[i] = Truck(id, capacity, currentLoad, startNode);
         }
 
-        return Truck(id, capacity, currentLoad, startNode);
+        return trucks;
 
     } catch (json::exception& e) {
-        std::cerr << "JSON parse error in loadTruck: " << e.what() << std::endl;
-        return Truck();
+        std::cerr << "JSON parse error in loadTrucks: " << e.what() << std::endl;
+        count = 0;
+        return nullptr;
     }
 }
 
@@ -186,6 +205,23 @@ Graph JsonParser::loadGraph() {
             graph.addEdge(fromNode, toNode, distance);
         }
 
+        // Optional map coordinates (bins may carry "x"/"y" too); used by A* searches
+        const char* located[] = {"facilities", "bins"};
+        for (const char* section : located) {
+            if (!data.contains(section)) {
+                continue;
+            }
+            for (auto& item : data[section]) {
+                if (!item.contains("x") || !item.contains("y")) {
+                    continue;
+                }
+                int node = mapper.getNode(item["id"].get<std::string>());
+                if (node != -1) {
+                    graph.setNodePosition(node, item["x"], item["y"]);
+                }
+            }
+        }
+
         return graph;
 
     } catch (json::exception& e) {
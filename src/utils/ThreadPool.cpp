@@ -0,0 +1,106 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief Implementation of ThreadPool class.
+ * @author Miray Duygulu, Kerem Akdeniz, İlber Eren Tüt, İrem Irmak Ünlüer, İpek Çelik
+ * @date 2026-10-16
+ */
+
+#include "utils/ThreadPool.h"
+
+namespace project {
+
+ThreadPool::ThreadPool(int threads)
+    : workers(nullptr), threadCount(threads > 0 ? threads : hardwareThreads()), activeTasks(0),
+      stopping(false) {
+    workers = new std::thread[threadCount];
+    for (int i = 0; i < threadCount; i++) {
+        workers[i] = std::thread(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    wait();
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    taskReady.notify_all();
+
+    for (int i = 0; i < threadCount; i++) {
+        workers[i].join();
+    }
+    delete[] workers;
+}
+
+void ThreadPool::workerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            taskReady.wait(guard, [this] { return stopping || !tasks.isEmpty(); });
+            if (tasks.isEmpty()) {
+                return;  // stopping and nothing left to do
+            }
+            task = tasks.front();
+            tasks.popFront();
+        }
+
+        task();
+
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            activeTasks--;
+            if (activeTasks == 0) {
+                allDone.notify_all();
+            }
+        }
+    }
+}
+
+void ThreadPool::submit(const std::function<void()>& task) {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        tasks.pushBack(task);
+        activeTasks++;
+    }
+    taskReady.notify_one();
+}
+
+void ThreadPool::wait() {
+    std::unique_lock<std::mutex> guard(lock);
+    allDone.wait(guard, [this] { return activeTasks == 0; });
+}
+
+void ThreadPool::parallelFor(int begin, int end, const std::function<void(int)>& body) {
+    int total = end - begin;
+    if (total <= 0) {
+        return;
+    }
+
+    int chunks = threadCount * 4;  // a few chunks per worker for load balancing
+    if (chunks > total) {
+        chunks = total;
+    }
+
+    for (int c = 0; c < chunks; c++) {
+        int from = begin + static_cast<int>(static_cast<long long>(total) * c / chunks);
+        int to = begin + static_cast<int>(static_cast<long long>(total) * (c + 1) / chunks);
+        submit([from, to, &body] {
+            for (int i = from; i < to; i++) {
+                body(i);
+            }
+        });
+    }
+    wait();
+}
+
+int ThreadPool::getThreadCount() const {
+    return threadCount;
+}
+
+int ThreadPool::hardwareThreads() {
+    unsigned int count = std::thread::hardware_concurrency();
+    return count > 0 ? static_cast<int>(count) : 1;
+}
+
+}  // namespace project
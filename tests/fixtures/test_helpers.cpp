@@ -42,6 +42,21 @@ Facilities* createTestFacilities() {
     return facilities;
 }
 
+// Helper to lay a grid of streets; edges are added node by node, east then south
+void addGridStreets(Graph& graph, int side, int (*east)(int), int (*south)(int),
+                    bool (*oneWaySouth)(int)) {
+    for (int v = 0; v < side * side; v++) {
+        if (v % side + 1 < side)
+            graph.addBidirectionalEdge(v, v + 1, east(v));
+        if (v + side < side * side) {
+            if (oneWaySouth != nullptr && oneWaySouth(v))
+                graph.addEdge(v, v + side, south(v));
+            else
+                graph.addBidirectionalEdge(v, v + side, south(v));
+        }
+    }
+}
+
 // Cleanup helper
 void cleanup(Graph* graph, Facilities* facilities) {
     if (graph) delete graph;
@@ -27,6 +27,17 @@ Graph* createTestGraph();
  */
 Facilities* createTestFacilities();
 
+/**
+ * @brief Adds the streets of a side x side grid (node v = row * side + column)
+ * @param graph Graph with at least side * side nodes
+ * @param side Grid side length
+ * @param east Length of the street from v to v + 1
+ * @param south Length of the street from v to v + side
+ * @param oneWaySouth True where the street to v + side is one-way (nullptr: none is)
+ */
+void addGridStreets(Graph& graph, int side, int (*east)(int), int (*south)(int),
+                    bool (*oneWaySouth)(int) = nullptr);
+
 /**
  * @brief Cleanup helper for test resources
  * @param graph Graph to delete (can be nullptr)
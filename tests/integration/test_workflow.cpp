@@ -109,9 +109,105 @@ TEST_CASE("[INTEGRATION] test_full_pipeline") {
             
             CHECK_NOTHROW(sim.run());
             CHECK(sim.isFinished() == true);
+            CHECK(facilityMgr.getTruck().getCurrentLoad() == 0);  // shifts end at the dump
         }
         
         if (bins) delete[] bins;
         if (facilities) delete[] facilities;
     }
+
+    SUBCASE("Fleet of trucks") {
+        JsonParser parser("data/test_fleet.json");
+
+        int binCount = 0, facilityCount = 0, truckCount = 0;
+        Bin* bins = parser.loadBins(binCount);
+        Facility* facilities = parser.loadFacilities(facilityCount);
+        Truck* trucks = parser.loadTrucks(truckCount);
+        Graph graph = parser.loadGraph();
+        REQUIRE(truckCount == 3);
+
+        Facilities facilityMgr;
+        for (int i = 0; i < binCount; i++) {
+            facilityMgr.addBin(bins[i]);
+        }
+        for (int i = 0; i < facilityCount; i++) {
+            facilityMgr.addFacility(facilities[i]);
+        }
+        facilityMgr.setTruck(trucks[0]);
+        for (int i = 1; i < truckCount; i++) {
+            facilityMgr.addTruck(trucks[i]);
+        }
+        CHECK(facilityMgr.getTruckCount() == 3);
+        CHECK(facilityMgr.getTruck(2).getId() == "T3");
+
+        Simulation sim(graph, facilityMgr, 5);
+        REQUIRE(sim.getFleetPlanner() != nullptr);
+        sim.run();
+
+        // Fleet totals are the sums of what every truck did
+        int distance = 0, collections = 0;
+        for (int t = 0; t < truckCount; t++) {
+            CHECK(sim.getTruckCollections(t) > 0);
+            distance += sim.getTruckDistance(t);
+            collections += sim.getTruckCollections(t);
+        }
+        CHECK(distance == sim.getTotalDistance());
+        CHECK(collections == sim.getCollectionsCompleted());
+        CHECK(sim.getOverflowCount() == 0);
+
+        delete[] bins;
+        delete[] facilities;
+        delete[] trucks;
+    }
+    SUBCASE("Sample totals with end-of-shift unloads") {
+        // A week on each sample city, as `garbage_sim FILE --no-ui` runs it
+        auto runWeek = [](const char* file, int& distance, int& overflows, int& collections) {
+            JsonParser parser(file);
+            int binCount = 0, facilityCount = 0, truckCount = 0;
+            Bin* bins = parser.loadBins(binCount);
+            Facility* facilities = parser.loadFacilities(facilityCount);
+            Truck* trucks = parser.loadTrucks(truckCount);
+            Graph graph = parser.loadGraph();
+
+            Facilities facilityMgr;
+            for (int i = 0; i < binCount; i++) {
+                facilityMgr.addBin(bins[i]);
+            }
+            for (int i = 0; i < facilityCount; i++) {
+                facilityMgr.addFacility(facilities[i]);
+            }
+            for (int i = 0; i < truckCount; i++) {
+                if (i == 0)
+                    facilityMgr.setTruck(trucks[i]);
+                else
+                    facilityMgr.addTruck(trucks[i]);
+            }
+
+            Simulation sim(graph, facilityMgr, 7);
+            sim.run();
+            distance = sim.getTotalDistance();
+            overflows = sim.getOverflowCount();
+            collections = sim.getCollectionsCompleted();
+
+            delete[] bins;
+            delete[] facilities;
+            delete[] trucks;
+        };
+
+        int distance = 0, overflows = 0, collections = 0;
+        runWeek("data/data.json", distance, overflows, collections);
+        CHECK(distance == 140);
+        CHECK(overflows == 2);
+        CHECK(collections == 16);
+
+        runWeek("data/test_minimal.json", distance, overflows, collections);
+        CHECK(distance == 56);
+        CHECK(overflows == 0);
+        CHECK(collections == 7);
+
+        runWeek("data/test_overflow.json", distance, overflows, collections);
+        CHECK(distance == 51);
+        CHECK(overflows == 12);
+        CHECK(collections == 7);
+    }
 }
@@ -6,9 +6,33 @@
  */
 
 #include "doctest.h"
+#include "../fixtures/test_helpers.h"
 #include "core/RoutePlanner.h"
+#include "core/BinStore.h"
+#include "core/CriticalBinIndex.h"
+#include "core/DistanceMatrix.h"
+#include "core/EmergencyRescheduler.h"
+#include "core/FillForecaster.h"
+#include "core/FleetPlanner.h"
+#include "core/HorizonPlanner.h"
+#include "core/LandmarkOracle.h"
+#include "core/LegCache.h"
+#include "core/LnsPlanner.h"
+#include "core/MultiStartPlanner.h"
+#include "core/NearestDisposalField.h"
 #include "core/OverflowPredictor.h"
+#include "core/PlanningState.h"
+#include "core/RouteImprover.h"
+#include "core/SavingsPlanner.h"
+#include "core/SmoothingForecaster.h"
+#include "core/SplitPlanner.h"
 #include "core/Simulation.h"
+#include "data_structures/ContractionHierarchy.h"
+#include "utils/Random.h"
+#include "utils/ThreadPool.h"
+
+#include <climits>
+#include <cstdio>
 
 using namespace project;
 
@@ -100,3 +124,1880 @@ TEST_CASE("[UNIT] test_optimization") {
         CHECK(route.getTotalDistance() == 100);
     }
 }
+
+TEST_CASE("[UNIT] test_fill_statistics") {
+    // Aggregates recomputed from the ring after every record
+    auto checkAgainstRing = [](const Bin& bin) {
+        int window = bin.getHistoryDays();
+        int recorded = bin.getRecordedDays();
+        const int* ring = bin.getFillHistory();
+        long long sum = 0;
+        for (int i = 0; i < window; i++) {
+            sum += ring[i];
+        }
+        CHECK(bin.getAverageFillRate() == doctest::Approx(sum / static_cast<double>(window)));
+
+        double changeSum = 0;
+        double changeSquares = 0;
+        int oldest = (bin.getHistoryIndex() - recorded + window) % window;
+        for (int k = 1; k < recorded; k++) {
+            double change = ring[(oldest + k) % window] - ring[(oldest + k - 1) % window];
+            changeSum += change;
+            changeSquares += change * change;
+        }
+        double mean = recorded > 1 ? changeSum / (recorded - 1) : 0.0;
+        double variance = recorded > 1 ? changeSquares / (recorded - 1) - mean * mean : 0.0;
+        CHECK(bin.getAverageDailyChange() == doctest::Approx(mean));
+        CHECK(bin.getDailyChangeVariance() == doctest::Approx(variance).epsilon(1e-9));
+    };
+
+    SUBCASE("Running aggregates match a recount for short and long windows") {
+        int windows[] = {1, 2, 7, 30};
+        for (int window : windows) {
+            Bin bin("B1", "Park", 500, 0, 5, 0, window);
+            Random rng(window);
+            for (int d = 0; d < 100; d++) {
+                bin.recordFillLevel(rng.below(500));
+                checkAgainstRing(bin);
+            }
+            CHECK(bin.getRecordedDays() == window);
+        }
+    }
+
+    SUBCASE("Default window keeps the 7-day average") {
+        Bin bin("B1", "Park", 100, 0, 5, 0);
+        CHECK(bin.getHistoryDays() == 7);
+        int levels[] = {10, 20, 30, 40, 50, 60, 70, 80, 90};
+        for (int level : levels) {
+            bin.recordFillLevel(level);
+        }
+        CHECK(bin.getAverageFillRate() == doctest::Approx(420.0 / 7.0));  // 30..90
+        CHECK(bin.getAverageDailyChange() == doctest::Approx(10.0));
+        CHECK(bin.getDailyChangeVariance() == doctest::Approx(0.0));
+    }
+
+    SUBCASE("Copies own their history") {
+        Bin original("B1", "Park", 100, 0, 5, 0, 30);
+        for (int d = 0; d < 40; d++) {
+            original.recordFillLevel(d % 11);
+        }
+        Bin copy(original);
+        Bin assigned;
+        assigned = original;
+        original.recordFillLevel(99);
+        CHECK(copy.getHistoryDays() == 30);
+        CHECK(copy.getFillHistory() != original.getFillHistory());
+        CHECK(assigned.getAverageFillRate() == copy.getAverageFillRate());
+        checkAgainstRing(copy);
+        checkAgainstRing(assigned);
+    }
+
+    SUBCASE("Safety margin reads the daily-change statistics") {
+        Bin steady("S", "Park", 1000, 500, 10, 0);
+        Bin erratic("E", "Park", 1000, 500, 10, 1);
+        for (int d = 1; d <= 7; d++) {
+            steady.recordFillLevel(100 + 10 * d);                          // +10 a day
+            erratic.recordFillLevel(100 + 10 * d + (d % 2 == 0 ? 30 : -30));  // +70, -50, ...
+        }
+        OverflowPredictor predictor(2);
+        CHECK(predictor.predictDaysToOverflow(steady) == 3);  // 500 / 140
+        CHECK(predictor.predictDaysToOverflow(erratic) == 3);  // 500 / 135.7
+        CHECK_FALSE(predictor.isCritical(erratic));
+
+        predictor.setSafetyMargin(1.0);
+        CHECK(predictor.predictDaysToOverflow(steady) == 3);  // no spread, same rate
+        CHECK(predictor.predictDaysToOverflow(erratic) == 2);  // 500 / (135.7 + 60)
+        CHECK(predictor.isCritical(erratic));
+    }
+
+    SUBCASE("Changing the window forgets the history") {
+        Bin bin("B1", "Park", 100, 0, 5, 0);
+        bin.recordFillLevel(40);
+        bin.recordFillLevel(60);
+        bin.setHistoryDays(14);
+        CHECK(bin.getHistoryDays() == 14);
+        CHECK(bin.getRecordedDays() == 0);
+        CHECK(bin.getAverageFillRate() == 0.0);
+        bin.setHistoryDays(0);
+        CHECK(bin.getHistoryDays() == 1);
+    }
+}
+
+TEST_CASE("[UNIT] test_fill_forecaster") {
+    SUBCASE("Constant inflow keeps the history prediction") {
+        FillForecaster model;
+        model.reset(1);
+        model.setLevel(0, 5);
+        for (int d = 0; d < 30; d++) {
+            model.observe(0, 5);
+            model.advanceDay();
+        }
+        CHECK(model.forecast(0, 1) == doctest::Approx(5.0));
+        CHECK(model.forecast(0, 7) == doctest::Approx(5.0));
+        CHECK(model.predictDaysToOverflow(0, 10) == 2);  // (100-90)/5, as the history
+        CHECK(model.predictDaysToOverflow(0, 12) == 2);
+        CHECK(model.predictDaysToOverflow(0, 3) == 1);
+        CHECK(model.predictDaysToOverflow(0, 1000) == 200);  // past MAX_FORECAST_DAYS
+    }
+
+    SUBCASE("Weekly season is learned") {
+        // Five quiet days, then a market day and a weekend day
+        int week[] = {10, 10, 10, 10, 10, 40, 30};
+        FillForecaster model;
+        model.reset(1);
+        model.setLevel(0, 10);
+        for (int d = 0; d < 20 * 7; d++) {
+            model.observe(0, week[d % 7]);
+            model.advanceDay();
+        }
+        for (int ahead = 1; ahead <= 7; ahead++) {
+            CHECK(model.forecast(0, ahead) ==
+                  doctest::Approx(week[(model.getDay() + ahead - 1) % 7]).epsilon(0.05));
+        }
+
+        // Free space 45 the day before the market: the flat average (about 17/day)
+        // sees two days left, the season sees the market day coming
+        FillForecaster eve;
+        eve.reset(1);
+        eve.setLevel(0, 10);
+        for (int d = 0; d < 20 * 7 - 2; d++) {
+            eve.observe(0, week[d % 7]);
+            eve.advanceDay();
+        }
+        CHECK(eve.forecast(0, 1) > 35.0);
+        CHECK(eve.predictDaysToOverflow(0, 45) == 1);
+    }
+
+    SUBCASE("Predictor uses the model for indexed bins") {
+        Bin bin("B1", "Market", 100, 60, 10, 0);
+        FillForecaster model;
+        model.reset(1);
+        model.setLevel(0, 45);
+        OverflowPredictor predictor(2);
+        predictor.setForecaster(&model);
+        CHECK(predictor.predictDaysToOverflow(bin) == 4);  // history: 40/10
+        CHECK(predictor.predictDaysToOverflow(bin, 0) == 1);  // model: 40/45
+        CHECK(predictor.isCritical(bin, 0));
+        CHECK_FALSE(predictor.isCritical(bin));
+        CHECK(predictor.predictDaysToOverflow(bin, 5) == 4);  // unknown index: history
+
+        int days = 0;
+        bool critical = false;
+        predictor.predictBatch(&bin, 1, &days, nullptr, &critical);
+        CHECK(days == 1);
+        CHECK(critical);
+    }
+
+    SUBCASE("Simulation feeds the model every day") {
+        Graph graph(3);
+        graph.addEdge(0, 1, 5);
+        graph.addEdge(1, 2, 5);
+        Facilities facilities;
+        facilities.addFacility(Facility("DEPOT", "depot", 0, 0, 0));
+        facilities.addFacility(Facility("D1", "disposal", 0, 0, 2));
+        facilities.addBin(Bin("B1", "Street", 1000, 0, 7, 1));
+        facilities.setTruck(Truck("T1", 5000, 0, 0));
+
+        Simulation sim(graph, facilities, 5);
+        sim.getForecaster().setEnabled(true);
+        for (int d = 0; d < 5; d++) {
+            sim.step();
+        }
+        CHECK(sim.getForecaster().getBinCount() == 1);
+        CHECK(sim.getForecaster().getDay() == 5);
+        CHECK(sim.getForecaster().forecast(0, 1) == doctest::Approx(7.0));
+    }
+
+    SUBCASE("Smoothing model follows a change of use") {
+        SmoothingForecaster model(0.5);
+        model.reset(1);
+        model.setLevel(0, 10);
+        CHECK(model.predictDaysToOverflow(0, 25) == 2);
+        model.observe(0, 30);  // 0.5*30 + 0.5*10
+        model.advanceDay();
+        CHECK(model.forecast(0, 1) == doctest::Approx(20.0));
+        CHECK(model.forecast(0, 7) == doctest::Approx(20.0));
+        CHECK(model.predictDaysToOverflow(0, 25) == 1);
+        model.setLevel(0, 0);
+        CHECK(model.predictDaysToOverflow(0, 25) == INT_MAX);
+    }
+
+    SUBCASE("Predictor and simulation take any model") {
+        Bin bin("B1", "Market", 100, 60, 10, 0);
+        SmoothingForecaster smoothing;
+        smoothing.reset(1);
+        smoothing.setLevel(0, 20);
+        const ForecastModel* model = &smoothing;
+        OverflowPredictor predictor(2);
+        predictor.setForecaster(model);
+        CHECK(predictor.predictDaysToOverflow(bin, 0) == 2);  // model: 40/20
+        CHECK(predictor.isCritical(bin, 0));
+
+        Graph graph(3);
+        graph.addEdge(0, 1, 5);
+        graph.addEdge(1, 2, 5);
+        Facilities facilities;
+        facilities.addFacility(Facility("DEPOT", "depot", 0, 0, 0));
+        facilities.addFacility(Facility("D1", "disposal", 0, 0, 2));
+        facilities.addBin(Bin("B1", "Street", 1000, 0, 7, 1));
+        facilities.setTruck(Truck("T1", 5000, 0, 0));
+
+        Simulation sim(graph, facilities, 5);
+        sim.getSmoothingForecaster().setEnabled(true);
+        for (int d = 0; d < 5; d++) {
+            sim.step();
+        }
+        CHECK(sim.getSmoothingForecaster().getBinCount() == 1);
+        CHECK(sim.getSmoothingForecaster().forecast(0, 1) == doctest::Approx(7.0));
+        CHECK(sim.getForecaster().getBinCount() == 0);
+    }
+}
+
+TEST_CASE("[UNIT] test_critical_bin_index") {
+    // Capacity 100: overflowing, never fills, 1 day, 4 days, 9 days left
+    Facilities facilities;
+    facilities.addBin(Bin("B0", "Street", 100, 100, 5, 0));
+    facilities.addBin(Bin("B1", "Street", 100, 50, 0, 0));
+    facilities.addBin(Bin("B2", "Street", 100, 90, 8, 0));
+    facilities.addBin(Bin("B3", "Street", 100, 60, 10, 0));
+    facilities.addBin(Bin("B4", "Street", 100, 10, 10, 0));
+
+    OverflowPredictor predictor(2);  // no history yet: the configured rates
+
+    SUBCASE("Keys, queries and top-k") {
+        CriticalBinIndex index(2);
+        index.build(facilities, predictor, 3);
+        CHECK(index.size() == 4);  // B1 never fills
+        CHECK_FALSE(index.contains(1));
+        CHECK(index.getOverflowDay(0) == 2);  // already overflowing
+        CHECK(index.getOverflowDay(2) == 4);
+        CHECK(index.getOverflowDay(3) == 7);
+        CHECK(index.getOverflowDay(4) == 12);
+        CHECK(index.hasCritical(3));
+
+        int bins[5];
+        CHECK(index.getCriticalBins(3, bins) == 2);
+        CHECK(bins[0] == 0);
+        CHECK(bins[1] == 2);
+        CHECK(index.getMostUrgent(3, bins) == 3);
+        CHECK(bins[2] == 3);
+        CHECK(index.getMostUrgent(10, bins) == 4);
+        CHECK(index.size() == 4);  // queries leave the heap as it was
+
+        facilities.getBin(0).collect(100);
+        facilities.getBin(2).collect(90);
+        CHECK(index.update(0, facilities.getBin(0), predictor, 3));
+        CHECK(index.update(2, facilities.getBin(2), predictor, 3));
+        CHECK_FALSE(index.update(3, facilities.getBin(3), predictor, 3));  // unchanged
+        CHECK_FALSE(index.hasCritical(3));
+        CHECK(index.getMostUrgent(1, bins) == 1);
+        CHECK(bins[0] == 3);
+    }
+
+    SUBCASE("Keys follow the predictor") {
+        CriticalBinIndex index(2);
+        index.build(facilities, predictor, 0);
+        int bins[5];
+        for (int day = 1; day <= 12; day++) {
+            for (int i = 0; i < facilities.getBinCount(); i++) {
+                Bin& bin = facilities.getBin(i);
+                bin.updateFill();
+                if (day % 5 == 0 && bin.getCurrentFill() > 50)  // some collections
+                    bin.collect(bin.getCurrentFill());
+                index.update(i, bin, predictor, day);
+            }
+            for (int i = 0; i < facilities.getBinCount(); i++) {  // nothing moved since
+                CHECK_FALSE(index.update(i, facilities.getBin(i), predictor, day));
+            }
+
+            // The scan this replaces: same predictor, same critical bins
+            int expected = 0;
+            for (int i = 0; i < facilities.getBinCount(); i++) {
+                expected += predictor.isCritical(facilities.getBin(i), i);
+            }
+            CHECK(index.hasCritical(day) == (expected > 0));
+            int count = index.getCriticalBins(day, bins);
+            CHECK(count == expected);
+            for (int k = 0; k < count; k++) {
+                CHECK(predictor.isCritical(facilities.getBin(bins[k]), bins[k]));
+            }
+        }
+    }
+
+    SUBCASE("Simulation keeps the index") {
+        Graph graph(3);
+        graph.addEdge(0, 1, 5);
+        graph.addEdge(1, 2, 5);
+        Facilities city;
+        city.addFacility(Facility("DEPOT", "depot", 0, 0, 0));
+        city.addFacility(Facility("D1", "disposal", 0, 0, 2));
+        city.addBin(Bin("B1", "Street", 100, 95, 10, 1));
+        city.setTruck(Truck("T1", 5000, 0, 0));
+
+        Simulation sim(graph, city, 3);
+        sim.getCriticalIndex().setEnabled(true);
+        sim.step();
+        CHECK(sim.getCriticalIndex().getBinCount() == 1);
+        CHECK(city.getBin(0).getCurrentFill() == 0);  // collected ...
+        CHECK(sim.getCriticalIndex().getOverflowDay(0) == 3);  // ... re-keyed: 100 / (195/7)
+        sim.getCriticalIndex().setEnabled(false);
+        CHECK(sim.getCriticalIndex().getBinCount() == 0);  // not re-keyed while off
+        sim.getCriticalIndex().setEnabled(true);
+        sim.step();
+        CHECK(sim.getCriticalIndex().getBinCount() == 1);  // built again
+        sim.reset();
+        CHECK(sim.getCriticalIndex().getBinCount() == 0);
+    }
+
+    SUBCASE("Simulation finds the same critical bins as the scan") {
+        // Deferred bins turn critical; an unreachable bin and one larger than the truck
+        // are never collected and stay critical
+        Graph graph(8);
+        for (int v = 0; v + 1 < 7; v++) {
+            graph.addBidirectionalEdge(v, v + 1, 3 + v);
+        }
+        auto makeCity = [](Facilities& city) {
+            city.addFacility(Facility("DEPOT", "depot", 0, 0, 0));
+            city.addFacility(Facility("D1", "disposal", 0, 0, 6));
+            int fills[] = {10, 70, 30, 85, 0, 55};
+            int rates[] = {12, 9, 20, 4, 15, 7};
+            for (int i = 0; i < 6; i++) {
+                city.addBin(Bin("B" + std::to_string(i), "Street", 100, fills[i], rates[i],
+                                1 + i % 5));
+            }
+            city.addBin(Bin("B6", "Island", 100, 40, 9, 7));
+            city.addBin(Bin("B7", "Market", 300, 150, 10, 3));
+            city.setTruck(Truck("T1", 120, 0, 0));
+        };
+
+        for (int seasonal = 0; seasonal < 2; seasonal++) {
+            Facilities scanned;
+            Facilities indexed;
+            makeCity(scanned);
+            makeCity(indexed);
+            Simulation scan(graph, scanned, 10);
+            Simulation heap(graph, indexed, 10);
+            scan.getForecaster().setEnabled(seasonal == 1);
+            heap.getForecaster().setEnabled(seasonal == 1);
+            heap.getCriticalIndex().setEnabled(true);
+            scan.getHorizonPlanner().setEnabled(true);
+            heap.getHorizonPlanner().setEnabled(true);
+
+            OverflowPredictor reference(2);  // the planner's predictor
+            if (seasonal == 1)
+                reference.setForecaster(&heap.getForecaster());
+            int bins[8];
+            for (int day = 0; day < 10; day++) {
+                scan.step();
+                heap.step();
+                int today = heap.getTime() - 1;
+                bool listed[8] = {false, false, false, false, false, false, false, false};
+                int count = heap.getCriticalIndex().getCriticalBins(today, bins);
+                for (int k = 0; k < count; k++) {
+                    listed[bins[k]] = true;
+                }
+                for (int i = 0; i < 8; i++) {
+                    CHECK(listed[i] == reference.isCritical(indexed.getBin(i), i));
+                }
+            }
+            CHECK(heap.getOverflowCount() == scan.getOverflowCount());
+            CHECK(heap.getTotalDistance() == scan.getTotalDistance());
+            CHECK(heap.getCollectionsCompleted() == scan.getCollectionsCompleted());
+            CHECK(heap.getEmergencyInsertions() == scan.getEmergencyInsertions());
+        }
+    }
+}
+
+TEST_CASE("[UNIT] test_batch_prediction") {
+    // Overflowing, rate-less, history-driven and slow bins; 23 is not a multiple of the
+    // vector width
+    const int count = 23;
+    Bin bins[count];
+    for (int i = 0; i < count; i++) {
+        int capacity = 100 + 20 * (i % 3);
+        int fill = i % 5 == 0 ? capacity : (i * 13) % capacity;
+        int rate = i % 7 == 3 ? 0 : 1 + (i * 5) % 17;
+        bins[i] = Bin("B" + std::to_string(i), "Street", capacity, fill, rate, i);
+        for (int d = 0; d < i % 4; d++) {
+            bins[i].recordFillLevel(10 * d + i);  // getAverageFillRate > 0
+        }
+    }
+    bins[3] = Bin("B3", "Street", 100, 40, 0, 3);  // no rate and no history
+
+    for (SimdKernel kernel : {SimdKernel::Scalar, SimdKernel::Avx2}) {
+        OverflowPredictor predictor(3);
+        predictor.setKernel(kernel);
+        int days[count];
+        double risks[count];
+        bool critical[count];
+        predictor.predictBatch(bins, count, days, risks, critical);
+        for (int i = 0; i < count; i++) {
+            CHECK(days[i] == predictor.predictDaysToOverflow(bins[i]));
+            CHECK(risks[i] == predictor.getOverflowRisk(bins[i]));
+            CHECK(critical[i] == predictor.isCritical(bins[i]));
+        }
+        CHECK(days[0] == -1);
+        CHECK(days[3] == INT_MAX);
+
+        double onlyRisks[count];
+        predictor.predictBatch(bins, count, nullptr, onlyRisks, nullptr);
+        for (int i = 0; i < count; i++) {
+            CHECK(onlyRisks[i] == risks[i]);
+        }
+
+        // The batch reads the same cautious rates as single predictions
+        predictor.setSafetyMargin(1.5);
+        predictor.predictBatch(bins, count, days, nullptr, nullptr);
+        for (int i = 0; i < count; i++) {
+            CHECK(days[i] == predictor.predictDaysToOverflow(bins[i]));
+        }
+    }
+}
+
+TEST_CASE("[UNIT] test_one_to_many") {
+    Graph graph(5);
+    graph.addEdge(0, 1, 4);
+    graph.addEdge(0, 2, 1);
+    graph.addEdge(2, 1, 2);
+    graph.addEdge(1, 3, 5);
+    // node 4 is unreachable
+
+    RoutePlanner planner(graph);
+
+    SUBCASE("Matches point-to-point distances") {
+        int targets[] = {1, 3, 2, 0};
+        int distances[4];
+        planner.computeDistances(0, targets, 4, distances);
+
+        for (int i = 0; i < 4; i++) {
+            CHECK(distances[i] == planner.computeDistance(0, targets[i]));
+        }
+        CHECK(distances[0] == 3);
+        CHECK(distances[1] == 8);
+    }
+
+    SUBCASE("Duplicate, unreachable and invalid targets") {
+        int targets[] = {1, 1, 4, 99};
+        int distances[4];
+        planner.computeDistances(0, targets, 4, distances);
+
+        CHECK(distances[0] == 3);
+        CHECK(distances[1] == 3);
+        CHECK(distances[2] == INT_MAX);
+        CHECK(distances[3] == INT_MAX);
+    }
+}
+
+TEST_CASE("[UNIT] test_astar") {
+    // 6x6 grid with coordinates; horizontal roads are twice as long as they are straight
+    const int side = 6;
+    Graph graph(side * side);
+    for (int v = 0; v < side * side; v++) {
+        graph.setNodePosition(v, v % side * 10, v / side * 10);
+    }
+    test_fixtures::addGridStreets(
+        graph, side, [](int v) { return 20 + (v % 3); }, [](int) { return 10; },
+        [](int) { return true; });  // one-way southbound
+    RoutePlanner planner(graph);
+    REQUIRE(planner.getNetwork().hasPositions());
+
+    SUBCASE("Same distances as Dijkstra with fewer settled nodes") {
+        int dijkstraSettled = 0, astarSettled = 0;
+        for (int from = 0; from < side * side; from += 5) {
+            for (int to = 0; to < side * side; to += 3) {
+                int a = 0, b = 0;
+                int expected =
+                    planner.searchDistance(from, to, RoutePlanner::SearchMode::Dijkstra, &a);
+                int actual = planner.searchDistance(from, to, RoutePlanner::SearchMode::AStar, &b);
+                CHECK(actual == expected);
+                dijkstraSettled += a;
+                astarSettled += b;
+            }
+        }
+        CHECK(astarSettled < dijkstraSettled);
+        CHECK(planner.searchDistance(side * side - 1, 0, RoutePlanner::SearchMode::AStar) ==
+              INT_MAX);  // no northbound roads
+    }
+
+    SUBCASE("computeDistance honours the search mode") {
+        planner.setSearchMode(RoutePlanner::SearchMode::AStar);
+        CHECK(planner.getSearchMode() == RoutePlanner::SearchMode::AStar);
+        CHECK(planner.computeDistance(0, side * side - 1) ==
+              planner.searchDistance(0, side * side - 1, RoutePlanner::SearchMode::Dijkstra));
+    }
+
+    SUBCASE("Missing coordinates fall back to Dijkstra") {
+        Graph partial(3);
+        partial.addEdge(0, 1, 5);
+        partial.addEdge(1, 2, 7);
+        partial.setNodePosition(0, 0, 0);
+        RoutePlanner fallback(partial);
+        CHECK_FALSE(fallback.getNetwork().hasPositions());
+        fallback.setSearchMode(RoutePlanner::SearchMode::AStar);
+        CHECK(fallback.computeDistance(0, 2) == 12);
+    }
+}
+
+TEST_CASE("[UNIT] test_bidirectional_search") {
+    // Long one-way corridor plus a two-way grid: the meeting point must respect directions
+    const int side = 8;
+    Graph graph(side * side);
+    graph.enableReverseIndex();
+    test_fixtures::addGridStreets(
+        graph, side, [](int v) { return 3 + (v % 4); }, [](int) { return 2; },
+        [](int) { return true; });  // southbound only
+    RoutePlanner planner(graph);
+    planner.setSearchMode(RoutePlanner::SearchMode::Bidirectional);
+
+    SUBCASE("Same distances as Dijkstra") {
+        int mismatches = 0;
+        for (int from = 0; from < side * side; from += 3) {
+            for (int to = 0; to < side * side; to++) {
+                if (planner.computeDistance(from, to) !=
+                    planner.searchDistance(from, to, RoutePlanner::SearchMode::Dijkstra))
+                    mismatches++;
+            }
+        }
+        CHECK(mismatches == 0);
+        CHECK(planner.computeDistance(side * side - 1, 0) == INT_MAX);
+        CHECK(planner.computeDistance(5, 5) == 0);
+    }
+
+    SUBCASE("Settles fewer nodes on a cross-town leg") {
+        int forward = 0, both = 0;
+        int to = side * side - 1;
+        int expected = planner.searchDistance(0, to, RoutePlanner::SearchMode::Dijkstra, &forward);
+        CHECK(planner.searchDistance(0, to, RoutePlanner::SearchMode::Bidirectional, &both) ==
+              expected);
+        CHECK(both < forward);
+    }
+
+    SUBCASE("Works without a graph reverse index") {
+        Graph plain(3);
+        plain.addEdge(0, 1, 4);
+        plain.addEdge(1, 2, 4);
+        RoutePlanner other(plain);
+        other.setSearchMode(RoutePlanner::SearchMode::Bidirectional);
+        CHECK(other.computeDistance(0, 2) == 8);
+        CHECK(other.computeDistance(2, 0) == INT_MAX);
+    }
+}
+
+TEST_CASE("[UNIT] test_contraction_hierarchy") {
+    // Directed city with one-way streets, parallel edges, self loops and zero-length edges
+    const int n = 60;
+    Graph graph(n);
+    unsigned int seed = 12345;
+    for (int i = 0; i < 4 * n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        int from = (seed >> 8) % n;
+        seed = seed * 1103515245u + 12345u;
+        int to = (seed >> 8) % n;
+        seed = seed * 1103515245u + 12345u;
+        graph.addEdge(from, to, (seed >> 8) % 20);
+    }
+    graph.addEdge(3, 3, 1);
+    graph.addEdge(5, 6, 9);
+    graph.addEdge(5, 6, 2);
+    RoutePlanner planner(graph);
+
+    ContractionHierarchy ch;
+    ch.build(graph);
+    REQUIRE(ch.isBuilt());
+    CHECK(ch.getNodeCount() == n);
+
+    SUBCASE("Point-to-point matches Dijkstra on every pair") {
+        HierarchyQuery query(ch);
+        int mismatches = 0;
+        for (int from = 0; from < n; from++) {
+            for (int to = 0; to < n; to++) {
+                if (query.distance(from, to) != planner.computeDistance(from, to))
+                    mismatches++;
+            }
+        }
+        CHECK(mismatches == 0);
+        CHECK(query.distance(-1, 2) == INT_MAX);
+        CHECK(ch.distance(5, 6) == planner.computeDistance(5, 6));
+    }
+
+    SUBCASE("One-to-many matches computeDistances") {
+        HierarchyQuery query(ch);
+        int targets[] = {0, 7, 7, 59, 99, 13};
+        int expected[6], actual[6];
+        for (int from = 0; from < n; from += 7) {
+            planner.computeDistances(from, targets, 6, expected);
+            query.distances(from, targets, 6, actual);
+            for (int i = 0; i < 6; i++) {
+                CHECK(actual[i] == expected[i]);
+            }
+        }
+    }
+
+    SUBCASE("Save and load round trip") {
+        const char* path = "test_contraction_hierarchy.bin";
+        REQUIRE(ch.save(path));
+        ContractionHierarchy loaded;
+        REQUIRE(loaded.load(path));
+        std::remove(path);
+
+        CHECK(loaded.getMemoryUsage() == ch.getMemoryUsage());
+        HierarchyQuery query(loaded);
+        for (int to = 0; to < n; to++) {
+            CHECK(query.distance(1, to) == planner.computeDistance(1, to));
+        }
+        CHECK_FALSE(loaded.load("no_such_file.bin"));
+        CHECK_FALSE(loaded.isBuilt());
+    }
+
+    SUBCASE("Planner in Hierarchy mode matches Dijkstra") {
+        planner.setHierarchy(&ch);
+        planner.setSearchMode(RoutePlanner::SearchMode::Hierarchy);
+        int mismatches = 0;
+        long long dijkstraSettled = 0, hierarchySettled = 0;
+        for (int from = 0; from < n; from++) {
+            for (int to = 0; to < n; to++) {
+                int a = 0, b = 0;
+                int expected =
+                    planner.searchDistance(from, to, RoutePlanner::SearchMode::Dijkstra, &a);
+                if (planner.searchDistance(from, to, RoutePlanner::SearchMode::Hierarchy, &b) !=
+                        expected ||
+                    planner.computeDistance(from, to) != expected)
+                    mismatches++;
+                dijkstraSettled += a;
+                hierarchySettled += b;
+            }
+        }
+        CHECK(mismatches == 0);
+        CHECK(hierarchySettled < dijkstraSettled);
+        CHECK(planner.computeDistance(-1, 2) == INT_MAX);
+        CHECK(planner.computeDistance(2, n) == INT_MAX);
+
+        int targets[] = {0, 7, 7, 59, 99, 13, -1};
+        int actual[7];
+        for (int from = 0; from < n; from += 7) {
+            planner.computeDistances(from, targets, 7, actual);
+            for (int i = 0; i < 6; i++) {
+                CHECK(actual[i] == planner.searchDistance(from, targets[i],
+                                                          RoutePlanner::SearchMode::Dijkstra));
+            }
+            CHECK(actual[6] == INT_MAX);
+        }
+
+        ContractionHierarchy other;  // farklı boyutta indeks: Dijkstra'ya döner
+        Graph small(3);
+        small.addEdge(0, 1, 1);
+        other.build(small);
+        planner.setHierarchy(&other);
+        CHECK(planner.computeDistance(5, 6) ==
+              planner.searchDistance(5, 6, RoutePlanner::SearchMode::Dijkstra));
+        planner.setHierarchy(nullptr);
+    }
+}
+
+TEST_CASE("[UNIT] test_landmark_oracle") {
+    // Random directed city with a few one-way streets and an unreachable pocket (nodes 40-41)
+    const int n = 42;
+    Graph graph(n);
+    unsigned int seed = 777;
+    for (int i = 0; i < 4 * 40; i++) {
+        seed = seed * 1103515245u + 12345u;
+        int from = (seed >> 8) % 40;
+        seed = seed * 1103515245u + 12345u;
+        int to = (seed >> 8) % 40;
+        seed = seed * 1103515245u + 12345u;
+        graph.addEdge(from, to, 1 + (seed >> 8) % 15);
+    }
+    graph.addEdge(40, 41, 3);
+    RoutePlanner planner(graph);
+
+    LandmarkOracle oracle(planner.getNetwork());
+    oracle.build(4);
+    REQUIRE(oracle.getLandmarkCount() == 4);
+    CHECK(oracle.getMemoryUsage() > 0);
+
+    SUBCASE("Lower bounds never exceed Dijkstra") {
+        int violations = 0;
+        for (int from = 0; from < n; from++) {
+            for (int to = 0; to < n; to++) {
+                int exact = planner.searchDistance(from, to, RoutePlanner::SearchMode::Dijkstra);
+                int bound = oracle.lowerBound(from, to);
+                if (bound > exact)
+                    violations++;
+            }
+        }
+        CHECK(violations == 0);
+        CHECK(oracle.lowerBound(7, 7) == 0);
+        CHECK(oracle.lowerBound(-1, 3) == 0);
+    }
+
+    SUBCASE("Landmark A* matches Dijkstra") {
+        planner.setLandmarkOracle(&oracle);
+        planner.setSearchMode(RoutePlanner::SearchMode::Landmarks);
+        int mismatches = 0;
+        for (int from = 0; from < n; from++) {
+            for (int to = 0; to < n; to++) {
+                if (planner.computeDistance(from, to) !=
+                    planner.searchDistance(from, to, RoutePlanner::SearchMode::Dijkstra))
+                    mismatches++;
+            }
+        }
+        CHECK(mismatches == 0);
+        CHECK(oracle.distance(0, 99) == INT_MAX);
+    }
+
+    SUBCASE("Pruning keeps the greedy choice") {
+        // 6x6 two-way grid, equally full bins everywhere: only distance decides
+        const int side = 6;
+        Graph city(side * side);
+        test_fixtures::addGridStreets(city, side, [](int) { return 4; }, [](int) { return 4; });
+        Facilities facilities;
+        for (int v = 0; v < side * side; v++) {
+            facilities.addBin(Bin("B" + std::to_string(v), "Grid", 100, 20, 1, v));
+        }
+        facilities.setTruck(Truck("T1", 500, 0, 14));
+
+        RoutePlanner plain(city);
+        RoutePlanner pruned(city);
+        LandmarkOracle cityOracle(pruned.getNetwork());
+        cityOracle.build(4);
+        pruned.setLandmarkOracle(&cityOracle);
+
+        CHECK(pruned.selectNextBin(facilities) == plain.selectNextBin(facilities));
+        CHECK(pruned.getCandidatesScored() == side * side);
+        CHECK(pruned.getCandidatesPruned() > 0);
+        CHECK(plain.getCandidatesPruned() == 0);
+    }
+}
+
+TEST_CASE("[UNIT] test_path_reconstruction") {
+    // 0 -> 1 -> 2 -> 3 is cheaper than the direct 0 -> 3; node 4 only has outgoing roads
+    Graph graph(5);
+    graph.addEdge(0, 1, 2);
+    graph.addEdge(1, 2, 2);
+    graph.addEdge(2, 3, 2);
+    graph.addEdge(0, 3, 9);
+    graph.addBidirectionalEdge(3, 0, 7);
+    graph.addEdge(4, 0, 1);
+    RoutePlanner planner(graph);
+
+    SUBCASE("Nodes follow real edges and add up to the distance") {
+        Path path;
+        CHECK(planner.computePath(0, 3, path) == 6);
+        REQUIRE(path.getLength() == 4);
+        CHECK(path.getNodeAt(0) == 0);
+        CHECK(path.getNodeAt(1) == 1);
+        CHECK(path.getNodeAt(2) == 2);
+        CHECK(path.getNodeAt(3) == 3);
+        CHECK(path.getDistance() == planner.computeDistance(0, 3));
+
+        CHECK(planner.computePath(2, 2, path) == 0);
+        CHECK(path.getLength() == 1);
+
+        CHECK(planner.computePath(0, 4, path) == INT_MAX);
+        CHECK(path.isEmpty());
+        CHECK(planner.computePath(0, 42, path) == INT_MAX);
+    }
+
+    SUBCASE("Legs are searched once and chain into one path") {
+        LegCache cache(planner);
+        Path day;
+        day.addNode(4);
+        day.appendLeg(cache.getLeg(4, 0));
+        day.appendLeg(cache.getLeg(0, 3));
+        day.appendLeg(cache.getLeg(3, 0));
+        day.appendLeg(cache.getLeg(0, 3));
+
+        CHECK(cache.getSize() == 3);
+        CHECK(cache.getMisses() == 3);
+        CHECK(cache.getHits() == 1);
+        CHECK(cache.contains(3, 0));
+        CHECK_FALSE(cache.contains(0, 4));
+        CHECK(day.getDistance() == 1 + 6 + 7 + 6);
+        CHECK(day.getLength() == 1 + 1 + 3 + 1 + 3);  // joints are not repeated
+        CHECK(day.getNodeAt(day.getLength() - 1) == 3);
+
+        cache.clear();
+        CHECK(cache.getSize() == 0);
+    }
+
+    SUBCASE("Simulation records the day's driven path") {
+        Facilities facilities;
+        facilities.addFacility(Facility("DEPOT", "depot", 0, 0, 0));
+        facilities.addFacility(Facility("D1", "disposal", 0, 0, 3));
+        facilities.addBin(Bin("B1", "North", 100, 60, 10, 2));
+        facilities.addBin(Bin("B2", "East", 100, 70, 10, 3));
+        facilities.setTruck(Truck("T1", 500, 0, 0));
+
+        Simulation sim(graph, facilities, 2);
+        CHECK(sim.getDayPath().isEmpty());
+        sim.step();
+
+        const Path& day = sim.getDayPath();
+        REQUIRE(day.getLength() > 1);
+        CHECK(day.getNodeAt(0) == 0);
+        CHECK(day.getNodeAt(day.getLength() - 1) == 0);
+        CHECK(day.getDistance() == sim.getTotalDistance());
+
+        int before = sim.getTotalDistance();
+        sim.step();
+        CHECK(sim.getDayPath().getDistance() == sim.getTotalDistance() - before);
+        CHECK(sim.getLegCache().getSize() == sim.getLegCache().getMisses());
+    }
+}
+
+TEST_CASE("[UNIT] test_route_improver") {
+    // 8x8 two-way grid with one one-way avenue; depot at 0, dump in the far corner
+    const int side = 8;
+    Graph graph(side * side);
+    test_fixtures::addGridStreets(
+        graph, side, [](int v) { return 3 + v % 4; },
+        [](int v) { return v % side == 4 ? 2 : 3; }, [](int v) { return v % side == 4; });
+    RoutePlanner planner(graph);
+
+    Facilities facilities;
+    facilities.addFacility(Facility("DEPOT", "depot", 0, 0, 0));
+    facilities.addFacility(Facility("DUMP", "disposal", 0, 0, side * side - 1));
+    const int binNodes[] = {60, 3, 45, 17, 38, 9, 52, 22, 31, 14, 57, 26};
+    const int binCount = 12;
+    Route zigzag;
+    for (int i = 0; i < binCount; i++) {
+        facilities.addBin(Bin("B" + std::to_string(i), "Grid", 100, 40 + 5 * (i % 3), 5,
+                              binNodes[i]));
+        zigzag.addBin(i);
+    }
+    facilities.setTruck(Truck("T1", 200, 30, 0));
+
+    // Drives a route as the simulation does and returns the distance and worst trip load
+    auto walk = [&](const Route& route, int& worstLoad) {
+        int at = 0, total = 0, carried = 30;
+        worstLoad = carried;
+        for (int i = 0; i < route.getLength(); i++) {
+            int next = route.isDisposalAt(i) ? route.getDisposalNodeAt(i)
+                                              : facilities.getBin(route.getBinAt(i)).getNodeId();
+            total += planner.computeDistance(at, next);
+            at = next;
+            carried = route.isDisposalAt(i)
+                          ? 0
+                          : carried + facilities.getBin(route.getBinAt(i)).getCurrentFill();
+            if (carried > worstLoad)
+                worstLoad = carried;
+        }
+        return total + planner.computeDistance(at, 0);
+    };
+
+    SUBCASE("Shorter route with every bin once and no overloaded trip") {
+        RouteImprover improver(planner, 1000.0);
+        Route improved = improver.improve(zigzag, facilities);
+
+        CHECK(improver.getFinalDistance() < improver.getInitialDistance());
+        CHECK(improver.getTwoOptMoves() + improver.getOrOptMoves() +
+                  improver.getRelocateMoves() > 0);
+
+        int seen[binCount] = {0};
+        int stops = 0;
+        for (int i = 0; i < improved.getLength(); i++) {
+            if (improved.isDisposalAt(i))
+                stops++;
+            else
+                seen[improved.getBinAt(i)]++;
+        }
+        for (int i = 0; i < binCount; i++) {
+            CHECK(seen[i] == 1);
+        }
+        CHECK(stops >= 2);  // 30 + 540 units of garbage in a 200-unit truck
+        CHECK(improved.requiresDisposal());
+
+        int worstLoad = 0;
+        CHECK(walk(improved, worstLoad) == improver.getFinalDistance());
+        CHECK(improved.getTotalDistance() == improver.getFinalDistance());
+        CHECK(worstLoad <= 200);
+    }
+
+    SUBCASE("Zero budget only splits the route into trips") {
+        RouteImprover improver(planner, 0.0);
+        Route split = improver.improve(zigzag, facilities);
+
+        CHECK(improver.getFinalDistance() == improver.getInitialDistance());
+        CHECK(improver.getTwoOptMoves() + improver.getOrOptMoves() == 0);
+        int worstLoad = 0;
+        CHECK(walk(split, worstLoad) == improver.getInitialDistance());
+        CHECK(worstLoad <= 200);
+        CHECK(split.getBinAt(0) == 0);
+    }
+
+    SUBCASE("Disposal stops are stored in the route") {
+        Route route;
+        route.addBin(4);
+        route.addDisposalStop(0);
+        CHECK(route.getLength() == 2);
+        CHECK_FALSE(route.isDisposalAt(0));
+        CHECK(route.isDisposalAt(1));
+        CHECK(route.getBinAt(1) == -1);
+        CHECK(route.getDisposalNodeAt(1) == 0);
+        CHECK(route.getDisposalNodeAt(0) == -1);
+        CHECK(route.requiresDisposal());
+    }
+}
+
+TEST_CASE("[UNIT] test_scoring_policy") {
+    // Street 0..10 with the depot at 0: an urgent bin far away, a relaxed one next door
+    Graph graph(11);
+    for (int v = 0; v + 1 < 11; v++) {
+        graph.addBidirectionalEdge(v, v + 1, 2);
+    }
+    RoutePlanner planner(graph);
+    Facilities facilities;
+    facilities.addFacility(Facility("DEPOT", "depot", 0, 0, 0));
+    facilities.addFacility(Facility("DUMP", "disposal", 0, 0, 10));
+    facilities.addBin(Bin("FAR", "Street", 100, 90, 10, 8));
+    facilities.addBin(Bin("NEAR", "Street", 100, 10, 2, 1));
+    facilities.addBin(Bin("MID", "Street", 100, 40, 5, 4));
+    facilities.setTruck(Truck("T1", 500, 0, 0));
+    PlanningState state(facilities);
+    REQUIRE(state.getRisk(0) < state.getRisk(1));
+
+    auto sameRoute = [](const Route& a, const Route& b) {
+        if (a.getLength() != b.getLength())
+            return false;
+        for (int i = 0; i < a.getLength(); i++) {
+            if (a.getBinAt(i) != b.getBinAt(i))
+                return false;
+        }
+        return true;
+    };
+
+    SUBCASE("Stock policies") {
+        Route riskFirst = planner.planRoute(state, RiskFirstScoring());
+        Route nearestFirst = planner.planRoute(state, NearestFirstScoring());
+        REQUIRE(riskFirst.getLength() == 3);
+        REQUIRE(nearestFirst.getLength() == 3);
+        CHECK(riskFirst.getBinAt(0) == 0);
+        CHECK(nearestFirst.getBinAt(0) == 1);
+        CHECK(nearestFirst.getBinAt(1) == 2);
+
+        CHECK(sameRoute(planner.planRoute(state), riskFirst));
+        CHECK(sameRoute(planner.planRoute(state, WeightedScoring(1000.0)), riskFirst));
+        CHECK(sameRoute(planner.planRoute(state, WeightedScoring(0.0)), nearestFirst));
+    }
+
+    SUBCASE("Custom policy is called for every candidate") {
+        long long calls = 0;
+        auto counting = [&calls](double risk, int distance) {
+            calls++;
+            return risk * 1000 + distance;
+        };
+        long long scoredBefore = planner.getCandidatesScored();
+        Route route = planner.planRoute(state, counting);
+        CHECK(calls == planner.getCandidatesScored() - scoredBefore);
+        CHECK(calls == 3 + 2 + 1);
+        CHECK(sameRoute(route, planner.planRoute(state)));
+    }
+
+    SUBCASE("Matrix oracle gives the same routes") {
+        Route plain = planner.planRoute(state, NearestFirstScoring());
+        int points[] = {0, 10, 8, 1, 4};
+        DistanceMatrix matrix;
+        REQUIRE(matrix.build(planner, points, 5));
+        planner.setDistanceMatrix(&matrix);
+        CHECK(sameRoute(planner.planRoute(state, NearestFirstScoring()), plain));
+        CHECK(sameRoute(planner.planRoute(state, WeightedScoring(10.0)),
+                        RoutePlanner(graph).planRoute(state, WeightedScoring(10.0))));
+    }
+}
+
+TEST_CASE("[UNIT] test_savings_planner") {
+    // 10x10 two-way grid; depot in one corner, dump next to it, two clusters of bins
+    const int side = 10;
+    Graph graph(side * side);
+    test_fixtures::addGridStreets(graph, side, [](int) { return 4; }, [](int) { return 4; });
+    RoutePlanner planner(graph);
+
+    const int binNodes[] = {9, 18, 19, 28, 29, 8, 90, 81, 91, 80, 92, 71, 55, 66};
+    const int binCount = 14;
+    auto makeFacilities = [&](Facilities& facilities) {
+        facilities.addFacility(Facility("DEPOT", "depot", 0, 0, 0));
+        facilities.addFacility(Facility("DUMP", "disposal", 0, 0, 1));
+        for (int i = 0; i < binCount; i++) {
+            facilities.addBin(Bin("B" + std::to_string(i), "Grid", 100, 40, 5, binNodes[i]));
+        }
+        facilities.setTruck(Truck("T1", 200, 0, 0));
+    };
+
+    // Drives a route from the depot and back; returns the distance and worst trip load
+    auto walk = [&](const Route& route, int& worstLoad) {
+        int at = 0, total = 0, carried = 0;
+        worstLoad = 0;
+        for (int i = 0; i < route.getLength(); i++) {
+            int next = route.isDisposalAt(i) ? route.getDisposalNodeAt(i)
+                                              : binNodes[route.getBinAt(i)];
+            total += planner.computeDistance(at, next);
+            at = next;
+            carried = route.isDisposalAt(i) ? 0 : carried + 40;
+            if (carried > worstLoad)
+                worstLoad = carried;
+        }
+        return total + planner.computeDistance(at, 0);
+    };
+
+    SUBCASE("Every bin once, trips within capacity, bins collected") {
+        Facilities facilities;
+        makeFacilities(facilities);
+        SavingsPlanner savings(planner, 6, 2);
+        Route route = savings.plan(facilities);
+
+        int seen[binCount] = {0};
+        int stops = 0;
+        for (int i = 0; i < route.getLength(); i++) {
+            if (route.isDisposalAt(i))
+                stops++;
+            else
+                seen[route.getBinAt(i)]++;
+        }
+        for (int i = 0; i < binCount; i++) {
+            CHECK(seen[i] == 1);
+            CHECK(facilities.getBin(i).getCurrentFill() == 0);
+        }
+        CHECK(stops >= 2);  // 560 units in a 200-unit truck
+        CHECK(savings.getTripCount() == stops + 1);
+        CHECK(savings.getMergeCount() > 0);
+        CHECK(savings.getSavingsCount() > 0);
+
+        int worstLoad = 0;
+        walk(route, worstLoad);
+        CHECK(worstLoad <= 200);
+    }
+
+    SUBCASE("Shorter than the greedy route on clustered bins") {
+        Facilities greedyFacilities, savingsFacilities, fresh;
+        makeFacilities(greedyFacilities);
+        makeFacilities(savingsFacilities);
+        makeFacilities(fresh);
+
+        Route greedy = planner.planRoute(greedyFacilities);
+        planner.setPlanningEngine(RoutePlanner::PlanningEngine::Savings);
+        CHECK(planner.getPlanningEngine() == RoutePlanner::PlanningEngine::Savings);
+        CHECK(planner.getReverseNetwork().getNodeCount() == side * side);  // built once here
+        Route savings = planner.planRoute(savingsFacilities);
+        CHECK(savingsFacilities.getTruck().getCurrentNode() != 0);  // truck was moved
+
+        // Both orders split into trips as the simulation drives them; savings keeps its stops
+        RouteImprover splitter(planner, 0.0);
+        Route greedyTrips = splitter.improve(greedy, fresh);
+        long long greedyDistance = splitter.getFinalDistance();
+        Route savingsTrips = splitter.improve(savings, fresh);
+        CHECK(splitter.getFinalDistance() < greedyDistance);
+
+        int worstLoad = 0;
+        CHECK(walk(savingsTrips, worstLoad) == splitter.getFinalDistance());
+        CHECK(worstLoad <= 200);
+        CHECK(greedyTrips.requiresDisposal());
+    }
+
+    SUBCASE("Matrix rows give the same route as the graph searches") {
+        // Every bin paired with every other one, so both sides see the same savings
+        Facilities searched, tabled;
+        makeFacilities(searched);
+        makeFacilities(tabled);
+        Route expected = SavingsPlanner(planner, binCount, 2).plan(searched);
+
+        int points[binCount + 2] = {0, 1};
+        for (int i = 0; i < binCount; i++) {
+            points[i + 2] = binNodes[i];
+        }
+        DistanceMatrix matrix;
+        REQUIRE(matrix.build(planner, points, binCount + 2));
+        planner.setDistanceMatrix(&matrix);
+        SavingsPlanner savings(planner, binCount, 2);
+        Route route = savings.plan(tabled);
+        planner.setDistanceMatrix(nullptr);
+
+        REQUIRE(route.getLength() == expected.getLength());
+        for (int i = 0; i < route.getLength(); i++) {
+            CHECK(route.isDisposalAt(i) == expected.isDisposalAt(i));
+            CHECK(route.getBinAt(i) == expected.getBinAt(i));
+        }
+        int worstLoad = 0;
+        CHECK(walk(route, worstLoad) == walk(expected, worstLoad));
+        CHECK(worstLoad <= 200);
+        CHECK(savings.getMergeCount() > 0);
+    }
+
+    SUBCASE("Empty and unreachable bins are skipped") {
+        Graph oneWay(4);
+        oneWay.addEdge(0, 1, 2);
+        oneWay.addEdge(1, 2, 2);  // node 3 cannot be reached
+        RoutePlanner small(oneWay);
+        Facilities facilities;
+        facilities.addFacility(Facility("DEPOT", "depot", 0, 0, 0));
+        facilities.addBin(Bin("B0", "A", 100, 30, 5, 2));
+        facilities.addBin(Bin("B1", "B", 100, 0, 5, 1));
+        facilities.addBin(Bin("B2", "C", 100, 30, 5, 3));
+        facilities.setTruck(Truck("T1", 200, 0, 0));
+
+        SavingsPlanner savings(small);
+        Route route = savings.plan(facilities);
+        CHECK(route.getLength() == 1);
+        CHECK(route.getBinAt(0) == 0);
+        CHECK(facilities.getBin(2).getCurrentFill() == 30);
+    }
+}
+
+TEST_CASE("[UNIT] test_split_planner") {
+    // Two-way street 0..12: depot at 0, dumps at 4 and 12, bins of 40 on 1..11
+    Graph graph(13);
+    for (int v = 0; v + 1 < 13; v++) {
+        graph.addBidirectionalEdge(v, v + 1, 1 + v % 3);
+    }
+    RoutePlanner planner(graph);
+    Facilities facilities;
+    facilities.addFacility(Facility("DEPOT", "depot", 0, 0, 0));
+    facilities.addFacility(Facility("D1", "disposal", 0, 0, 4));
+    facilities.addFacility(Facility("D2", "disposal", 0, 0, 12));
+    const int binNodes[] = {1, 2, 3, 5, 6, 7, 8, 9, 10, 11};
+    for (int i = 0; i < 10; i++) {
+        facilities.addBin(Bin("B" + std::to_string(i), "Street", 100, 40, 5, binNodes[i]));
+    }
+    facilities.setTruck(Truck("T1", 100, 0, 0));
+
+    // Driving distance of a route from the depot and back, and its heaviest trip
+    auto evaluate = [&](const Route& route, int startLoad, int& heaviest) {
+        long long total = 0;
+        int current = 0, load = startLoad;
+        heaviest = load;
+        for (int i = 0; i < route.getLength(); i++) {
+            int node = route.isDisposalAt(i) ? route.getDisposalNodeAt(i)
+                                             : facilities.getBin(route.getBinAt(i)).getNodeId();
+            total += planner.computeDistance(current, node);
+            load = route.isDisposalAt(i) ? 0 : load + 40;
+            heaviest = load > heaviest ? load : heaviest;
+            current = node;
+        }
+        return total + planner.computeDistance(current, 0);
+    };
+
+    SUBCASE("Every bin once, trips fit, planned distance is driven") {
+        SplitPlanner split(planner);
+        Route route = split.plan(PlanningState(facilities));
+        int seen[10] = {0};
+        for (int i = 0; i < route.getLength(); i++) {
+            if (!route.isDisposalAt(i))
+                seen[route.getBinAt(i)]++;
+        }
+        for (int i = 0; i < 10; i++) {
+            CHECK(seen[i] == 1);
+        }
+        int heaviest = 0;
+        CHECK(evaluate(route, 0, heaviest) == split.getSplitDistance());
+        CHECK(heaviest <= 100);
+        CHECK(split.getTourLength() == 10);
+        CHECK(split.getTripCount() >= 4);
+        CHECK(split.getSplitDistance() >= split.getTourDistance());
+    }
+
+    SUBCASE("Optimal split beats unloading only when the next bin does not fit") {
+        SplitPlanner split(planner);
+        PlanningState state(facilities);
+        Route route = split.plan(state);
+
+        Route naive;  // same tour order, unload at the nearest site when full
+        int load = 0;
+        for (int i = 0; i < route.getLength(); i++) {
+            if (route.isDisposalAt(i))
+                continue;
+            int bin = route.getBinAt(i);
+            if (load + 40 > 100) {
+                naive.addDisposalStop(planner.findNearestDisposal(
+                    facilities.getBin(naive.getBinAt(naive.getLength() - 1)).getNodeId(),
+                    state));
+                load = 0;
+            }
+            naive.addBin(bin);
+            load += 40;
+        }
+        int heaviest = 0;
+        CHECK(split.getSplitDistance() <= evaluate(naive, 0, heaviest));
+    }
+
+    SUBCASE("Loaded truck may unload before the first trip") {
+        facilities.getTruck().setCurrentLoad(90);
+        planner.setPlanningEngine(RoutePlanner::PlanningEngine::GiantTour);
+        Route route = planner.planRoute(PlanningState(facilities));
+        REQUIRE(route.getLength() > 0);
+        CHECK(route.isDisposalAt(0));
+        int heaviest = 0;
+        evaluate(route, 90, heaviest);
+        CHECK(heaviest <= 100);
+        CHECK(facilities.getBin(0).getCurrentFill() == 40);  // snapshot only
+    }
+}
+
+TEST_CASE("[UNIT] test_multi_start_planner") {
+    // 10x10 grid with uneven streets, 30 bins of equal urgency scattered over it
+    const int side = 10;
+    Graph graph(side * side);
+    test_fixtures::addGridStreets(
+        graph, side, [](int v) { return 3 + (v * 7) % 5; }, [](int v) { return 3 + (v * 3) % 4; });
+    RoutePlanner planner(graph);
+    Facilities facilities;
+    facilities.addFacility(Facility("DEPOT", "depot", 0, 0, 45));
+    facilities.addFacility(Facility("DUMP", "disposal", 0, 0, 99));
+    for (int i = 0; i < 30; i++) {
+        facilities.addBin(Bin("B" + std::to_string(i), "Grid", 100, 50, 5, (i * 37 + 11) % 100));
+    }
+    facilities.setTruck(Truck("T1", 600, 0, 45));
+    PlanningState state(facilities);
+
+    auto sameRoute = [](const Route& a, const Route& b) {
+        if (a.getLength() != b.getLength())
+            return false;
+        for (int i = 0; i < a.getLength(); i++) {
+            if (a.isDisposalAt(i) != b.isDisposalAt(i) ||
+                (!a.isDisposalAt(i) && a.getBinAt(i) != b.getBinAt(i)))
+                return false;
+        }
+        return true;
+    };
+
+    SUBCASE("One start is the greedy route") {
+        MultiStartPlanner multiStart(planner, 1, 1);
+        CHECK(sameRoute(multiStart.plan(state), planner.planRoute(state)));
+        CHECK(multiStart.getBestStart() == 0);
+        CHECK(sameRoute(planner.planRandomizedGreedy(state, 7, 1, 0.0), planner.planRoute(state)));
+    }
+
+    SUBCASE("Best of many starts, independent of the thread count") {
+        MultiStartPlanner serial(planner, 24, 1);
+        MultiStartPlanner parallel(planner, 24, 4);
+        Route a = serial.plan(state);
+        Route b = parallel.plan(state);
+        CHECK(sameRoute(a, b));
+        CHECK(serial.getBestStart() == parallel.getBestStart());
+        CHECK(serial.getBestDistance() == parallel.getBestDistance());
+        CHECK(serial.getBestDistance() <= serial.getGreedyDistance());
+        for (int s = 0; s < 24; s++) {
+            CHECK(serial.getBestDistance() <= serial.getStartDistance(s));
+        }
+
+        int seen[30] = {0};
+        for (int i = 0; i < a.getLength(); i++) {
+            if (!a.isDisposalAt(i))
+                seen[a.getBinAt(i)]++;
+        }
+        for (int i = 0; i < 30; i++) {
+            CHECK(seen[i] == 1);
+        }
+    }
+
+    SUBCASE("Seeds drive the randomized starts") {
+        Route first = planner.planRandomizedGreedy(state, 3, 2, 0.5);
+        CHECK(sameRoute(first, planner.planRandomizedGreedy(state, 3, 2, 0.5)));
+        bool differs = false;
+        for (unsigned int seed = 4; seed < 12 && !differs; seed++) {
+            differs = !sameRoute(first, planner.planRandomizedGreedy(state, seed, 2, 0.5));
+        }
+        CHECK(differs);
+    }
+}
+
+TEST_CASE("[UNIT] test_lns_planner") {
+    // 12x12 two-way grid; bins scattered, depot in a corner, dump in the middle
+    const int side = 12;
+    Graph graph(side * side);
+    test_fixtures::addGridStreets(graph, side, [](int) { return 3; }, [](int) { return 3; });
+    RoutePlanner planner(graph);
+
+    const int binCount = 24;
+    Facilities facilities;
+    facilities.addFacility(Facility("DEPOT", "depot", 0, 0, 0));
+    facilities.addFacility(Facility("DUMP", "disposal", 0, 0, 78));
+    for (int i = 0; i < binCount; i++) {
+        int node = (i * 37 + 11) % (side * side);
+        facilities.addBin(Bin("B" + std::to_string(i), "Grid", 100, 20 + (i * 13) % 50, 5, node));
+    }
+    facilities.setTruck(Truck("T1", 250, 0, 0));
+
+    // Greedy seed; planRoute empties the bins, so put them back
+    int fills[binCount];
+    for (int i = 0; i < binCount; i++) {
+        fills[i] = facilities.getBin(i).getCurrentFill();
+    }
+    Route seed = planner.planRoute(facilities);
+    for (int i = 0; i < binCount; i++) {
+        facilities.getBin(i).setCurrentFill(fills[i]);
+    }
+    facilities.getTruck().setCurrentLoad(0);
+    facilities.getTruck().moveTo(0);
+
+    SUBCASE("Every bin once, trips within capacity, never worse than the seed") {
+        LnsPlanner lns(planner, 0.0, 300);
+        Route route = lns.improve(seed, facilities);
+
+        int seen[binCount] = {0};
+        int carried = 0, at = 0, total = 0;
+        for (int i = 0; i < route.getLength(); i++) {
+            int next;
+            if (route.isDisposalAt(i)) {
+                next = route.getDisposalNodeAt(i);
+                carried = 0;
+            } else {
+                seen[route.getBinAt(i)]++;
+                next = facilities.getBin(route.getBinAt(i)).getNodeId();
+                carried += fills[route.getBinAt(i)];
+                CHECK(carried <= 250);
+            }
+            total += planner.computeDistance(at, next);
+            at = next;
+        }
+        total += planner.computeDistance(at, 0);
+        for (int i = 0; i < binCount; i++) {
+            CHECK(seen[i] == 1);
+            CHECK(facilities.getBin(i).getCurrentFill() == fills[i]);  // not modified
+        }
+        CHECK(total == lns.getFinalDistance());
+        CHECK(route.getTotalDistance() == total);
+        CHECK(lns.getFinalDistance() <= lns.getInitialDistance());
+        CHECK(lns.getIterations() == 300);
+    }
+
+    SUBCASE("Progress counters and best-distance trace") {
+        LnsPlanner lns(planner, 0.0, 200);
+        lns.improve(seed, facilities);
+
+        CHECK(lns.getAcceptedCount() >= lns.getImprovementCount());
+        CHECK(lns.getIterationsPerSecond() > 0.0);
+        CHECK(lns.getRemovalCalls(LnsPlanner::Removal::Random) +
+                  lns.getRemovalCalls(LnsPlanner::Removal::Worst) +
+                  lns.getRemovalCalls(LnsPlanner::Removal::Related) ==
+              200);
+        REQUIRE(lns.getTraceLength() == lns.getImprovementCount() + 1);
+        CHECK(lns.getTraceMillis(0) == 0.0);
+        CHECK(lns.getTraceDistance(0) == lns.getInitialDistance());
+        for (int i = 1; i < lns.getTraceLength(); i++) {
+            CHECK(lns.getTraceMillis(i) >= lns.getTraceMillis(i - 1));
+        }
+        CHECK(lns.getTraceDistance(lns.getTraceLength() - 1) == lns.getFinalDistance());
+    }
+
+    SUBCASE("Same seed, same route; time budget is honoured") {
+        LnsPlanner first(planner, 0.0, 150), second(planner, 0.0, 150);
+        first.setSeed(7);
+        second.setSeed(7);
+        Route a = first.improve(seed, facilities);
+        Route b = second.improve(seed, facilities);
+        REQUIRE(a.getLength() == b.getLength());
+        for (int i = 0; i < a.getLength(); i++) {
+            CHECK(a.isDisposalAt(i) == b.isDisposalAt(i));
+            if (!a.isDisposalAt(i))
+                CHECK(a.getBinAt(i) == b.getBinAt(i));
+        }
+
+        LnsPlanner timed(planner, 20.0);
+        timed.improve(seed, facilities);
+        CHECK(timed.getIterations() > 0);
+        CHECK(timed.getLastMillis() < 20.0 + 50.0);  // bir iterasyon taşabilir
+    }
+}
+
+TEST_CASE("[UNIT] test_fleet_planner") {
+    // Three districts hanging off a central depot; one truck should end up in each
+    const int side = 9;
+    Graph graph(side * side);
+    test_fixtures::addGridStreets(graph, side, [](int) { return 5; }, [](int) { return 5; });
+    RoutePlanner planner(graph);
+
+    const int binNodes[] = {0, 1, 9, 10, 8, 7, 17, 16, 72, 73, 63, 64};  // 3 corners x 4
+    const int binCount = 12;
+    Facilities facilities;
+    facilities.addFacility(Facility("DEPOT", "depot", 0, 0, 40));
+    facilities.addFacility(Facility("DUMP", "disposal", 0, 0, 44));
+    for (int i = 0; i < binCount; i++) {
+        facilities.addBin(Bin("B" + std::to_string(i), "Grid", 100, 50 + i, 5, binNodes[i]));
+    }
+    facilities.setTruck(Truck("T1", 150, 0, 40));
+    facilities.addTruck(Truck("T2", 150, 0, 40));
+    facilities.addTruck(Truck("T3", 150, 0, 40));
+    REQUIRE(facilities.getTruckCount() == 3);
+
+    FleetPlanner fleet(planner, facilities, 2);
+
+    SUBCASE("Balanced, compact territories") {
+        for (int t = 0; t < 3; t++) {
+            CHECK(fleet.getTerritorySize(t) == 4);
+        }
+        for (int corner = 0; corner < 3; corner++) {
+            int owner = fleet.getTerritoryOf(corner * 4);
+            for (int k = 1; k < 4; k++) {
+                CHECK(fleet.getTerritoryOf(corner * 4 + k) == owner);
+            }
+        }
+        CHECK(fleet.getTerritoryOf(binCount) == -1);
+    }
+
+    SUBCASE("Every bin routed once by its own truck, facilities untouched") {
+        fleet.plan(facilities, 5.0);
+
+        int seen[binCount] = {0};
+        for (int t = 0; t < 3; t++) {
+            const Route& route = fleet.getRoute(t);
+            int carried = 0;
+            for (int i = 0; i < route.getLength(); i++) {
+                if (route.isDisposalAt(i)) {
+                    carried = 0;
+                    continue;
+                }
+                int bin = route.getBinAt(i);
+                seen[bin]++;
+                CHECK(fleet.getTerritoryOf(bin) == t);
+                carried += facilities.getBin(bin).getCurrentFill();
+                CHECK(carried <= 150);
+            }
+        }
+        for (int i = 0; i < binCount; i++) {
+            CHECK(seen[i] == 1);
+            CHECK(facilities.getBin(i).getCurrentFill() == 50 + i);
+        }
+        CHECK(fleet.getPlannedAfter() <= fleet.getPlannedBefore());
+        CHECK(fleet.getThreadCount() == 2);
+    }
+}
+
+TEST_CASE("[UNIT] test_planning_state") {
+    Graph graph(8);
+    for (int v = 0; v + 1 < 8; v++) {
+        graph.addBidirectionalEdge(v, v + 1, 3);
+    }
+    RoutePlanner planner(graph);
+
+    Facilities facilities;
+    facilities.addFacility(Facility("DEPOT", "depot", 0, 0, 0));
+    facilities.addFacility(Facility("DUMP", "disposal", 0, 0, 7));
+    const int fills[] = {60, 30, 80, 45, 70};
+    for (int i = 0; i < 5; i++) {
+        facilities.addBin(Bin("B" + std::to_string(i), "Line", 100, fills[i], 5, i + 1));
+    }
+    facilities.setTruck(Truck("T1", 150, 20, 3));
+
+    SUBCASE("Full and partial captures") {
+        PlanningState state(facilities);
+        REQUIRE(state.getBinCount() == 5);
+        for (int i = 0; i < 5; i++) {
+            CHECK(state.getBinIndex(i) == i);
+            CHECK(state.getFill(i) == fills[i]);
+            CHECK(state.getNode(i) == i + 1);
+            CHECK(state.getCapacity(i) == 100);
+        }
+        CHECK(state.getDepotNode() == 0);
+        REQUIRE(state.getDisposalCount() == 1);
+        CHECK(state.getDisposalNodes()[0] == 7);
+        CHECK(state.getTruckNode() == 3);
+        CHECK(state.getTruckLoad() == 20);
+        CHECK(state.getTruckCapacity() == 150);
+
+        const int subset[] = {4, 1};
+        state.capture(facilities, 0, subset, 2);
+        REQUIRE(state.getBinCount() == 2);
+        CHECK(state.getBinIndex(0) == 4);
+        CHECK(state.getFill(1) == 30);
+
+        PlanningState copy(state);
+        CHECK(copy.getBinCount() == 2);
+        CHECK(copy.getNode(0) == 5);
+    }
+
+    SUBCASE("Planning on a state leaves facilities untouched") {
+        PlanningState state(facilities);
+        Route route = planner.planRoute(state);
+        CHECK(route.getLength() > 0);
+        for (int i = 0; i < 5; i++) {
+            CHECK(facilities.getBin(i).getCurrentFill() == fills[i]);
+        }
+        CHECK(facilities.getTruck().getCurrentNode() == 3);
+        CHECK(facilities.getTruck().getCurrentLoad() == 20);
+
+        // The Facilities overload plans the same route, then performs it
+        Route performed = planner.planRoute(facilities);
+        REQUIRE(performed.getLength() == route.getLength());
+        for (int i = 0; i < route.getLength(); i++) {
+            CHECK(performed.getBinAt(i) == route.getBinAt(i));
+        }
+        CHECK(facilities.getBin(route.getBinAt(0)).getCurrentFill() == 0);
+    }
+
+    SUBCASE("A bin larger than the truck is skipped without a disposal trip") {
+        Facilities small;
+        small.addFacility(Facility("DEPOT", "depot", 0, 0, 0));
+        small.addFacility(Facility("DUMP", "disposal", 0, 0, 7));
+        small.addBin(Bin("SMALL", "Line", 100, 30, 5, 2));
+        small.addBin(Bin("BIG", "Line", 300, 290, 5, 4));  // 290 > 150 even when empty
+        small.setTruck(Truck("T1", 150, 20, 3));
+
+        Route route = planner.planRoute(PlanningState(small));
+        REQUIRE(route.getLength() == 1);
+        CHECK(route.getBinAt(0) == 0);
+        CHECK_FALSE(route.requiresDisposal());
+    }
+
+    SUBCASE("Concurrent planning on one state") {
+        PlanningState state(facilities);
+        Route expected = planner.planRoute(state);
+        Route routes[8];
+        ThreadPool pool(4);
+        pool.parallelFor(0, 8, [&](int k) { routes[k] = planner.planRoute(state); });
+        for (int k = 0; k < 8; k++) {
+            REQUIRE(routes[k].getLength() == expected.getLength());
+            for (int i = 0; i < expected.getLength(); i++) {
+                CHECK(routes[k].getBinAt(i) == expected.getBinAt(i));
+            }
+        }
+    }
+}
+
+TEST_CASE("[UNIT] test_bin_store") {
+    // 13 bins (not a multiple of 8), some filling past capacity within a few days
+    Facilities facilities, reference;
+    for (int i = 0; i < 13; i++) {
+        Bin bin("B" + std::to_string(i), "Street", 50 + 10 * (i % 4), 5 * i, 3 + (i * 7) % 11,
+                i);
+        facilities.addBin(bin);
+        reference.addBin(bin);
+    }
+
+    SUBCASE("Day update matches Bin::updateFill with both kernels") {
+        BinStore scalar, vectorized;
+        scalar.load(facilities);
+        vectorized.load(facilities);
+        scalar.setKernel(BinStore::Kernel::Scalar);
+        vectorized.setKernel(BinStore::Kernel::Avx2);
+        CHECK(scalar.getKernel() == BinStore::Kernel::Scalar);
+        CHECK(vectorized.getKernel() ==
+              (BinStore::hasAvx2() ? BinStore::Kernel::Avx2 : BinStore::Kernel::Scalar));
+        REQUIRE(scalar.getBinCount() == 13);
+
+        for (int day = 0; day < 10; day++) {
+            int overflowing = 0;
+            for (int i = 0; i < 13; i++) {
+                reference.getBin(i).updateFill();
+                overflowing += reference.getBin(i).isOverflowing();
+            }
+            CHECK(scalar.advanceDay() == overflowing);
+            CHECK(vectorized.advanceDay() == overflowing);
+            for (int i = 0; i < 13; i++) {
+                CHECK(scalar.getFill(i) == reference.getBin(i).getCurrentFill());
+                CHECK(vectorized.getFill(i) == reference.getBin(i).getCurrentFill());
+            }
+        }
+        CHECK(scalar.getNode(12) == 12);
+        CHECK(scalar.getFillRate(3) == reference.getBin(3).getFillRate());
+    }
+
+    SUBCASE("Collect and write back with history") {
+        BinStore store;
+        store.load(facilities);
+        for (int day = 0; day < 3; day++) {
+            store.advanceDay();
+            for (int i = 0; i < 13; i++) {
+                reference.getBin(i).updateFill();
+            }
+        }
+        CHECK(store.getHistory(0, 0) == store.getFill(0));
+        CHECK(store.getHistory(0, 3) == 0);  // only three days advanced
+
+        store.collect(5, 1000);
+        reference.getBin(5).collect(1000);
+        store.collect(6, -4);  // ignored
+
+        store.writeTo(facilities);
+        for (int i = 0; i < 13; i++) {
+            const Bin& written = facilities.getBin(i);
+            const Bin& expected = reference.getBin(i);
+            CHECK(written.getCurrentFill() == expected.getCurrentFill());
+            CHECK(written.getHistoryIndex() == expected.getHistoryIndex());
+            CHECK(written.getAverageFillRate() == expected.getAverageFillRate());
+        }
+
+        // Written back every day (as the simulation does): each day is recorded once
+        for (int day = 0; day < 2; day++) {
+            store.advanceDay();
+            store.writeTo(facilities);
+            for (int i = 0; i < 13; i++) {
+                reference.getBin(i).updateFill();
+            }
+        }
+        for (int i = 0; i < 13; i++) {
+            CHECK(facilities.getBin(i).getHistoryIndex() == reference.getBin(i).getHistoryIndex());
+            CHECK(facilities.getBin(i).getAverageFillRate() ==
+                  reference.getBin(i).getAverageFillRate());
+        }
+    }
+
+    SUBCASE("Long history windows survive the write-back") {
+        Facilities longer, expected;
+        for (int i = 0; i < 5; i++) {
+            Bin bin("L" + std::to_string(i), "Street", 1000, 10 * i, 2 + i, i, i < 3 ? 30 : 7);
+            longer.addBin(bin);
+            expected.addBin(bin);
+        }
+        BinStore store;
+        store.load(longer);
+        CHECK(store.getHistoryDays() == 30);
+        for (int day = 0; day < 12; day++) {  // more days than the default window
+            store.advanceDay();
+            for (int i = 0; i < 5; i++) {
+                expected.getBin(i).updateFill();
+            }
+        }
+        store.writeTo(longer);
+        for (int i = 0; i < 5; i++) {
+            const Bin& written = longer.getBin(i);
+            const Bin& reference = expected.getBin(i);
+            CHECK(written.getRecordedDays() == reference.getRecordedDays());
+            CHECK(written.getAverageFillRate() == reference.getAverageFillRate());
+            CHECK(written.getAverageDailyChange() == reference.getAverageDailyChange());
+        }
+    }
+}
+
+TEST_CASE("[UNIT] test_emergency_rescheduler") {
+    // Two-way street 0-1-...-9, depot at 0, dump at 9; node 11 is cut off
+    Graph graph(12);
+    for (int v = 0; v + 1 < 10; v++) {
+        graph.addBidirectionalEdge(v, v + 1, 2);
+    }
+    RoutePlanner planner(graph);
+
+    Facilities facilities;
+    facilities.addFacility(Facility("DEPOT", "depot", 0, 0, 0));
+    facilities.addFacility(Facility("DUMP", "disposal", 0, 0, 9));
+    const int binNodes[] = {2, 4, 6, 3, 11};
+    for (int i = 0; i < 5; i++) {
+        facilities.addBin(Bin("B" + std::to_string(i), "Street", 100, 30, 5, binNodes[i]));
+    }
+    facilities.setTruck(Truck("T1", 100, 0, 0));
+    PlanningState state(facilities);
+
+    Route seed;
+    seed.addBin(0);
+    seed.addBin(2);
+    EmergencyRescheduler rescheduler(planner);
+    rescheduler.attach(seed, state);
+    CHECK(rescheduler.getLookups() == 3);
+    CHECK(rescheduler.getPlannedDistance() == 24);
+
+    SUBCASE("Cheapest position, O(route length) lookups") {
+        int added = rescheduler.insert(1);  // node 4 lies on the way from 2 to 6
+        CHECK(added == 0);
+        const Route& route = rescheduler.getRoute();
+        REQUIRE(route.getLength() == 3);
+        CHECK(route.getBinAt(1) == 1);
+        CHECK(rescheduler.getLookups() == 3 + 2 * 3);  // two per position
+        CHECK(rescheduler.getPlannedDistance() == 24);
+    }
+
+    SUBCASE("Full truck starts a new trip after the dump") {
+        rescheduler.insert(1);  // 90 units planned: no trip has room for 30 more
+        CHECK(rescheduler.insertionCost(3) == -1);  // pricing never opens a trip
+        CHECK(rescheduler.getRoute().getLength() == 3);
+        int added = rescheduler.insert(3);
+        const Route& route = rescheduler.getRoute();
+        REQUIRE(route.getLength() == 5);
+        CHECK(route.isDisposalAt(3));
+        CHECK(route.getDisposalNodeAt(3) == 9);
+        CHECK(route.getBinAt(4) == 3);
+        CHECK(added == 6 + 12 + 6 - 12);  // 6 -> 9 -> 3 -> 0 instead of 6 -> 0
+        CHECK(rescheduler.getPlannedDistance() == 24 + added);
+    }
+
+    SUBCASE("Unreachable bins are left out") {
+        CHECK(rescheduler.insert(4) == -1);
+        CHECK(rescheduler.getRoute().getLength() == 2);
+    }
+}
+
+TEST_CASE("[UNIT] test_horizon_planner") {
+    // Street 0..19 (depot 0, dump 19) with a 30-unit side road from 5 to 20
+    Graph graph(21);
+    for (int v = 0; v + 1 < 20; v++) {
+        graph.addBidirectionalEdge(v, v + 1, 2);
+    }
+    graph.addBidirectionalEdge(5, 20, 30);
+    RoutePlanner planner(graph);
+
+    // B0 overflows tomorrow, B1 is due in 6 days on the way, B2 can wait for months,
+    // B3 is empty and B4 is due in 6 days but up the side road
+    auto makeCity = [](Facilities& facilities) {
+        facilities.addFacility(Facility("DEPOT", "depot", 0, 0, 0));
+        facilities.addFacility(Facility("DUMP", "disposal", 0, 0, 19));
+        facilities.addBin(Bin("B0", "Street", 100, 95, 5, 10));
+        facilities.addBin(Bin("B1", "Street", 100, 70, 5, 5));
+        facilities.addBin(Bin("B2", "Street", 100, 10, 1, 18));
+        facilities.addBin(Bin("B3", "Street", 100, 0, 5, 15));
+        facilities.addBin(Bin("B4", "Side", 100, 70, 5, 20));
+        facilities.setTruck(Truck("T1", 500, 0, 0));
+    };
+    Facilities facilities;
+    makeCity(facilities);
+    HorizonPlanner horizon(planner);
+    PlanningState today;
+
+    SUBCASE("Urgent bins and cheap ones on the way") {
+        CHECK(horizon.select(facilities, today) == 2);
+        REQUIRE(today.getBinCount() == 2);
+        CHECK(today.getBinIndex(0) == 0);
+        CHECK(today.getBinIndex(1) == 1);
+        CHECK(horizon.getMustCount() == 1);
+        CHECK(horizon.getOptionalCount() == 1);
+        CHECK(horizon.getDeferredCount() == 2);
+        CHECK(facilities.getBin(1).getCurrentFill() == 70);  // nothing collected
+    }
+
+    SUBCASE("No detour allowance keeps only the must bins") {
+        horizon.setDetourFactor(0.0);
+        CHECK(horizon.select(facilities, today) == 1);
+        CHECK(horizon.getDeferredCount() == 3);
+    }
+
+    SUBCASE("A day without urgent bins plans nothing") {
+        facilities.getBin(0).setCurrentFill(50);
+        CHECK(horizon.select(facilities, today) == 0);
+        CHECK(today.getBinCount() == 0);
+        CHECK(horizon.getDeferredCount() == 4);
+    }
+
+    SUBCASE("Simulation drives less without more overflows") {
+        Facilities plain;
+        makeCity(plain);
+        Simulation everyBin(graph, plain, 5);
+        everyBin.run();
+
+        Simulation deferring(graph, facilities, 5);
+        deferring.getHorizonPlanner().setEnabled(true);
+        deferring.run();
+        CHECK(deferring.getTotalDistance() < everyBin.getTotalDistance());
+        CHECK(deferring.getOverflowCount() <= everyBin.getOverflowCount());
+        CHECK(deferring.getDeferredBinDays() > 0);
+    }
+}
+
+TEST_CASE("[UNIT] test_distance_matrix") {
+    Graph graph(6);
+    graph.addBidirectionalEdge(0, 1, 4);
+    graph.addBidirectionalEdge(1, 2, 3);
+    graph.addBidirectionalEdge(2, 3, 2);
+    graph.addEdge(3, 4, 70000);  // too long for 16-bit cells
+    RoutePlanner planner(graph);
+
+    SUBCASE("Lookups match Dijkstra") {
+        int points[] = {0, 2, 3, 2};
+        DistanceMatrix matrix;
+        REQUIRE(matrix.build(planner, points, 4, DistanceMatrix::Storage::Auto, 2));
+        CHECK(matrix.getPointCount() == 3);  // duplicate ignored
+        CHECK(matrix.isCompact());
+        // No 32-bit table next to the 16-bit one: only two 3-int row buffers on top
+        CHECK(matrix.getPeakMemoryUsage() == matrix.getMemoryUsage() + 2 * 3 * sizeof(int));
+
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                CHECK(matrix.lookup(points[i], points[j]) ==
+                      planner.computeDistance(points[i], points[j]));
+            }
+        }
+        CHECK_FALSE(matrix.contains(1));
+    }
+
+    SUBCASE("Wide cells when distances do not fit") {
+        int points[] = {0, 4, 5};
+        DistanceMatrix matrix;
+        matrix.build(planner, points, 3, DistanceMatrix::Storage::Auto, 2);
+        CHECK_FALSE(matrix.isCompact());
+        // The 16-bit attempt is freed before the 32-bit table is allocated
+        CHECK(matrix.getPeakMemoryUsage() < matrix.getMemoryUsage() + 3 * 3 * sizeof(short));
+        CHECK(matrix.lookup(0, 4) == 70009);
+        CHECK(matrix.lookup(0, 5) == INT_MAX);
+        CHECK(matrix.lookup(4, 0) == INT_MAX);
+    }
+
+    SUBCASE("Planner answers from the matrix") {
+        int points[] = {0, 3};
+        DistanceMatrix matrix;
+        matrix.build(planner, points, 2, DistanceMatrix::Storage::Bits32);
+        planner.setDistanceMatrix(&matrix);
+        CHECK(planner.computeDistance(0, 3) == 9);
+        CHECK(planner.computeDistance(0, 1) == 4);  // not a point, falls back to search
+        CHECK(matrix.getMemoryUsage() > 0);
+    }
+}
+
+TEST_CASE("[UNIT] test_thread_pool") {
+    ThreadPool pool(4);
+    int results[100] = {0};
+    pool.parallelFor(0, 100, [&results](int i) { results[i] = i * i; });
+
+    bool allSet = true;
+    for (int i = 0; i < 100; i++) {
+        if (results[i] != i * i)
+            allSet = false;
+    }
+    CHECK(allSet);
+    CHECK(pool.getThreadCount() == 4);
+}
+
+TEST_CASE("[UNIT] test_nearest_disposal_field") {
+    // Directed city: 0 -> 1 -> 2 -> 3, 0 -> 4 (long), 4 -> 3, 5 isolated
+    Graph graph(6);
+    graph.addEdge(0, 1, 2);
+    graph.addEdge(1, 2, 2);
+    graph.addEdge(2, 3, 2);
+    graph.addEdge(0, 4, 9);
+    graph.addEdge(4, 3, 1);
+    RoutePlanner planner(graph);
+
+    SUBCASE("Labels match per-site Dijkstra") {
+        int sites[] = {3, 4};
+        NearestDisposalField field(planner.getNetwork());
+        field.build(sites, 2);
+
+        CHECK(field.getNearest(0) == 3);
+        CHECK(field.getDistance(0) == 6);
+        CHECK(field.getNearest(4) == 4);
+        CHECK(field.getDistance(4) == 0);
+        CHECK(field.getNearest(5) == -1);
+        CHECK(field.getDistance(5) == INT_MAX);
+        CHECK(field.getNearest(42) == -1);
+    }
+
+    SUBCASE("Incremental add and close match a rebuild") {
+        int sites[] = {3};
+        NearestDisposalField field(planner.getNetwork());
+        field.build(sites, 1);
+
+        field.addDisposal(1);
+        CHECK(field.getNearest(0) == 1);
+        CHECK(field.getDistance(0) == 2);
+        CHECK(field.getNearest(2) == 3);
+
+        field.removeDisposal(1);
+        CHECK(field.getDisposalCount() == 1);
+        CHECK(field.getNearest(0) == 3);
+        CHECK(field.getDistance(0) == 6);
+
+        field.removeDisposal(3);
+        CHECK(field.getNearest(0) == -1);
+        CHECK(field.getDistance(2) == INT_MAX);
+    }
+
+    SUBCASE("Planner uses the field") {
+        Facilities facilities;
+        facilities.addFacility(Facility("D1", "disposal", 0, 0, 3));
+        facilities.addFacility(Facility("D2", "disposal", 0, 0, 4));
+
+        int count = 0;
+        int* sites = facilities.getDisposalNodes(count);
+        int expected = planner.findNearestDisposal(0, facilities);
+
+        NearestDisposalField field(planner.getNetwork());
+        field.build(sites, count);
+        planner.setDisposalField(&field);
+        CHECK(planner.findNearestDisposal(0, facilities) == expected);
+        delete[] sites;
+    }
+}
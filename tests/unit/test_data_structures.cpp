@@ -6,8 +6,10 @@
  */
 
 #include "doctest.h"
+#include "data_structures/CsrGraph.h"
 #include "data_structures/Graph.h"
 #include "data_structures/HashTable.h"
+#include "data_structures/IndexedPriorityQueue.hpp"
 #include "data_structures/LinkedList.hpp"
 #include "data_structures/PriorityQueue.hpp"
 
@@ -134,3 +136,133 @@ TEST_CASE("[UNIT] test_traversal") {
         CHECK(count == 2);
     }
 }
+
+TEST_CASE("[UNIT] test_csr_graph") {
+    SUBCASE("CSR matches adjacency lists") {
+        Graph g(4);
+        g.addEdge(0, 1, 5);
+        g.addEdge(0, 2, 3);
+        g.addEdge(2, 3, 4);
+
+        CsrGraph csr(g);
+        CHECK(csr.getNodeCount() == 4);
+        CHECK(csr.getEdgeCount() == 3);
+        CHECK(csr.getDegree(0) == 2);
+        CHECK(csr.getDegree(1) == 0);
+
+        const Edge* e = csr.edgesBegin(0);
+        CHECK(e[0].toNode == 1);
+        CHECK(e[0].weight == 5);
+        CHECK(e[1].toNode == 2);
+        CHECK(csr.edgesBegin(2)->toNode == 3);
+    }
+
+    SUBCASE("Invalid node has empty range") {
+        Graph g(2);
+        g.addEdge(0, 1, 1);
+        CsrGraph csr(g);
+        CHECK(csr.edgesBegin(100) == csr.edgesEnd(100));
+        CHECK(csr.getDegree(-1) == 0);
+    }
+
+    SUBCASE("Copy keeps edges") {
+        Graph g(3);
+        g.addEdge(1, 2, 9);
+        CsrGraph a(g);
+        CsrGraph b = a;
+        CHECK(b.getEdgeCount() == 1);
+        CHECK(b.edgesBegin(1)->weight == 9);
+    }
+
+    SUBCASE("Reverse index tracks incoming edges") {
+        Graph g(4);
+        g.addEdge(0, 2, 5);
+        CHECK_FALSE(g.hasReverseIndex());
+        CHECK(g.getReverseAdjList(2).isEmpty());
+
+        g.enableReverseIndex();
+        g.addEdge(1, 2, 7);  // added after enabling
+        g.addEdge(2, 3, 1);
+        CHECK(g.hasReverseIndex());
+        CHECK(g.getReverseAdjList(2).size() == 2);
+        CHECK(g.getReverseAdjList(3).front().toNode == 2);
+
+        Graph copy = g;
+        CHECK(copy.hasReverseIndex());
+        CHECK(copy.getReverseAdjList(2).size() == 2);
+
+        CsrGraph fromIndex, fromTranspose;
+        fromIndex.buildReverse(g);
+        fromTranspose = CsrGraph(g).transposed();
+        CHECK(fromIndex.getEdgeCount() == 3);
+        for (int v = 0; v < 4; v++) {
+            CHECK(fromIndex.getDegree(v) == fromTranspose.getDegree(v));
+        }
+        CHECK(fromIndex.edgesBegin(2)->toNode == 0);
+        CHECK(fromIndex.edgesBegin(2)->weight == 5);
+    }
+}
+
+TEST_CASE("[UNIT] test_heap_ordering") {
+    SUBCASE("PriorityQueue pops in priority order") {
+        PriorityQueue<int> pq;
+        for (int i = 0; i < 200; i++) {
+            int p = (i * 37) % 200;  // permutation of 0..199
+            pq.push(p, p);
+        }
+
+        int previous = -1;
+        bool sorted = true;
+        while (!pq.isEmpty()) {
+            if (pq.top() < previous)
+                sorted = false;
+            previous = pq.top();
+            pq.pop();
+        }
+        CHECK(sorted);
+        CHECK(previous == 199);
+    }
+
+    SUBCASE("PriorityQueue copy is independent") {
+        PriorityQueue<int> a;
+        a.push(5, 5);
+        a.push(1, 1);
+        PriorityQueue<int> b = a;
+        b.pop();
+        CHECK(a.top() == 1);
+        CHECK(b.top() == 5);
+    }
+
+    SUBCASE("Indexed decrease-key") {
+        IndexedPriorityQueue<int> pq(5);
+        pq.push(0, 50);
+        pq.push(1, 40);
+        pq.push(2, 30);
+        CHECK(pq.top() == 2);
+
+        pq.decreaseKey(0, 10);
+        CHECK(pq.top() == 0);
+        CHECK(pq.size() == 3);
+
+        CHECK_FALSE(pq.pushOrDecrease(1, 45));  // larger key is ignored
+        CHECK(pq.pushOrDecrease(3, 5));
+        CHECK(pq.top() == 3);
+    }
+
+    SUBCASE("Indexed remove and contains") {
+        IndexedPriorityQueue<int> pq(4);
+        pq.push(0, 3);
+        pq.push(1, 1);
+        pq.push(2, 2);
+        pq.remove(1);
+        CHECK_FALSE(pq.contains(1));
+        CHECK(pq.top() == 2);
+
+        pq.changeKey(2, 9);
+        CHECK(pq.top() == 0);
+
+        pq.clear();
+        CHECK(pq.isEmpty());
+        CHECK_FALSE(pq.contains(0));
+    }
+}